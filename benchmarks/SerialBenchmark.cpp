@@ -0,0 +1,460 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Serial (non-MPI) benchmarks for the hot paths of the frontend and the
+ * backends. Each benchmark is repeated several times, the results are
+ * reported as benchmark::Result in JSON (default) or CSV format, so runs
+ * of different versions can be compared.
+ */
+
+#include <openPMD/benchmark/BenchmarkResult.hpp>
+#include <openPMD/openPMD.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace openPMD;
+
+namespace
+{
+struct Options
+{
+    unsigned int repetitions = 5;
+    bool quick = false;
+    std::string directory = "../benchmarks/serial";
+    std::string output;
+    std::vector<std::string> backends;
+    std::string filter;
+
+    // problem sizes, reduced by --quick
+    unsigned int hierarchyIterations = 10;
+    unsigned int hierarchyMeshes = 20;
+    unsigned int attributes = 1000;
+    std::uint64_t chunkElements = 1u << 18;
+    unsigned int tinyChunks = 1000;
+    std::uint64_t tinyChunkElements = 16;
+};
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+class BenchmarkRunner
+{
+public:
+    explicit BenchmarkRunner(Options options) : m_options(std::move(options))
+    {}
+
+    /*
+     * Run a benchmark m_options.repetitions times.
+     * `run` performs one repetition and returns the measured time in
+     * seconds, so it can exclude setup and teardown from the measurement.
+     */
+    void measure(
+        std::string const &name,
+        std::string const &backend,
+        std::uint64_t bytes,
+        std::function<double(unsigned int repetition)> const &run)
+    {
+        std::vector<double> samples;
+        std::optional<std::uint64_t> peakRSS;
+        for (unsigned int rep = 0; rep < m_options.repetitions; ++rep)
+        {
+            benchmark::resetPeakResidentSetSize();
+            samples.push_back(run(rep));
+            auto current = benchmark::peakResidentSetSize();
+            if (current.has_value())
+            {
+                peakRSS = std::max(peakRSS.value_or(0), *current);
+            }
+        }
+        benchmark::Result result;
+        result.name = name;
+        result.parameters = {
+            {"backend", backend},
+            {"openpmd_api", getVersion()},
+            {"quick", m_options.quick ? "true" : "false"}};
+        result.seconds = benchmark::Statistics::fromSamples(samples);
+        result.bytes = bytes;
+        result.peakRSS = peakRSS;
+        std::cerr << "[SerialBenchmark] " << name << " (" << backend
+                  << "): median " << result.seconds.median << "s"
+                  << std::endl;
+        m_results.push_back(std::move(result));
+    }
+
+    /*
+     * Benchmarks are filtered by group, since reading benchmarks depend on
+     * the files written by the writing benchmarks of the same group.
+     */
+    bool enabled(std::string const &group) const
+    {
+        return m_options.filter.empty() ||
+            group.find(m_options.filter) != std::string::npos;
+    }
+
+    std::string path(std::string const &name, std::string const &backend)
+    {
+        return m_options.directory + "/" + name + "." + backend;
+    }
+
+    Options const &options() const
+    {
+        return m_options;
+    }
+
+    std::vector<benchmark::Result> const &results() const
+    {
+        return m_results;
+    }
+
+private:
+    Options m_options;
+    std::vector<benchmark::Result> m_results;
+};
+
+/*
+ * Write a Series with many small objects: iterations with meshes of three
+ * components each, a particle species and some attributes per object.
+ */
+void writeHierarchy(Series &series, Options const &options)
+{
+    for (unsigned int i = 0; i < options.hierarchyIterations; ++i)
+    {
+        Iteration iteration = series.iterations[i];
+        iteration.setAttribute("comment", "benchmark");
+        for (unsigned int m = 0; m < options.hierarchyMeshes; ++m)
+        {
+            Mesh mesh = iteration.meshes["mesh_" + std::to_string(m)];
+            mesh.setAttribute("index", m);
+            for (auto const &dim : {"x", "y", "z"})
+            {
+                MeshRecordComponent rc = mesh[dim];
+                rc.resetDataset({Datatype::DOUBLE, {4}});
+                rc.makeConstant(double(m));
+            }
+        }
+        ParticleSpecies electrons = iteration.particles["e"];
+        for (auto const &record : {"position", "positionOffset"})
+        {
+            for (auto const &dim : {"x", "y", "z"})
+            {
+                RecordComponent rc = electrons[record][dim];
+                rc.resetDataset({Datatype::DOUBLE, {16}});
+                rc.makeConstant(0.);
+            }
+        }
+    }
+}
+
+void seriesParse(BenchmarkRunner &runner, std::string const &backend)
+{
+    auto const &options = runner.options();
+    auto filename = runner.path("hierarchy_%T", backend);
+    {
+        Series series(filename, Access::CREATE);
+        writeHierarchy(series, options);
+        series.close();
+    }
+    runner.measure("series_open_parse", backend, 0, [&](unsigned int) {
+        auto start = Clock::now();
+        Series series(filename, Access::READ_ONLY);
+        series.close();
+        return secondsSince(start);
+    });
+    runner.measure("series_open_deferred", backend, 0, [&](unsigned int) {
+        auto start = Clock::now();
+        Series series(
+            filename,
+            Access::READ_ONLY,
+            R"({"defer_iteration_parsing": true})");
+        series.iterations[0].open();
+        series.close();
+        return secondsSince(start);
+    });
+}
+
+void attributes(BenchmarkRunner &runner, std::string const &backend)
+{
+    auto const &options = runner.options();
+    auto filename = runner.path("attributes", backend);
+    std::uint64_t bytes = options.attributes * sizeof(double);
+    runner.measure("attribute_write", backend, bytes, [&](unsigned int) {
+        auto start = Clock::now();
+        Series series(filename, Access::CREATE);
+        Iteration iteration = series.iterations[0];
+        for (unsigned int a = 0; a < options.attributes; ++a)
+        {
+            iteration.setAttribute("attr_" + std::to_string(a), double(a));
+        }
+        series.close();
+        return secondsSince(start);
+    });
+    runner.measure("attribute_read", backend, bytes, [&](unsigned int) {
+        auto start = Clock::now();
+        Series series(filename, Access::READ_ONLY);
+        Iteration iteration = series.iterations[0];
+        double sum = 0;
+        for (unsigned int a = 0; a < options.attributes; ++a)
+        {
+            sum += iteration.getAttribute("attr_" + std::to_string(a))
+                       .get<double>();
+        }
+        series.close();
+        auto res = secondsSince(start);
+        if (sum < 0)
+        {
+            throw std::runtime_error("Unexpected attribute values.");
+        }
+        return res;
+    });
+}
+
+void chunks(BenchmarkRunner &runner, std::string const &backend)
+{
+    auto const &options = runner.options();
+    auto filename = runner.path("chunks", backend);
+    auto elements = options.chunkElements;
+    std::uint64_t bytes = elements * sizeof(double);
+    std::vector<double> data(elements);
+    std::iota(data.begin(), data.end(), 0.);
+
+    runner.measure("store_chunk", backend, bytes, [&](unsigned int) {
+        auto start = Clock::now();
+        Series series(filename, Access::CREATE);
+        auto rc = series.iterations[0].meshes["E"]["x"];
+        rc.resetDataset({Datatype::DOUBLE, {elements}});
+        rc.storeChunk(data, {0}, {elements});
+        series.close();
+        return secondsSince(start);
+    });
+    runner.measure("load_chunk", backend, bytes, [&](unsigned int) {
+        auto start = Clock::now();
+        Series series(filename, Access::READ_ONLY);
+        auto rc = series.iterations[0].meshes["E"]["x"];
+        auto loaded = rc.loadChunk<double>({0}, {elements});
+        series.flush();
+        series.close();
+        auto res = secondsSince(start);
+        if (loaded.get()[elements - 1] != double(elements - 1))
+        {
+            throw std::runtime_error("Read back wrong data.");
+        }
+        return res;
+    });
+
+    auto tinyFilename = runner.path("tiny_chunks", backend);
+    auto tinyElements = options.tinyChunkElements;
+    auto tinyTotal = tinyElements * options.tinyChunks;
+    std::uint64_t tinyBytes = tinyTotal * sizeof(double);
+    std::vector<double> tinyData(tinyElements, 1.);
+    for (bool flushEachChunk : {false, true})
+    {
+        runner.measure(
+            flushEachChunk ? "tiny_chunks_flush_each" : "tiny_chunks",
+            backend,
+            tinyBytes,
+            [&](unsigned int) {
+                auto start = Clock::now();
+                Series series(tinyFilename, Access::CREATE);
+                auto rc = series.iterations[0].meshes["E"]["x"];
+                rc.resetDataset({Datatype::DOUBLE, {tinyTotal}});
+                for (unsigned int c = 0; c < options.tinyChunks; ++c)
+                {
+                    rc.storeChunk(
+                        tinyData, {c * tinyElements}, {tinyElements});
+                    if (flushEachChunk)
+                    {
+                        series.flush();
+                    }
+                }
+                series.close();
+                return secondsSince(start);
+            });
+    }
+}
+
+/*
+ * Overhead of the frontend alone: Build the hierarchy without flushing it,
+ * i.e. without any task reaching the backend. Writing the Series to disk
+ * at the end is excluded from the measurement.
+ */
+void frontendOnly(BenchmarkRunner &runner)
+{
+    auto const &options = runner.options();
+    auto filename = runner.path("frontend_%T", "json");
+    runner.measure("frontend_build_hierarchy", "none", 0, [&](unsigned int) {
+        Series series(filename, Access::CREATE);
+        auto start = Clock::now();
+        writeHierarchy(series, options);
+        auto res = secondsSince(start);
+        series.close();
+        return res;
+    });
+}
+
+void printHelp(std::string const &programName)
+{
+    std::cout
+        << "Usage: " << programName << " [options]\n"
+        << "Run serial benchmarks of the openPMD-api frontend and backends.\n\n"
+        << "Options:\n"
+        << "    -r, --repetitions N  repetitions per benchmark (default: 5)\n"
+        << "    -b, --backend EXT    only run this backend, e.g. json, h5, "
+           "bp\n"
+        << "                         (may be repeated, default: all "
+           "available)\n"
+        << "    -f, --filter NAME    only run benchmark groups whose name "
+           "contains NAME\n"
+        << "                         (groups: frontend, series_parse, "
+           "attributes, chunks)\n"
+        << "    -d, --directory DIR  directory for benchmark files\n"
+        << "                         (default: ../benchmarks/serial)\n"
+        << "    -o, --output FILE    write results to FILE instead of stdout,\n"
+        << "                         as CSV if FILE ends in .csv, else JSON\n"
+        << "    -q, --quick          use small problem sizes (for testing)\n"
+        << "    -h, --help           display this help and exit\n";
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    Options options;
+    for (int c = 1; c < argc; ++c)
+    {
+        std::string arg = argv[c];
+        bool hasValue = c + 1 < argc;
+        if (arg == "--help" || arg == "-h")
+        {
+            printHelp(argv[0]);
+            return 0;
+        }
+        else if (arg == "--quick" || arg == "-q")
+        {
+            options.quick = true;
+        }
+        else if ((arg == "--repetitions" || arg == "-r") && hasValue)
+        {
+            options.repetitions = unsigned(std::stoul(argv[++c]));
+        }
+        else if ((arg == "--backend" || arg == "-b") && hasValue)
+        {
+            options.backends.emplace_back(argv[++c]);
+        }
+        else if ((arg == "--filter" || arg == "-f") && hasValue)
+        {
+            options.filter = argv[++c];
+        }
+        else if ((arg == "--directory" || arg == "-d") && hasValue)
+        {
+            options.directory = argv[++c];
+        }
+        else if ((arg == "--output" || arg == "-o") && hasValue)
+        {
+            options.output = argv[++c];
+        }
+        else
+        {
+            std::cerr << "Unknown argument '" << arg << "'! See: " << argv[0]
+                      << " --help\n";
+            return 1;
+        }
+    }
+
+    if (options.quick)
+    {
+        options.hierarchyIterations = 2;
+        options.hierarchyMeshes = 4;
+        options.attributes = 20;
+        options.chunkElements = 1024;
+        options.tinyChunks = 20;
+    }
+    if (options.backends.empty())
+    {
+        auto variants = getVariants();
+        options.backends.emplace_back("json");
+        if (variants["hdf5"])
+        {
+            options.backends.emplace_back("h5");
+        }
+        if (variants["adios2"])
+        {
+            options.backends.emplace_back("bp");
+        }
+    }
+
+    BenchmarkRunner runner(options);
+    if (runner.enabled("frontend"))
+    {
+        frontendOnly(runner);
+    }
+    for (auto const &backend : options.backends)
+    {
+        if (runner.enabled("series_parse"))
+        {
+            seriesParse(runner, backend);
+        }
+        if (runner.enabled("attributes"))
+        {
+            attributes(runner, backend);
+        }
+        if (runner.enabled("chunks"))
+        {
+            chunks(runner, backend);
+        }
+    }
+
+    auto write = [&runner, &options](std::ostream &out) {
+        if (options.output.size() >= 4 &&
+            options.output.compare(options.output.size() - 4, 4, ".csv") == 0)
+        {
+            benchmark::writeCSV(out, runner.results());
+        }
+        else
+        {
+            benchmark::writeJSON(out, runner.results());
+        }
+    };
+    if (options.output.empty())
+    {
+        write(std::cout);
+    }
+    else
+    {
+        std::ofstream file(options.output);
+        write(file);
+    }
+    return 0;
+}
@@ -32,6 +32,7 @@ function(openpmd_print_summary)
     endif()
     message("  CLI Tools: ${openPMD_BUILD_CLI_TOOLS}")
     message("  Examples: ${openPMD_BUILD_EXAMPLES}")
+    message("  Benchmarks: ${openPMD_BUILD_BENCHMARKS}")
     message("  Testing: ${openPMD_BUILD_TESTING}")
     message("  Invasive Tests: ${openPMD_USE_INVASIVE_TESTS}")
     message("  Internal VERIFY: ${openPMD_USE_VERIFY}")
@@ -152,7 +152,7 @@ int main()
 {
     for (auto const &ext : openPMD::getFileExtensions())
     {
-        if (ext == "sst" || ext == "ssc")
+        if (ext == "sst" || ext == "ssc" || ext == "shm")
         {
             continue;
         }
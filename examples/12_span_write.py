@@ -42,6 +42,6 @@ def span_write(filename):
 
 if __name__ == "__main__":
     for ext in io.file_extensions:
-        if ext == "sst" or ext == "ssc":
+        if ext == "sst" or ext == "ssc" or ext == "shm":
             continue
         span_write("../samples/span_write_python." + ext)
@@ -7,6 +7,7 @@
 #include <mpi.h>
 #endif
 
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -19,6 +20,11 @@ inline void print_help(std::string const &program_name)
     std::cout << "Options:\n";
     std::cout
         << "    -w, --weak    run a weak scaling (default: strong scaling)\n";
+    std::cout << "    -r, --repetitions N\n"
+              << "                  repeat each run N times (default: 1)\n";
+    std::cout << "    -o, --output FILE\n"
+              << "                  write machine-readable results to FILE,\n"
+              << "                  as CSV if FILE ends in .csv, else JSON\n";
     std::cout << "    -h, --help    display this help and exit\n";
     std::cout << "    -v, --version output version information and exit\n";
     std::cout << "\n";
@@ -50,6 +56,8 @@ int main(int argc, char *argv[])
     for (int i = 0; i < argc; ++i)
         str_argv.emplace_back(argv[i]);
     bool weak_scaling = false;
+    unsigned int repetitions = 1;
+    std::string output;
 
     for (int c = 1; c < int(argc); c++)
     {
@@ -67,12 +75,26 @@ int main(int argc, char *argv[])
         {
             weak_scaling = true;
         }
-    }
-
-    if (argc > 2)
-    {
-        std::cerr << "Too many arguments! See: " << argv[0] << " --help\n";
-        return 1;
+        else if (
+            (std::string("--repetitions") == argv[c] ||
+             std::string("-r") == argv[c]) &&
+            c + 1 < argc)
+        {
+            repetitions = unsigned(std::stoul(argv[++c]));
+        }
+        else if (
+            (std::string("--output") == argv[c] ||
+             std::string("-o") == argv[c]) &&
+            c + 1 < argc)
+        {
+            output = argv[++c];
+        }
+        else
+        {
+            std::cerr << "Unknown argument '" << argv[c]
+                      << "'! See: " << argv[0] << " --help\n";
+            return 1;
+        }
     }
 
     // For simplicity, use only one datatype in this benchmark.
@@ -132,6 +154,17 @@ int main(int argc, char *argv[])
         dfp,
     };
 
+    // Optional settings: Each run can be repeated for statistics, and the
+    // data can be read back with different access patterns (the block written
+    // by the rank, the full dataset, or a hyperplane slice).
+    // Number of mesh records and particle species per iteration as well as
+    // the flush pattern can be set via benchmark.meshRecords,
+    // benchmark.particleSpecies and benchmark.flushPattern.
+    benchmark.repetitions = repetitions;
+    benchmark.readPatterns = {
+        openPMD::BenchmarkReadPattern::Block,
+        openPMD::BenchmarkReadPattern::Slice};
+
     // Add benchmark runs to be executed. This will only store the configuration
     // and not run the benchmark yet. Each run is configured by:
     // * The compression scheme to use (first two parameters). The first
@@ -177,6 +210,22 @@ int main(int argc, char *argv[])
                              .count()
                       << std::endl;
         }
+
+        // Percentile statistics and peak memory usage for each run in a
+        // machine-readable format.
+        if (!output.empty())
+        {
+            std::ofstream file(output);
+            if (output.size() >= 4 &&
+                output.compare(output.size() - 4, 4, ".csv") == 0)
+            {
+                openPMD::benchmark::writeCSV(file, res.results);
+            }
+            else
+            {
+                openPMD::benchmark::writeJSON(file, res.results);
+            }
+        }
     }
 
     MPI_Finalize();
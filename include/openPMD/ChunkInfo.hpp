@@ -28,8 +28,12 @@
 #include <mpi.h>
 #endif
 
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace openPMD
@@ -53,6 +57,44 @@ struct ChunkInfo
     bool operator==(ChunkInfo const &other) const;
 };
 
+/**
+ * Value statistics of a chunk that has been written by some data producing
+ * application.
+ *
+ * Statistics are reported only by backends that can provide them without
+ * loading the chunk's data:
+ * * ADIOS2 reports the per-block min/max values stored by the engine,
+ *   provided that the file records that the writer had them enabled
+ *   (engine parameter StatsLevel, see the ADIOS2 backend documentation).
+ * * JSON computes them from the dataset, but only for
+ *   RecordComponent::loadChunksInRange() and not for datasets whose
+ *   contents are parsed on demand (read-only files).
+ * * HDF5 does currently not report statistics.
+ *
+ * Min/max values are stored as double independent of the dataset's type,
+ * complex and non-numeric datasets carry no statistics.
+ */
+struct ChunkStatistics
+{
+    double min = 0; //!< smallest value contained in the chunk
+    double max = 0; //!< largest value contained in the chunk
+    uint64_t count = 0; //!< number of values contained in the chunk
+
+    explicit ChunkStatistics() = default;
+    ChunkStatistics(double min, double max, uint64_t count);
+
+    /**
+     * @brief Can the chunk contain values in the closed interval
+     *        [lower, upper]?
+     *
+     * @return false if the statistics prove that no value of the chunk lies
+     *         within the interval, true otherwise.
+     */
+    bool mayContain(double lower, double upper) const;
+
+    bool operator==(ChunkStatistics const &other) const;
+};
+
 /**
  * Represents the meta info around a chunk that has been written by some
  * data producing application.
@@ -69,6 +111,11 @@ struct ChunkInfo
 struct WrittenChunkInfo : ChunkInfo
 {
     unsigned int sourceID = 0; //!< ID of the data source containing the chunk
+    /**
+     * Value statistics of the chunk, if reported by the backend.
+     * Not considered by operator==().
+     */
+    std::optional<ChunkStatistics> statistics;
 
     explicit WrittenChunkInfo() = default;
     /*
@@ -84,7 +131,262 @@ using ChunkTable = std::vector<WrittenChunkInfo>;
 
 namespace chunk_assignment
 {
+    /**
+     * Meta information (e.g. hostnames) per rank, as returned by
+     * Series::rankTable() for writer ranks and by
+     * host_info::byMethodCollective() for reader ranks.
+     */
     using RankMeta = std::map<unsigned int, std::string>;
+
+    /**
+     * Result of a chunk distribution: the chunks to be loaded per reader
+     * rank.
+     */
+    using Assignment = std::map<unsigned int, ChunkTable>;
+
+    /**
+     * Intermediate result of a chunk distribution, used for chaining
+     * strategies: Some chunks have already been assigned to reader ranks,
+     * others are left for a later strategy to assign.
+     */
+    struct PartialAssignment
+    {
+        ChunkTable notAssigned;
+        Assignment assigned;
+
+        explicit PartialAssignment() = default;
+        PartialAssignment(ChunkTable notAssigned);
+        PartialAssignment(ChunkTable notAssigned, Assignment assigned);
+    };
+
+    /**
+     * @brief Interface for a strategy that distributes the chunks of a
+     *        dataset (as returned by availableChunks()) among reader ranks.
+     *
+     * A strategy must assign all chunks.
+     * The distribution is computed locally, i.e. without communication.
+     * In order to obtain a consistent result across reader ranks, each rank
+     * must call the strategy with the same input.
+     */
+    struct Strategy
+    {
+        /**
+         * @param table Chunks to distribute.
+         * @param rankMetaIn Meta information per writer rank, keys
+         *        correspond with WrittenChunkInfo::sourceID.
+         * @param rankMetaOut Meta information per reader rank. The keys of
+         *        this map are the reader ranks among which to distribute.
+         */
+        Assignment assign(
+            ChunkTable table,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut);
+
+        /**
+         * Complete a partial assignment, e.g. as returned by a
+         * PartialStrategy.
+         */
+        virtual Assignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) = 0;
+
+        virtual std::unique_ptr<Strategy> clone() const = 0;
+
+        virtual ~Strategy() = default;
+    };
+
+    /**
+     * @brief Interface for a strategy that distributes only those chunks of
+     *        a dataset that it sees fit to distribute, leaving others for
+     *        another strategy.
+     *
+     * Turn into a full Strategy by combining with a second strategy via
+     * FromPartialStrategy.
+     */
+    struct PartialStrategy
+    {
+        PartialAssignment assign(
+            ChunkTable table,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut);
+
+        virtual PartialAssignment assign(
+            PartialAssignment,
+            RankMeta const &rankMetaIn,
+            RankMeta const &rankMetaOut) = 0;
+
+        virtual std::unique_ptr<PartialStrategy> clone() const = 0;
+
+        virtual ~PartialStrategy() = default;
+    };
+
+    /**
+     * @brief Combine a PartialStrategy with a Strategy that distributes the
+     *        chunks left over by the first one.
+     */
+    struct FromPartialStrategy : Strategy
+    {
+        using Strategy::assign;
+
+        FromPartialStrategy(
+            std::unique_ptr<PartialStrategy> firstPass,
+            std::unique_ptr<Strategy> secondPass);
+
+        Assignment
+        assign(PartialAssignment, RankMeta const &in, RankMeta const &out)
+            override;
+
+        std::unique_ptr<Strategy> clone() const override;
+
+    private:
+        std::unique_ptr<PartialStrategy> m_firstPass;
+        std::unique_ptr<Strategy> m_secondPass;
+    };
+
+    /**
+     * @brief Simple strategy that assigns produced chunks to reading
+     *        ranks in a round-robin manner.
+     *
+     * Chunks are not split, so the resulting distribution is only balanced
+     * if the chunks are of similar size.
+     */
+    struct RoundRobin : Strategy
+    {
+        using Strategy::assign;
+
+        Assignment
+        assign(PartialAssignment, RankMeta const &in, RankMeta const &out)
+            override;
+
+        std::unique_ptr<Strategy> clone() const override;
+    };
+
+    /**
+     * @brief Strategy that balances the amount of data per reading rank.
+     *
+     * The ideal load per rank is the total number of elements divided by
+     * the number of reading ranks. Chunks larger than that are split along
+     * the dimension splitAlongDimension (or the dimension with largest
+     * extent if that is not specified), then chunks are assigned largest
+     * first to the rank with the currently lowest load.
+     * Since all chunks of a dataset share the datatype, balancing the
+     * element count balances the byte count.
+     */
+    struct BinPacking : Strategy
+    {
+        using Strategy::assign;
+
+        std::optional<size_t> splitAlongDimension;
+
+        BinPacking() = default;
+        BinPacking(size_t splitAlongDimension);
+
+        Assignment
+        assign(PartialAssignment, RankMeta const &in, RankMeta const &out)
+            override;
+
+        std::unique_ptr<Strategy> clone() const override;
+    };
+
+    /**
+     * @brief Strategy that matches chunks to reading ranks running on the
+     *        same host as the writing rank that produced them.
+     *
+     * Within each host, the chunks are distributed among the local reading
+     * ranks by the strategy withinNode.
+     * Chunks whose writing rank has no reading rank on the same host (or
+     * whose writing rank is missing in rankMetaIn) are left unassigned,
+     * combine with FromPartialStrategy to distribute them.
+     */
+    struct ByHostname : PartialStrategy
+    {
+        using PartialStrategy::assign;
+
+        ByHostname(std::unique_ptr<Strategy> withinNode);
+
+        PartialAssignment
+        assign(PartialAssignment, RankMeta const &in, RankMeta const &out)
+            override;
+
+        std::unique_ptr<PartialStrategy> clone() const override;
+
+    private:
+        std::unique_ptr<Strategy> m_withinNode;
+    };
+
+    /**
+     * @brief Interface for slicing a global dataset extent into one
+     *        hyperslab per reading rank.
+     */
+    struct BlockSlicer
+    {
+        /**
+         * @return The offset and extent of the hyperslab of rank among size
+         *         ranks within a dataset of extent totalExtent.
+         */
+        virtual std::pair<Offset, Extent>
+        sliceBlock(Extent const &totalExtent, int size, int rank) = 0;
+
+        virtual std::unique_ptr<BlockSlicer> clone() const = 0;
+
+        virtual ~BlockSlicer() = default;
+    };
+
+    /**
+     * @brief Slice a dataset into equally-sized slabs along one dimension.
+     *
+     * Unless specified, the dimension with the largest extent is used.
+     */
+    struct OneDimensionalBlockSlicer : BlockSlicer
+    {
+        std::optional<size_t> m_dim;
+
+        OneDimensionalBlockSlicer() = default;
+        OneDimensionalBlockSlicer(size_t dim);
+
+        std::pair<Offset, Extent>
+        sliceBlock(Extent const &totalExtent, int size, int rank) override;
+
+        std::unique_ptr<BlockSlicer> clone() const override;
+    };
+
+    /**
+     * @brief Strategy that assigns to each reading rank the hyperslab of the
+     *        global dataset returned by a BlockSlicer.
+     *
+     * Chunks crossing the boundaries between hyperslabs are split,
+     * i.e. every rank is assigned the intersections of all chunks with its
+     * own hyperslab.
+     * The global extent is taken as the bounding box of all chunks,
+     * reading ranks are enumerated in the order of the keys of rankMetaOut.
+     */
+    struct ByCuboidSlice : Strategy
+    {
+        using Strategy::assign;
+
+        ByCuboidSlice(std::unique_ptr<BlockSlicer> blockSlicer);
+
+        Assignment
+        assign(PartialAssignment, RankMeta const &in, RankMeta const &out)
+            override;
+
+        std::unique_ptr<Strategy> clone() const override;
+
+    private:
+        std::unique_ptr<BlockSlicer> m_blockSlicer;
+    };
+
+    /**
+     * @brief Intersect a chunk with a hyperslab.
+     *
+     * @return The intersection, or an empty optional if the intersection is
+     *         empty. The resulting chunk keeps the chunk's sourceID.
+     */
+    std::optional<WrittenChunkInfo> restrictToSelection(
+        WrittenChunkInfo const &chunk,
+        Offset const &offset,
+        Extent const &extent);
 } // namespace chunk_assignment
 
 namespace host_info
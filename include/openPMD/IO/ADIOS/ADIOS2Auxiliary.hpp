@@ -84,8 +84,24 @@ namespace adios_defaults
     constexpr const_str str_usesstepsAttribute = "__openPMD_internal/useSteps";
     constexpr const_str str_adios2Schema =
         "__openPMD_internal/openPMD2_adios2_schema";
+    /*
+     * Written if the writer left the per-block min/max statistics of
+     * ADIOS2 enabled (engine parameter StatsLevel). Readers only report
+     * ChunkStatistics for files carrying this attribute, since blocks
+     * written without statistics report zero for both.
+     */
+    constexpr const_str str_blockStatistics =
+        "__openPMD_internal/block_statistics";
     constexpr const_str str_isBoolean = "__is_boolean__";
     constexpr const_str str_activeTablePrefix = "__openPMD_groups";
+    constexpr const_str str_groupTableDeltas =
+        "__openPMD_internal/group_table_deltas";
+    /*
+     * Group table value of a group that is no longer present.
+     * Only written if the group table is written in delta mode
+     * (adios2.delta_metadata).
+     */
+    constexpr unsigned long long group_table_inactive = ~0ULL;
     constexpr const_str str_groupBasedWarning =
         "__openPMD_internal/warning_bugprone_groupbased_encoding";
 } // namespace adios_defaults
@@ -24,6 +24,7 @@
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/IOTask.hpp"
 #include "openPMD/IO/InvalidatableFile.hpp"
+#include "openPMD/auxiliary/PathTrie.hpp"
 #include "openPMD/config.hpp"
 
 #if openPMD_HAVE_ADIOS2
@@ -227,8 +228,6 @@ public:
     using ParsePreference = Parameter<Operation::OPEN_FILE>::ParsePreference;
     ParsePreference parsePreference = ParsePreference::UpFront;
 
-    using AttributeMap_t = std::map<std::string, adios2::Params>;
-
     ADIOS2File(ADIOS2IOHandlerImpl &impl, InvalidatableFile file);
 
     ~ADIOS2File();
@@ -320,8 +319,11 @@ public:
      */
     void drop();
 
-    AttributeMap_t const &availableAttributes();
+    auxiliary::PathTrie const &availableAttributes();
 
+    /*
+     * All attributes below the prefix, relative to it.
+     */
     std::vector<std::string>
     availableAttributesPrefixed(std::string const &prefix);
 
@@ -330,8 +332,11 @@ public:
      */
     void invalidateAttributesMap();
 
-    AttributeMap_t const &availableVariables();
+    auxiliary::PathTrie const &availableVariables();
 
+    /*
+     * All variables below the prefix, relative to it.
+     */
     std::vector<std::string>
     availableVariablesPrefixed(std::string const &prefix);
 
@@ -423,20 +428,36 @@ private:
     /*
      * ADIOS2 does not give direct access to its internal attribute and
      * variable maps, but will instead give access to copies of them.
-     * In order to avoid unnecessary copies, we buffer the returned map.
+     * In order to avoid unnecessary copies, we build an index over the
+     * names once per step and answer all hierarchy queries of the parser
+     * from it. Types and values are inquired from ADIOS2 on demand.
      * The downside of this is that we need to pay attention to invalidate
-     * the map whenever an attribute/variable is altered. In that case, we
-     * fetch the map anew.
-     * If empty, the buffered map has been invalidated and needs to be
-     * queried from ADIOS2 again. If full, the buffered map is equivalent to
-     * the map that would be returned by a call to
+     * the index whenever an attribute/variable is altered. In that case, we
+     * build it anew.
+     * If empty, the index has been invalidated and needs to be rebuilt from
      * IO::Available(Attributes|Variables).
      */
-    std::optional<AttributeMap_t> m_availableAttributes;
-    std::optional<AttributeMap_t> m_availableVariables;
+    std::optional<auxiliary::PathTrie> m_availableAttributes;
+    std::optional<auxiliary::PathTrie> m_availableVariables;
 
     std::set<Writable *> m_pathsMarkedAsActive;
 
+    /*
+     * Group table in delta mode (ADIOS2IOHandlerImpl::m_deltaMetadata):
+     * Entries are only written when a group appears or disappears instead
+     * of being rewritten in every step.
+     * m_groupTableActive contains the groups currently announced as present
+     * to readers, m_groupTableMarked those marked active in the current step.
+     */
+    std::set<std::string> m_groupTableActive;
+    std::set<std::string> m_groupTableMarked;
+
+    /*
+     * At the end of a step in delta mode, mark groups that were not active
+     * during the step as no longer present.
+     */
+    void commitGroupTableDeltas();
+
     /*
      * Cannot write attributes right after opening the engine
      * https://github.com/ornladios/ADIOS2/issues/3433
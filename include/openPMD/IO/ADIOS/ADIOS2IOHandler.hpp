@@ -188,6 +188,9 @@ public:
     void
     getBufferView(Writable *, Parameter<Operation::GET_BUFFER_VIEW> &) override;
 
+    void readDatasetView(
+        Writable *, Parameter<Operation::READ_DATASET_VIEW> &) override;
+
     void readAttribute(Writable *, Parameter<Operation::READ_ATT> &) override;
 
     void listPaths(Writable *, Parameter<Operation::LIST_PATHS> &) override;
@@ -281,6 +284,14 @@ private:
     ModifiableAttributes m_modifiableAttributes =
         ModifiableAttributes::Unspecified;
 
+    /*
+     * Emit per-step metadata only where it changed since the last step:
+     * modifiable attributes are not redefined with an unchanged value and
+     * group table entries are written only when a group appears or
+     * disappears.
+     */
+    bool m_deltaMetadata = false;
+
     inline UseGroupTable useGroupTable() const
     {
         if (!m_useGroupTable.has_value())
@@ -602,7 +613,8 @@ namespace detail
             adios2::IO &IO,
             adios2::Engine &engine,
             std::string const &varName,
-            bool allSteps);
+            bool allSteps,
+            bool withStatistics);
 
         template <int n, typename... Params>
         static void call(Params &&...);
@@ -30,12 +30,16 @@
 #include <mpi.h>
 #endif
 
+#include <atomic>
+#include <cstddef>
 #include <future>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace openPMD
 {
@@ -266,6 +270,16 @@ public:
     /** The currently used backend */
     virtual std::string backendName() const = 0;
 
+    /*
+     * Names of the files in the given directory, used for discovering the
+     * iterations of file-based Series.
+     * std::nullopt if the directory does not exist. The default lists the
+     * directory on the filesystem, backends that keep their files elsewhere
+     * override this.
+     */
+    virtual std::optional<std::vector<std::string>>
+    listDirectory(std::string const &directory) const;
+
     std::string directory;
     /*
      * Originally, the reason for distinguishing these two was that during
@@ -285,6 +299,45 @@ public:
     Access m_backendAccess;
     Access m_frontendAccess;
     internal::SeriesStatus m_seriesStatus = internal::SeriesStatus::Default;
+    /*
+     * Number of files that may be closed on background threads at the same
+     * time, see internal::ClosingFiles. Zero closes files synchronously.
+     * Set by the Series for backends that support it.
+     */
+    unsigned int m_filesInFlight = 0;
+#if openPMD_HAVE_MPI
+    /*
+     * If set, only rank 0 of this communicator reads metadata from the
+     * backend and broadcasts it, see internal::CollectiveMetadataFlush.
+     * Set by the Series for backends that support it.
+     */
+    std::optional<MPI_Comm> m_metadataCommunicator;
+#endif
+    /*
+     * Bytes of chunk payload passed to RecordComponent::storeChunk() that
+     * are still held by openPMD, i.e. not yet written to or copied by the
+     * backend. Shared with the deleters of the buffers since those may run
+     * after the IOHandler has been destroyed.
+     */
+    std::shared_ptr<std::atomic<std::size_t>> m_pendingWriteBytes =
+        std::make_shared<std::atomic<std::size_t>>(0);
+    /*
+     * Pending bytes that were left over after the last flush, e.g. chunks
+     * that the backend keeps until the end of the step.
+     */
+    std::size_t m_pendingWriteBytesAfterFlush = 0;
+    /*
+     * Series option write_buffer_budget: storeChunk() flushes the Series as
+     * soon as the pending bytes exceed those left over after the last flush
+     * by more than this. Zero disables it.
+     */
+    std::size_t m_writeBufferBudget = 0;
+    /*
+     * Whether storeChunk() handed out a span since the last flush. Spans
+     * are only valid until the next flush, so the write buffer budget does
+     * not trigger one as long as this is set.
+     */
+    bool m_spansSinceFlush = false;
     std::queue<IOTask> m_work;
     /**
      * This is to avoid that the destructor tries flushing again if an error
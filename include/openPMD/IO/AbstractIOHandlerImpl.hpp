@@ -22,10 +22,14 @@
 
 #include "openPMD/Error.hpp"
 #include "openPMD/IO/AbstractIOHandler.hpp"
+#include "openPMD/IO/CollectiveMetadata.hpp"
 #include "openPMD/IO/IOTask.hpp"
+#include "openPMD/auxiliary/BufferPool.hpp"
 #include "openPMD/auxiliary/DerefDynamicCast.hpp"
 
 #include <future>
+#include <utility>
+#include <vector>
 
 namespace openPMD
 {
@@ -312,6 +316,32 @@ public:
         // default implementation: operation unsupported by backend
         parameters.out->backendManagedBuffer = false;
     }
+    /** Get a read-only view into backend-managed memory that already holds
+     * the contents of a chunk of an existing dataset, i.e. read a chunk
+     * without copying it.
+     *
+     * The chunk is described by parameters.offset and parameters.extent,
+     * the requested datatype is parameters.dtype. If the backend can provide
+     * such a view, it should set parameters.out->backendManagedBuffer = true
+     * and parameters.out->ptr to the first element of the chunk in row-major
+     * order. If the memory must be released explicitly, the backend may hand
+     * its ownership to parameters.out->owner.
+     * Unless kept alive by parameters.out->owner, the memory should remain
+     * valid until the next Operation::ADVANCE task or until the file is
+     * closed.
+     *
+     * This IOTask is optional and should either (1) not be implemented by a
+     * backend at all or (2) be implemented as indicated above. Backends may
+     * decline on a per-call basis, e.g. if the selection is not contiguous
+     * in memory, by leaving parameters.out->backendManagedBuffer = false.
+     * The frontend will then fall back to a regular Operation::READ_DATASET.
+     */
+    virtual void readDatasetView(
+        Writable *, Parameter<Operation::READ_DATASET_VIEW> &parameters)
+    {
+        // default implementation: operation unsupported by backend
+        parameters.out->backendManagedBuffer = false;
+    }
     /** Create a single attribute and fill the value, possibly overwriting an
      * existing attribute.
      *
@@ -405,8 +435,36 @@ public:
     virtual void
     setWritten(Writable *, Parameter<Operation::SET_WRITTEN> const &param);
 
+    /** Hint that the file named by parameters.name will be opened soon.
+     *
+     * Backends may start reading the file in the background.
+     * The default implementation ignores the hint.
+     */
+    virtual void
+    prefetchFile(Writable *, Parameter<Operation::PREFETCH_FILE> const &param);
+
+    /*
+     * Support for span-based storeChunk() in backends that have no buffers
+     * of their own to lend: getPooledBufferView() serves GET_BUFFER_VIEW
+     * tasks from m_bufferPool, writePooledBufferViews() writes the views via
+     * writeDataset() and should be called by the backend at the next flush
+     * point. The buffers return to the pool after writing, so steady-state
+     * write loops do not allocate.
+     */
+    void
+    getPooledBufferView(Writable *, Parameter<Operation::GET_BUFFER_VIEW> &);
+    void writePooledBufferViews();
+    // drop pending views of a deregistered Writable
+    void forgetPooledBufferViews(Writable *);
+
     AbstractIOHandler *m_handler;
     bool m_verboseIOTasks = false;
+    auxiliary::BufferPool m_bufferPool;
+    std::vector<std::pair<Writable *, Parameter<Operation::WRITE_DATASET>>>
+        m_pooledBufferViews;
+#if openPMD_HAVE_MPI
+    internal::CollectiveMetadataCache m_collectiveMetadataCache;
+#endif
 
     // Args will be forwarded to std::cerr if m_verboseIOTasks is true
     template <typename... Args>
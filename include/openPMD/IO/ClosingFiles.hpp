@@ -0,0 +1,67 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <future>
+#include <string>
+#include <utility>
+
+namespace openPMD::internal
+{
+/*
+ * Files that are being closed on background threads, i.e. whose contents
+ * are being flushed to disk and whose handles are being released while the
+ * caller continues, see the Series option files_in_flight.
+ * Tasks are identified by the name of their file. A backend must await the
+ * task of a file before accessing that file again.
+ */
+class ClosingFiles
+{
+public:
+    ClosingFiles() = default;
+    ClosingFiles(ClosingFiles const &) = delete;
+    ClosingFiles &operator=(ClosingFiles const &) = delete;
+
+    // waits for all tasks, errors are printed since they cannot be thrown
+    ~ClosingFiles();
+
+    /*
+     * Run the task in the background. Waits for the oldest tasks first
+     * until fewer than maxInFlight are running, rethrowing their errors.
+     */
+    void close(
+        std::string name, std::function<void()> task, unsigned maxInFlight);
+
+    // wait for the tasks of the given file, rethrowing their errors
+    void await(std::string const &name);
+
+    // wait for all tasks, rethrowing the first error
+    void awaitAll();
+
+    // rethrow the errors of tasks that are done, without blocking
+    void reapFinished();
+
+private:
+    std::deque<std::pair<std::string, std::future<void>>> m_tasks;
+};
+} // namespace openPMD::internal
@@ -0,0 +1,145 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/config.hpp"
+
+#if openPMD_HAVE_MPI
+#include "openPMD/Datatype.hpp"
+#include "openPMD/Error.hpp"
+#include "openPMD/IO/IOTask.hpp"
+#include "openPMD/backend/Attribute.hpp"
+
+#include <mpi.h>
+
+#include <optional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace openPMD
+{
+class AbstractIOHandlerImpl;
+class Writable;
+
+namespace internal
+{
+    /*
+     * An exception raised on rank 0, in a form that can be sent to the other
+     * ranks and thrown again there.
+     */
+    struct RecordedError
+    {
+        enum class Kind : unsigned char
+        {
+            ReadError,
+            OperationUnsupportedInBackend,
+            NoSuchAttribute,
+            Other
+        };
+        Kind kind = Kind::Other;
+        std::string what;
+        // only for ReadError and OperationUnsupportedInBackend
+        error::AffectedObject affectedObject = error::AffectedObject::Other;
+        error::Reason reason = error::Reason::Other;
+        std::optional<std::string> backend;
+        std::string description;
+
+        // must be called from within a catch block
+        static RecordedError fromCurrentException();
+        [[noreturn]] void rethrow() const;
+    };
+
+    /*
+     * Result of reading an attribute on rank 0, the value or the error.
+     */
+    struct CachedAttribute
+    {
+        Datatype dtype = Datatype::UNDEFINED;
+        Attribute::resource value;
+        std::optional<RecordedError> error;
+    };
+
+    /*
+     * Attributes that rank 0 read along with a LIST_ATTS task. Subsequent
+     * READ_ATT tasks for them are served from here without communication.
+     * Identical on all ranks.
+     */
+    using CollectiveMetadataCache = std::unordered_map<
+        Writable *,
+        std::unordered_map<std::string, CachedAttribute>>;
+
+    /**
+     * Collective metadata parsing for one flush of an IO queue.
+     *
+     * Only rank 0 of the communicator runs LIST_PATHS, LIST_DATASETS,
+     * LIST_ATTS and READ_ATT tasks in the backend. It collects their results
+     * and broadcasts them to the other ranks in one message at the end of
+     * the flush, the other ranks skip these tasks and fill in the results
+     * from the message. When listing the attributes of an object, rank 0
+     * also reads their values, so parsing an object costs one broadcast.
+     *
+     * All ranks must flush the same metadata tasks in the same order, which
+     * holds for parsing a Series or an Iteration collectively.
+     */
+    class CollectiveMetadataFlush
+    {
+    public:
+        CollectiveMetadataFlush(
+            AbstractIOHandlerImpl &,
+            CollectiveMetadataCache &,
+            MPI_Comm,
+            std::queue<IOTask> const &work);
+
+        /*
+         * Call before running a task in the backend.
+         * Returns true if the task has been dealt with and must not run.
+         */
+        bool intercept(IOTask &);
+        /*
+         * Call after successfully running a task in the backend.
+         */
+        void record(IOTask &);
+        /*
+         * Call once after the last task or upon failure of a task.
+         * Broadcasts the results if the flush contained metadata tasks.
+         * If rank 0 failed, the other ranks throw the same error, unless
+         * failedLocally is set.
+         */
+        void exchange(bool failedLocally);
+
+    private:
+        AbstractIOHandlerImpl &m_impl;
+        CollectiveMetadataCache &m_cache;
+        MPI_Comm m_comm;
+        bool m_isRoot = false;
+        bool m_needsExchange = false;
+        // READ_ATT tasks served from the cache, looked up ahead of the flush
+        std::unordered_map<AbstractParameter *, CachedAttribute> m_cached;
+        // rank 0 only: serialized results of the tasks in m_deferred
+        std::vector<char> m_results;
+        // metadata tasks in queue order, run on rank 0 and skipped elsewhere
+        std::vector<IOTask> m_deferred;
+    };
+} // namespace internal
+} // namespace openPMD
+#endif
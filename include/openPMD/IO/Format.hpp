@@ -36,6 +36,8 @@ enum class Format
     ADIOS2_SSC,
     JSON,
     TOML,
+    SHM,
+    MEMORY,
     GENERIC,
     DUMMY
 };
@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include "openPMD/ChunkInfo.hpp"
 #include "openPMD/backend/Attribute.hpp"
 #include "openPMD/backend/Writable.hpp"
 #include "openPMD/config.hpp"
@@ -27,6 +28,7 @@
 #include <hdf5.h>
 
 #include <map>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -46,7 +48,13 @@ struct GetH5DataType
 
 hid_t getH5DataSpace(Attribute const &att);
 
-std::string concrete_h5_file_position(Writable *w);
+/** Resolve the absolute path of a Writable within its HDF5 file.
+ *
+ * The result is cached within the Writable and only recomputed if the file
+ * positions along its parent chain change.
+ * The returned reference is valid until the next call for the same Writable.
+ */
+std::string const &concrete_h5_file_position(Writable *w);
 
 /** Computes the chunk dimensions for a dataset.
  *
@@ -63,4 +71,66 @@ std::string concrete_h5_file_position(Writable *w);
  */
 std::vector<hsize_t>
 getOptimalChunkDims(std::vector<hsize_t> const &dims, size_t const typeSize);
+
+/** Computes how chunks must be aligned to a block decomposition.
+ *
+ * @param[in] blocks blocks written by one or more writers
+ * @param[in] ndims dimensionality of the dataset
+ * @return for each dimension, the greatest common divisor of all block
+ *         offsets and extents, i.e. the largest chunk extent whose chunk
+ *         boundaries do not cut through any block. 0 if unconstrained.
+ *         Alignments of different writers can be merged by computing their
+ *         greatest common divisor once more.
+ */
+std::vector<hsize_t>
+getDecompositionAlignment(std::vector<ChunkInfo> const &blocks, size_t ndims);
+
+/** Computes chunk dimensions that follow the block decomposition of writers.
+ *
+ * Chunks start out as large as the alignment permits and are then reduced
+ * by divisors of their extent until they fit into the target size window,
+ * so that chunk boundaries stay aligned with block boundaries. Dimensions
+ * without alignment constraint may additionally grow up to the dataset
+ * extent. If the decomposition does not permit aligned chunks of at least
+ * minBytes, e.g. for uneven blocks, the constraint is dropped along the
+ * most finely aligned dimensions, falling back to getOptimalChunkDims()
+ * if none remains.
+ *
+ * @param[in] dims dimensions of dataset to get chunk dims for
+ * @param[in] typeSize size of each element in bytes
+ * @param[in] alignment see getDecompositionAlignment()
+ * @param[in] minBytes lower end of the target chunk size window
+ * @param[in] maxBytes upper end of the target chunk size window
+ * @param[in] sliceAxis if readers will mostly load slices at a fixed
+ *            index along this axis, chunks will have extent 1 along it
+ * @return array for resulting chunk dimensions
+ */
+std::vector<hsize_t> getDecompositionAwareChunkDims(
+    std::vector<hsize_t> const &dims,
+    size_t typeSize,
+    std::vector<hsize_t> const &alignment,
+    size_t minBytes,
+    size_t maxBytes,
+    std::optional<size_t> sliceAxis);
+
+/** Computes the size of the raw data chunk cache for a chunked dataset.
+ *
+ * The cache is sized to hold one layer of chunks across all but the slowest
+ * varying dimension, so that reading the dataset slice by slice along that
+ * dimension decompresses each chunk only once. The size is clamped to
+ * [chunk size, maxBytes] and never drops below the HDF5 default of 1 MiB.
+ *
+ * @param[in] dims dimensions of the dataset
+ * @param[in] chunkDims chunk dimensions of the dataset
+ * @param[in] typeSize size of each element in bytes
+ * @param[in] maxBytes upper limit for the cache size
+ * @return cache size in bytes and number of hash table slots (a prime
+ *         number of roughly 100 times the number of chunks fitting into
+ *         the cache, as recommended by H5Pset_chunk_cache)
+ */
+std::pair<size_t, size_t> getChunkCacheSize(
+    std::vector<hsize_t> const &dims,
+    std::vector<hsize_t> const &chunkDims,
+    size_t typeSize,
+    size_t maxBytes);
 } // namespace openPMD
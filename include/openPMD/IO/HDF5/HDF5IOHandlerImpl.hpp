@@ -24,13 +24,18 @@
 #include "openPMD/config.hpp"
 #if openPMD_HAVE_HDF5
 #include "openPMD/IO/AbstractIOHandlerImpl.hpp"
+#include "openPMD/IO/ClosingFiles.hpp"
 
 #include "openPMD/auxiliary/JSON_internal.hpp"
 
 #include <hdf5.h>
+#include <cstdint>
+#include <map>
 #include <optional>
+#include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #endif
 
 namespace openPMD
@@ -62,6 +67,9 @@ public:
     void openFile(Writable *, Parameter<Operation::OPEN_FILE> &) override;
     void
     closeFile(Writable *, Parameter<Operation::CLOSE_FILE> const &) override;
+    void advance(Writable *, Parameter<Operation::ADVANCE> &) override;
+    void
+    closePath(Writable *, Parameter<Operation::CLOSE_PATH> const &) override;
     void openPath(Writable *, Parameter<Operation::OPEN_PATH> const &) override;
     void openDataset(Writable *, Parameter<Operation::OPEN_DATASET> &) override;
     void
@@ -77,6 +85,10 @@ public:
     void writeAttribute(
         Writable *, Parameter<Operation::WRITE_ATT> const &) override;
     void readDataset(Writable *, Parameter<Operation::READ_DATASET> &) override;
+    void readDatasetView(
+        Writable *, Parameter<Operation::READ_DATASET_VIEW> &) override;
+    void
+    getBufferView(Writable *, Parameter<Operation::GET_BUFFER_VIEW> &) override;
     void readAttribute(Writable *, Parameter<Operation::READ_ATT> &) override;
     void listPaths(Writable *, Parameter<Operation::LIST_PATHS> &) override;
     void
@@ -91,11 +103,24 @@ public:
 
     std::unordered_set<hid_t> m_openFileIDs;
 
+    /*
+     * Files closed in the background, see the files_in_flight option.
+     * Only used if the HDF5 library was built thread-safe.
+     */
+    internal::ClosingFiles m_closingFiles;
+    bool m_threadsafeLibrary = false;
+
     hid_t m_datasetTransferProperty;
     hid_t m_fileAccessProperty;
     hid_t m_fileCreateProperty;
 
     hbool_t m_hdf5_collective_metadata = 1;
+    /*
+     * Under the Series option "collective_metadata", rank 0 alone lists
+     * objects and reads attributes. Collective metadata ops stay enabled for
+     * the file, but are disabled on the access properties of these reads.
+     */
+    bool rankZeroMetadataReads() const;
 
     // h5py compatible types for bool and complex
     hid_t m_H5T_BOOL_ENUM;
@@ -128,6 +153,24 @@ protected:
     nlohmann::json m_global_dataset_config;
     nlohmann::json m_global_flush_config;
 
+    /*
+     * Page buffering as configured via hdf5.page_buffer, requires files to
+     * be created with paged file space allocation.
+     */
+    struct PageBufferConfig
+    {
+        size_t bytes = 0;
+        size_t pageSize = 4096;
+        unsigned minMetaPercent = 0;
+        unsigned minRawPercent = 0;
+    };
+    std::optional<PageBufferConfig> m_pageBuffer;
+    hid_t m_pagedFileAccessProperty = H5P_DEFAULT;
+    hid_t m_pagedFileCreateProperty = H5P_DEFAULT;
+
+    // write the attributes collected by writeAttribute() so far
+    void flushAttributes();
+
 private:
     struct File
     {
@@ -135,6 +178,112 @@ private:
         hid_t id;
     };
     std::optional<File> getFile(Writable *);
+    hid_t openH5File(std::string const &name, unsigned flags);
+
+    /*
+     * Raw data chunk cache as configured via hdf5.dataset.chunk_cache.
+     * Unset sizes are derived from the chunk dimensions of each dataset,
+     * see getChunkCacheSize().
+     */
+    struct ChunkCacheConfig
+    {
+        std::optional<size_t> bytes;
+        std::optional<size_t> slots;
+        double preemption = 0.75;
+        size_t maxBytes = 64 * 1024 * 1024;
+        // budget for the caches of all open dataset handles together
+        size_t totalMaxBytes = 256 * 1024 * 1024;
+    };
+    static std::optional<ChunkCacheConfig>
+    parseChunkCacheConfig(nlohmann::json const &config);
+    void setupChunkCache(
+        Writable *,
+        ChunkCacheConfig const &,
+        std::vector<hsize_t> const &dims,
+        std::vector<hsize_t> const &chunkDims,
+        size_t typeSize);
+
+    // Series-wide default for datasets opened for reading
+    std::optional<ChunkCacheConfig> m_chunkCache;
+    // dataset access properties of datasets with a configured chunk cache
+    struct DatasetAccess
+    {
+        hid_t dapl;
+        size_t cacheBytes;
+    };
+    std::unordered_map<Writable *, DatasetAccess> m_datasetAccessProperties;
+    /*
+     * Since HDF5 drops the chunk cache along with the dataset handle,
+     * handles of datasets with a configured chunk cache are kept open
+     * until their file is closed, or until their caches together exceed
+     * the budget, in which case the least recently used ones are closed.
+     */
+    struct OpenDataset
+    {
+        hid_t id;
+        size_t cacheBytes;
+        uint64_t lastUse;
+    };
+    std::unordered_map<Writable *, OpenDataset> m_openDatasets;
+    size_t m_openDatasetsCacheBytes = 0;
+    uint64_t m_datasetUseCounter = 0;
+    hid_t openDatasetHandle(File const &, Writable *);
+    void releaseDatasetHandle(Writable *, hid_t dataset_id);
+    // those of the given file, or all of them
+    void closeDatasetHandles(std::optional<std::string> const &fileName);
+    void forgetDatasetHandle(Writable *);
+
+    /*
+     * Joined arrays (Dataset::JOINED_DIMENSION) are created with an
+     * unlimited joined dimension of extent zero. Writes to them are buffered
+     * (copying buffers that the frontend still shares with the user)
+     * until the next collective point, i.e. the end of an IO step or the
+     * closing of a file, where the offsets of all joined arrays are computed
+     * at once before extending the datasets and writing.
+     * Flushes are not collective points, so they need not be collective.
+     */
+    struct JoinedDataset
+    {
+        Writable *writable;
+        size_t joinedDimension;
+        std::vector<Parameter<Operation::WRITE_DATASET>> pendingWrites;
+    };
+    // in order of creation, i.e. identical across MPI ranks
+    std::vector<JoinedDataset> m_joinedDatasets;
+    void flushJoinedDatasets();
+
+    /*
+     * Attribute writes are collected during a flush and written at its end,
+     * or before a task that depends on them, opening each object once.
+     * Keyed by file name and object path, so the order of the (collective)
+     * writes is identical across MPI ranks.
+     */
+    using AttributeLocation = std::pair<std::string, std::string>;
+    struct PendingAttributes
+    {
+        hid_t fileID;
+        std::map<std::string, Parameter<Operation::WRITE_ATT>> attributes;
+    };
+    std::map<AttributeLocation, PendingAttributes> m_pendingAttributes;
+    /*
+     * Last value written per attribute, rewriting an identical value is
+     * skipped. Dropped for objects that receive no attribute writes during a
+     * user flush that writes attributes (e.g. those of closed Iterations),
+     * for a group when it is closed at the end of an IO step, for a file when
+     * it is closed or when anything in it is deleted.
+     */
+    std::map<
+        AttributeLocation,
+        std::map<std::string, std::pair<Datatype, Attribute::resource>>>
+        m_writtenAttributes;
+    // objects with attribute writes since the last user flush
+    std::set<AttributeLocation> m_attributesInFlush;
+    void writeAttributeValue(
+        hid_t node_id,
+        std::string const &path,
+        Parameter<Operation::WRITE_ATT> const &);
+    void forgetWrittenAttributes(
+        std::string const &fileName, std::string const &groupPath = "/");
 }; // HDF5IOHandlerImpl
 #else
 class HDF5IOHandlerImpl
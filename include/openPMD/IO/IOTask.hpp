@@ -24,6 +24,7 @@
 #include "openPMD/Dataset.hpp"
 #include "openPMD/IterationEncoding.hpp"
 #include "openPMD/Streaming.hpp"
+#include "openPMD/auxiliary/Codec.hpp"
 #include "openPMD/auxiliary/Export.hpp"
 #include "openPMD/auxiliary/Memory.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
@@ -33,6 +34,7 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
@@ -43,6 +45,11 @@ namespace openPMD
 class Attributable;
 class Writable;
 
+namespace json
+{
+    struct ParsedConfig;
+}
+
 Writable *getWritable(Attributable *);
 
 /** Type of IO operation between logical and persistent data.
@@ -78,7 +85,9 @@ OPENPMDAPI_EXPORT_ENUM_CLASS(Operation){
     AVAILABLE_CHUNKS, //!< Query chunks that can be loaded in a dataset
     DEREGISTER, //!< Inform the backend that an object has been deleted.
     TOUCH, //!< tell the backend that the file is to be considered active
-    SET_WRITTEN //!< tell backend to consider a file written / not written
+    SET_WRITTEN, //!< tell backend to consider a file written / not written
+    PREFETCH_FILE, //!< hint that a file will soon be opened for reading
+    READ_DATASET_VIEW //!< map a dataset for reading without a copy
 }; // note: if you change the enum members here, please update
    // docs/source/dev/design.rst
 
@@ -344,6 +353,31 @@ struct OPENPMDAPI_EXPORT Parameter<Operation::CREATE_DATASET>
     Datatype dtype = Datatype::UNDEFINED;
     std::string options = "{}";
     std::optional<size_t> joinedDimension;
+    /*
+     * Chunks that this process is going to write right after creating the
+     * dataset (might be empty). Backends may use this for choosing a storage
+     * layout that matches the decomposition of the data among writers.
+     */
+    std::vector<ChunkInfo> initialChunks;
+    /*
+     * Parsed form of `options`, shared between all datasets with identical
+     * options. Optional, use getParsedOptions() for reading.
+     */
+    std::shared_ptr<json::ParsedConfig const> parsedOptions;
+
+    /** Get `options` in parsed form.
+     *
+     * Returns `parsedOptions` if set by the frontend, otherwise looks up
+     * `options` in the cache of json::parseOptionsCached().
+     */
+    std::shared_ptr<json::ParsedConfig const> getParsedOptions() const;
+
+    /** Get the codec requested by the backend-independent option "codec".
+     *
+     * Empty if no codec, "none" or an unresolved "auto" was requested.
+     * Throws error::BackendConfigSchema for unknown codecs.
+     */
+    std::optional<auxiliary::Codec> getCodec() const;
 
     /** Warn about unused JSON paramters
      *
@@ -513,6 +547,40 @@ struct OPENPMDAPI_EXPORT Parameter<Operation::GET_BUFFER_VIEW>
     std::shared_ptr<OutParameters> out = std::make_shared<OutParameters>();
 };
 
+template <>
+struct OPENPMDAPI_EXPORT Parameter<Operation::READ_DATASET_VIEW>
+    : public AbstractParameter
+{
+    Parameter() = default;
+    Parameter(Parameter &&) = default;
+    Parameter(Parameter const &) = default;
+    Parameter &operator=(Parameter &&) = default;
+    Parameter &operator=(Parameter const &) = default;
+
+    std::unique_ptr<AbstractParameter> to_heap() && override
+    {
+        return std::unique_ptr<AbstractParameter>(
+            new Parameter<Operation::READ_DATASET_VIEW>(std::move(*this)));
+    }
+
+    // in parameters
+    Offset offset;
+    Extent extent;
+    Datatype dtype = Datatype::UNDEFINED;
+    // out parameters
+    struct OutParameters
+    {
+        bool backendManagedBuffer = false;
+        void const *ptr = nullptr;
+        /*
+         * Optional, keeps the memory behind ptr alive (e.g. a memory
+         * mapping) for as long as the frontend holds the view.
+         */
+        std::shared_ptr<void const> owner;
+    };
+    std::shared_ptr<OutParameters> out = std::make_shared<OutParameters>();
+};
+
 template <>
 struct OPENPMDAPI_EXPORT Parameter<Operation::DELETE_ATT>
     : public AbstractParameter
@@ -648,6 +716,12 @@ struct OPENPMDAPI_EXPORT Parameter<Operation::AVAILABLE_CHUNKS>
             new Parameter<Operation::AVAILABLE_CHUNKS>(std::move(*this)));
     }
 
+    /*
+     * Whether the caller needs ChunkStatistics. Backends that read them
+     * from metadata report them anyway, backends that would have to compute
+     * them from the data (JSON) only if this is set.
+     */
+    bool withStatistics = false;
     // output parameter
     std::shared_ptr<ChunkTable> chunks = std::make_shared<ChunkTable>();
 };
@@ -713,6 +787,34 @@ struct OPENPMDAPI_EXPORT Parameter<Operation::SET_WRITTEN>
     bool target_status = false;
 };
 
+/** @brief Hint to the backend that a file will be opened for reading soon.
+ *
+ * Backends may use this to start loading the file in the background, e.g.
+ * while the user is still processing the previous iteration of a file-based
+ * Series. This operation is purely advisory: Backends without support for it
+ * ignore it, and failures must not be reported before the file is actually
+ * opened.
+ */
+template <>
+struct OPENPMDAPI_EXPORT Parameter<Operation::PREFETCH_FILE>
+    : public AbstractParameter
+{
+    Parameter() = default;
+    Parameter(Parameter &&) = default;
+    Parameter(Parameter const &) = default;
+    Parameter &operator=(Parameter &&) = default;
+    Parameter &operator=(Parameter const &) = default;
+
+    std::unique_ptr<AbstractParameter> to_heap() && override
+    {
+        return std::make_unique<Parameter<Operation::PREFETCH_FILE>>(
+            std::move(*this));
+    }
+
+    //! same convention as Parameter<Operation::OPEN_FILE>::name
+    std::string name = "";
+};
+
 /** @brief Self-contained description of a single IO operation.
  *
  * Contained are
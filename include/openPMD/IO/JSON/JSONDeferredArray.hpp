@@ -0,0 +1,88 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/Dataset.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openPMD::json
+{
+/*
+ * Stand-in for the "data" array of a dataset in a JSON file that was opened
+ * read-only. Instead of the array, only its location in the file is kept,
+ * its contents are parsed when reading from the dataset.
+ * Inside the JSON value, the stand-in is stored as a binary value, which
+ * cannot occur in JSON text otherwise.
+ */
+struct DeferredArray
+{
+    /*
+     * A run of consecutive elements of the outermost array.
+     */
+    struct Block
+    {
+        // index of the first element in the block
+        uint64_t firstElement = 0;
+        // byte position in the file, somewhere between the previous element
+        // and the first element of the block
+        uint64_t begin = 0;
+    };
+
+    // byte position of the closing bracket in the file
+    uint64_t end = 0;
+    // number of elements in the outermost array
+    uint64_t length = 0;
+    // extents of the nested arrays, along the first element in each dimension
+    Extent shape;
+    // at least one, ordered by position
+    std::vector<Block> blocks;
+    // whether any element is null, i.e. unwritten or a non-finite float;
+    // if not, the whole array is a single written chunk
+    bool hasNull = false;
+
+    static bool isDeferred(nlohmann::json const &);
+    static DeferredArray fromJson(nlohmann::json const &);
+    nlohmann::json toJson() const;
+
+    /*
+     * Read elements [first, first + count) of the outermost array from the
+     * file at the given path, as a JSON array.
+     * Large selections are parsed in parallel threads.
+     */
+    nlohmann::json
+    load(std::string const &path, uint64_t first, uint64_t count) const;
+};
+
+/*
+ * Parse a JSON document in a streaming fashion, without building the "data"
+ * arrays of datasets. They are replaced by DeferredArray stand-ins that refer
+ * to the byte positions in the stream, so the stream must start at the
+ * beginning of the file that DeferredArray::load() reads from later.
+ */
+std::shared_ptr<nlohmann::json> parseDeferringData(std::istream &);
+} // namespace openPMD::json
@@ -24,6 +24,8 @@
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/AbstractIOHandlerImpl.hpp"
 #include "openPMD/IO/Access.hpp"
+#include "openPMD/IO/ClosingFiles.hpp"
+#include "openPMD/IO/JSON/JSONDeferredArray.hpp"
 #include "openPMD/IO/JSON/JSONFilePosition.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/JSON_internal.hpp"
@@ -37,6 +39,7 @@
 
 #include <complex>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <tuple>
@@ -240,8 +243,14 @@ public:
     void
     deregister(Writable *, Parameter<Operation::DEREGISTER> const &) override;
 
+    void
+    getBufferView(Writable *, Parameter<Operation::GET_BUFFER_VIEW> &) override;
+
     void touch(Writable *, Parameter<Operation::TOUCH> const &) override;
 
+    void prefetchFile(
+        Writable *, Parameter<Operation::PREFETCH_FILE> const &) override;
+
     std::future<void> flush();
 
 private:
@@ -257,9 +266,23 @@ private:
 
     std::unordered_map<File, std::shared_ptr<nlohmann::json>> m_jsonVals;
 
+    // files that are being read in the background after a PREFETCH_FILE task
+    // keys are filenames without the OS path, consumed by obtainJsonContents
+    std::unordered_map<
+        std::string,
+        std::future<std::shared_ptr<nlohmann::json>>>
+        m_prefetchedFiles;
+
+    // files that are being written in the background after a CLOSE_FILE
+    // task, keys are filenames without the OS path
+    internal::ClosingFiles m_closingFiles;
+
     // files that have logically, but not physically been written to
     std::unordered_set<File> m_dirty;
 
+    // joined dimensions of joined arrays, writes to them append at the end
+    std::unordered_map<Writable *, size_t> m_joinedDimensions;
+
     /*
      * Is set by constructor.
      */
@@ -333,6 +356,33 @@ private:
     std::tuple<File, std::unordered_map<Writable *, File>::iterator, bool>
     getPossiblyExisting(std::string const &file);
 
+    // parse a whole JSON/TOML file from the stream, the filename is only used
+    // for error messages
+    // if deferData is true, the contents of datasets are not parsed, see
+    // openPMD::json::DeferredArray
+    static std::shared_ptr<nlohmann::json> parseFileContents(
+        std::istream &,
+        FileFormat,
+        std::string const &filename,
+        bool deferData);
+
+    // write a whole JSON value to the stream in the given format,
+    // datasets with a codec are encoded in place and restored afterwards
+    static void
+    writeFileContents(std::ostream &, nlohmann::json &, FileFormat);
+
+    // read-only JSON files are parsed without the contents of datasets,
+    // which are read from the file upon READ_DATASET
+    bool deferDatasetContents() const;
+
+    // parse elements [first, first + count) of the outermost array of a
+    // deferred "data" value from the file
+    nlohmann::json loadDeferredRows(
+        File const &,
+        nlohmann::json const &data,
+        uint64_t first,
+        uint64_t count);
+
     // get the json value representing the whole file, possibly reading
     // from disk
     std::shared_ptr<nlohmann::json> obtainJsonContents(File const &);
@@ -0,0 +1,179 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/IO/AbstractIOHandlerImplCommon.hpp"
+#include "openPMD/IO/Memory/MemoryHierarchy.hpp"
+#include "openPMD/ThrowError.hpp"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace openPMD
+{
+namespace memory
+{
+    /*
+     * A modification of the hierarchy, as reported to
+     * HierarchyIOHandlerImpl::recordChange().
+     */
+    struct Change
+    {
+        enum class Type : unsigned char
+        {
+            Path,
+            Attribute,
+            Dataset,
+            DeletePath,
+            DeleteAttribute
+        };
+        Type type;
+        // absolute path of the group or dataset
+        std::string path;
+        // attribute name, empty for other types
+        std::string name;
+    };
+} // namespace memory
+
+/*
+ * Common implementation of all IO tasks for backends that hold the openPMD
+ * hierarchy as a tree of memory::Node objects, one tree per file.
+ * File handling and IO steps are up to the concrete backends, they may hook
+ * into writing via allocateChunk() and recordChange().
+ */
+class HierarchyIOHandlerImpl
+    : public AbstractIOHandlerImplCommon<memory::FilePosition>
+{
+public:
+    explicit HierarchyIOHandlerImpl(AbstractIOHandler *);
+
+    ~HierarchyIOHandlerImpl() override;
+
+    void createPath(
+        Writable *, Parameter<Operation::CREATE_PATH> const &) override;
+
+    void createDataset(
+        Writable *, Parameter<Operation::CREATE_DATASET> const &) override;
+
+    void extendDataset(
+        Writable *, Parameter<Operation::EXTEND_DATASET> const &) override;
+
+    void availableChunks(
+        Writable *, Parameter<Operation::AVAILABLE_CHUNKS> &) override;
+
+    void
+    openPath(Writable *, Parameter<Operation::OPEN_PATH> const &) override;
+
+    void
+    openDataset(Writable *, Parameter<Operation::OPEN_DATASET> &) override;
+
+    void deletePath(
+        Writable *, Parameter<Operation::DELETE_PATH> const &) override;
+
+    void deleteDataset(
+        Writable *, Parameter<Operation::DELETE_DATASET> const &) override;
+
+    void deleteAttribute(
+        Writable *, Parameter<Operation::DELETE_ATT> const &) override;
+
+    void
+    writeDataset(Writable *, Parameter<Operation::WRITE_DATASET> &) override;
+
+    void writeAttribute(
+        Writable *, Parameter<Operation::WRITE_ATT> const &) override;
+
+    void getBufferView(
+        Writable *, Parameter<Operation::GET_BUFFER_VIEW> &) override;
+
+    void
+    readDataset(Writable *, Parameter<Operation::READ_DATASET> &) override;
+
+    void readDatasetView(
+        Writable *, Parameter<Operation::READ_DATASET_VIEW> &) override;
+
+    void
+    readAttribute(Writable *, Parameter<Operation::READ_ATT> &) override;
+
+    void listPaths(Writable *, Parameter<Operation::LIST_PATHS> &) override;
+
+    void
+    listDatasets(Writable *, Parameter<Operation::LIST_DATASETS> &) override;
+
+    void listAttributes(Writable *, Parameter<Operation::LIST_ATTS> &) override;
+
+    void
+    deregister(Writable *, Parameter<Operation::DEREGISTER> const &) override;
+
+    void touch(Writable *, Parameter<Operation::TOUCH> const &) override;
+
+protected:
+    // root of the hierarchy for each open file
+    std::unordered_map<InvalidatableFile, std::shared_ptr<memory::Node>>
+        m_roots;
+
+    /*
+     * Storage for a chunk of the given file, to be filled by the caller.
+     * The default allocates from the heap.
+     */
+    virtual std::shared_ptr<void>
+    allocateChunk(InvalidatableFile const &, size_t bytes);
+
+    /*
+     * Called after each modification of the hierarchy by the frontend.
+     * Default: no-op.
+     */
+    virtual void recordChange(InvalidatableFile const &, memory::Change);
+
+    /*
+     * If false, attributes that change over IO steps are not written, see
+     * Parameter<Operation::WRITE_ATT>::changesOverSteps.
+     */
+    virtual bool supportsSteps() const;
+
+    /*
+     * If true, buffers that the frontend hands over to the backend
+     * (std::unique_ptr) are kept as chunks instead of being copied into
+     * storage from allocateChunk().
+     * Default: false.
+     */
+    virtual bool adoptsWriteBuffers() const;
+
+    /*
+     * The node that the writable's file position points to.
+     * If `create` is true, missing groups along the path are created,
+     * otherwise a missing node is a read error.
+     */
+    std::shared_ptr<memory::Node>
+    resolveNode(Writable *, bool create, error::AffectedObject);
+
+    memory::Dataset &resolveDataset(Writable *);
+
+    std::string
+        filePositionToString(std::shared_ptr<memory::FilePosition>) override;
+
+    std::shared_ptr<memory::FilePosition> extendFilePosition(
+        std::shared_ptr<memory::FilePosition> const &, std::string) override;
+
+private:
+    std::shared_ptr<memory::Node> &rootOf(InvalidatableFile const &);
+}; // HierarchyIOHandlerImpl
+} // namespace openPMD
@@ -0,0 +1,142 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/ChunkInfo.hpp"
+#include "openPMD/Dataset.hpp"
+#include "openPMD/Datatype.hpp"
+#include "openPMD/IO/AbstractFilePosition.hpp"
+#include "openPMD/backend/Attribute.hpp"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace openPMD
+{
+/*
+ * In-memory representation of an openPMD hierarchy (groups, datasets and
+ * attributes), used by backends that keep their data in (shared) memory.
+ */
+namespace memory
+{
+    /** A contiguous chunk of a dataset, stored in row-major order.
+     */
+    struct Chunk
+    {
+        Offset offset;
+        Extent extent;
+        /*
+         * Null for empty chunks. May point into memory owned by something
+         * else, e.g. a shared memory segment (aliasing constructor of
+         * std::shared_ptr).
+         */
+        std::shared_ptr<void const> data;
+    };
+
+    struct Dataset
+    {
+        Datatype dtype = Datatype::UNDEFINED;
+        Extent extent;
+        /*
+         * In order of writing. Where chunks overlap, later chunks take
+         * precedence over earlier ones.
+         */
+        std::vector<Chunk> chunks;
+
+        /*
+         * Add a chunk. A chunk that covers exactly the same region as a
+         * previous one replaces the previous one.
+         */
+        void storeChunk(Chunk);
+
+        /*
+         * Copy the selection into the row-major buffer `into`.
+         * Regions that no chunk covers are filled with zeros.
+         */
+        void loadChunk(Offset const &, Extent const &, void *into) const;
+
+        /*
+         * If the selection lies in a single chunk and is contiguous in
+         * memory there, return a pointer to its first element that shares
+         * ownership with the chunk. Otherwise, return null.
+         */
+        std::shared_ptr<void const>
+        viewChunk(Offset const &, Extent const &) const;
+
+        ChunkTable chunkTable() const;
+
+        /*
+         * Throw if the selection does not fit into the dataset's extent or
+         * if the datatype does not match.
+         */
+        void verifySelection(
+            Offset const &,
+            Extent const &,
+            Datatype,
+            std::string const &backendName) const;
+    };
+
+    struct Node
+    {
+        std::map<std::string, Attribute> attributes;
+        std::map<std::string, std::shared_ptr<Node>> children;
+        // If set, this node is a dataset, otherwise a group
+        std::optional<Dataset> dataset;
+    };
+
+    /*
+     * Paths are absolute, i.e. relative to the given root, and start with a
+     * slash. Each path segment names one child.
+     */
+    std::shared_ptr<Node>
+    findNode(std::shared_ptr<Node> const &root, std::string const &path);
+    // create all missing groups along the path
+    std::shared_ptr<Node>
+    ensureNode(std::shared_ptr<Node> const &root, std::string const &path);
+    // returns false if the path did not exist
+    bool eraseNode(std::shared_ptr<Node> const &root, std::string const &path);
+
+    /*
+     * Append a (relative or absolute) path to a location, giving an absolute
+     * location that starts with a slash and ends without one.
+     */
+    std::string joinPath(std::string const &location, std::string const &path);
+
+    struct FilePosition : public AbstractFilePosition
+    {
+        explicit FilePosition(std::string location = "/");
+
+        /*
+         * Convention: Starts with slash '/', ends without.
+         */
+        std::string location;
+        /*
+         * Resolved node of `location` in the hierarchy of `root`,
+         * found again by `location` if expired.
+         */
+        std::weak_ptr<Node> node;
+        std::weak_ptr<Node> root;
+    };
+} // namespace memory
+} // namespace openPMD
@@ -0,0 +1,74 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/IO/AbstractIOHandler.hpp"
+#include "openPMD/auxiliary/JSON_internal.hpp"
+#include "openPMD/config.hpp"
+
+#if openPMD_HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include <future>
+#include <memory>
+#include <string>
+
+namespace openPMD
+{
+class MemoryIOHandlerImpl;
+
+/*
+ * Keeps files in the memory of the current process, see
+ * MemoryIOHandlerImpl.
+ */
+class MemoryIOHandler : public AbstractIOHandler
+{
+public:
+    MemoryIOHandler(
+        std::string path,
+        Access,
+        json::TracingJSON config,
+        std::string originalExtension);
+#if openPMD_HAVE_MPI
+    MemoryIOHandler(
+        std::string path,
+        Access,
+        MPI_Comm,
+        json::TracingJSON config,
+        std::string originalExtension);
+#endif
+    ~MemoryIOHandler() override;
+
+    std::string backendName() const override
+    {
+        return "MEMORY";
+    }
+
+    std::future<void> flush(internal::ParsedFlushParams &) override;
+
+    std::optional<std::vector<std::string>>
+    listDirectory(std::string const &dir) const override;
+
+private:
+    std::unique_ptr<MemoryIOHandlerImpl> m_impl;
+}; // MemoryIOHandler
+} // namespace openPMD
@@ -0,0 +1,83 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/IO/Memory/HierarchyIOHandlerImpl.hpp"
+#include "openPMD/auxiliary/JSON_internal.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace openPMD
+{
+/*
+ * Stores files as memory::Node trees in a registry that is global to the
+ * process, keyed by the normalized path of the file.
+ * A file written by one Series can be read by another Series in the same
+ * process until it is overwritten or deleted, the data is not copied when
+ * opening it.
+ * Files created with `memory.persist = false` are released as soon as no
+ * Series has them open any more.
+ */
+class MemoryIOHandlerImpl : public HierarchyIOHandlerImpl
+{
+public:
+    MemoryIOHandlerImpl(
+        AbstractIOHandler *,
+        json::TracingJSON config,
+        std::string originalExtension,
+        bool warnUnusedParameters = true);
+
+    ~MemoryIOHandlerImpl() override;
+
+    void createFile(
+        Writable *, Parameter<Operation::CREATE_FILE> const &) override;
+
+    void checkFile(Writable *, Parameter<Operation::CHECK_FILE> &) override;
+
+    void openFile(Writable *, Parameter<Operation::OPEN_FILE> &) override;
+
+    void
+    closeFile(Writable *, Parameter<Operation::CLOSE_FILE> const &) override;
+
+    void deleteFile(
+        Writable *, Parameter<Operation::DELETE_FILE> const &) override;
+
+    // files in the registry whose normalized path lies in the directory
+    static std::optional<std::vector<std::string>>
+    listDirectory(std::string const &directory);
+
+protected:
+    bool adoptsWriteBuffers() const override;
+
+private:
+    std::string m_originalExtension;
+    // keep created files in the registry after the last Series closes them
+    bool m_persist = true;
+
+    // key of the file in the process-wide registry
+    std::string registryKey(std::string const &fileName);
+    // reuse the file object if the file is already open
+    InvalidatableFile bindFile(Writable *, std::string name);
+}; // MemoryIOHandlerImpl
+} // namespace openPMD
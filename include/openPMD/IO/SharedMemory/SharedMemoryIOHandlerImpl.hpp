@@ -0,0 +1,135 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/config.hpp"
+
+#if openPMD_HAVE_SHM
+#include "openPMD/IO/Memory/HierarchyIOHandlerImpl.hpp"
+#include "openPMD/IO/SharedMemory/SharedMemoryStream.hpp"
+#include "openPMD/auxiliary/JSON_internal.hpp"
+
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace openPMD
+{
+/*
+ * Writer and reader side of the SHM backend.
+ *
+ * The writer collects the modifications of the openPMD hierarchy during an
+ * IO step and publishes them at the end of the step as a metadata segment.
+ * Dataset chunks are allocated right away in data segments of the step
+ * (an arena), so they are not copied again when publishing and the reader
+ * maps them directly. The reader applies the metadata of each step to its
+ * own copy of the hierarchy.
+ */
+class SharedMemoryIOHandlerImpl : public HierarchyIOHandlerImpl
+{
+public:
+    SharedMemoryIOHandlerImpl(
+        AbstractIOHandler *,
+        json::TracingJSON config,
+        std::string originalExtension,
+        std::string nameSuffix = {},
+        bool warnUnusedParameters = true);
+
+    ~SharedMemoryIOHandlerImpl() override;
+
+    void createFile(
+        Writable *, Parameter<Operation::CREATE_FILE> const &) override;
+
+    void checkFile(Writable *, Parameter<Operation::CHECK_FILE> &) override;
+
+    void openFile(Writable *, Parameter<Operation::OPEN_FILE> &) override;
+
+    void
+    closeFile(Writable *, Parameter<Operation::CLOSE_FILE> const &) override;
+
+    void deleteFile(
+        Writable *, Parameter<Operation::DELETE_FILE> const &) override;
+
+    void advance(Writable *, Parameter<Operation::ADVANCE> &) override;
+
+    void
+    closePath(Writable *, Parameter<Operation::CLOSE_PATH> const &) override;
+
+protected:
+    std::shared_ptr<void>
+    allocateChunk(InvalidatableFile const &, size_t bytes) override;
+
+    void recordChange(InvalidatableFile const &, memory::Change) override;
+
+    bool supportsSteps() const override;
+
+private:
+    struct ArenaSegment
+    {
+        std::shared_ptr<shm::Segment> segment;
+        size_t used = 0;
+    };
+
+    enum class ReaderStatus
+    {
+        // no step is held
+        NoStep,
+        // the first step was acquired upon opening, but not begun yet
+        FirstStepPending,
+        InStep
+    };
+
+    std::string m_originalExtension;
+    // appended to the stream name, distinguishes MPI ranks
+    std::string m_nameSuffix;
+    shm::Stream::Options m_streamOptions;
+    size_t m_segmentSize = 16 * 1024 * 1024;
+    std::optional<std::string> m_streamNameOverride;
+
+    std::optional<InvalidatableFile> m_file;
+    std::unique_ptr<shm::Stream> m_stream;
+
+    // writer
+    std::vector<memory::Change> m_changes;
+    std::set<std::tuple<memory::Change::Type, std::string, std::string>>
+        m_recordedChanges;
+    std::vector<ArenaSegment> m_arena;
+    bool m_printedDiscardWarning = false;
+
+    // reader
+    ReaderStatus m_readerStatus = ReaderStatus::NoStep;
+    // datasets whose chunks arrived in the current step
+    std::vector<std::string> m_stepDatasets;
+
+    std::string streamName(std::string const &fileName);
+    InvalidatableFile bindFile(Writable *, std::string name);
+
+    void publishStep();
+    // returns false if the stream is over
+    bool acquireStep();
+    void releaseStep();
+    void detach();
+}; // SharedMemoryIOHandlerImpl
+} // namespace openPMD
+#endif
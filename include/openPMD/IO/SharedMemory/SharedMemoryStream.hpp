@@ -0,0 +1,182 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/config.hpp"
+
+#if openPMD_HAVE_SHM
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace openPMD
+{
+/*
+ * POSIX shared memory primitives for the SHM backend.
+ */
+namespace shm
+{
+    /*
+     * A named POSIX shared memory object, mapped into this process.
+     * The mapping is released upon destruction, the name persists until
+     * unlink() is called.
+     */
+    class Segment
+    {
+    public:
+        // Create a new segment, replacing a stale one of the same name.
+        static Segment create(std::string name, size_t size);
+        // Map an existing segment.
+        static Segment open(std::string name, bool writable);
+        /*
+         * Map a segment of at least the given size, creating it if needed.
+         * New segments are zero-initialized.
+         */
+        static Segment openOrCreate(std::string name, size_t size);
+        // Returns false if no segment of that name exists.
+        static bool unlink(std::string const &name);
+
+        Segment(Segment &&) noexcept;
+        Segment &operator=(Segment &&) noexcept;
+        Segment(Segment const &) = delete;
+        Segment &operator=(Segment const &) = delete;
+        ~Segment();
+
+        void *data() const
+        {
+            return m_data;
+        }
+        size_t size() const
+        {
+            return m_size;
+        }
+        std::string const &name() const
+        {
+            return m_name;
+        }
+
+    private:
+        Segment(std::string name, void *data, size_t size);
+
+        std::string m_name;
+        void *m_data = nullptr;
+        size_t m_size = 0;
+    };
+
+    struct ControlBlock;
+
+    /*
+     * Coordination of one writer and one reader on a stream of IO steps.
+     *
+     * The stream is a control segment named `name` that counts published
+     * and consumed steps. The contents of step i live in segments named by
+     * stepSegmentName(i, ...) that the writer creates before publishing the
+     * step and that the reader unlinks after mapping them. A step is
+     * discarded by unlinking its segments.
+     */
+    class Stream
+    {
+    public:
+        enum class Role
+        {
+            Writer,
+            Reader
+        };
+
+        struct Options
+        {
+            /*
+             * Maximum number of steps published, but not yet consumed.
+             * The writer blocks while the limit is reached. 0 = unlimited.
+             */
+            uint64_t queueLimit = 2;
+            /*
+             * How long a reader waits for a writer to show up, and how long
+             * a writer with a full queue waits for a reader to attach.
+             */
+            std::chrono::milliseconds openTimeout = std::chrono::seconds(60);
+        };
+
+        /*
+         * Attach to the stream, creating it if necessary.
+         * Readers block until a writer is present.
+         */
+        Stream(std::string name, Role, Options);
+        Stream(Stream const &) = delete;
+        Stream &operator=(Stream const &) = delete;
+        // Detaches if not done yet, see close().
+        ~Stream();
+
+        /*
+         * Name of a segment belonging to the given step, either of the
+         * metadata segment (dataSegment == nullopt) or of a data segment.
+         */
+        std::string stepSegmentName(
+            uint64_t step, std::optional<uint64_t> dataSegment) const;
+
+        /*
+         * Writer: index of the step that is assembled currently.
+         */
+        uint64_t nextStep() const;
+        /*
+         * Writer: publish the step nextStep(), blocking while the queue is
+         * full. If no reader will ever consume the step, its segments are
+         * unlinked and false is returned. A reader that did not attach
+         * within Options::openTimeout of the queue filling up counts as
+         * gone.
+         */
+        bool publish();
+
+        /*
+         * Reader: wait for the next step. An empty return value indicates
+         * that the writer has closed the stream and all steps are consumed.
+         */
+        std::optional<uint64_t> acquire();
+        // Reader: done with the step returned by acquire().
+        void release();
+
+        /*
+         * Detach from the stream. A reader discards all steps that it has
+         * not consumed. The last party to leave removes the stream.
+         */
+        void close();
+
+    private:
+        std::string m_name;
+        Role m_role;
+        Options m_options;
+        uint64_t m_session = 0;
+        // writer: no reader attached within the open timeout, don't wait again
+        bool m_attachTimedOut = false;
+        ControlBlock *m_control = nullptr;
+        std::optional<Segment> m_controlSegment;
+
+        std::string segmentName(
+            uint64_t session,
+            uint64_t step,
+            std::optional<uint64_t> dataSegment) const;
+        void discardStep(uint64_t session, uint64_t step) const;
+    };
+} // namespace shm
+} // namespace openPMD
+#endif
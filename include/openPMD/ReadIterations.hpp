@@ -55,6 +55,12 @@ class SeriesIterator
          * are still there and the iterations can be parsed again.
          */
         std::set<Iteration::IterationIndex_t> ignoreIterations;
+        /*
+         * File-based encoding: The last iteration for which the backend has
+         * been asked to prefetch its file. Iterations are visited in
+         * ascending order, so this suffices for not hinting twice.
+         */
+        std::optional<iteration_index_t> lastPrefetchedIteration;
     };
 
     /*
@@ -137,6 +143,13 @@ private:
 
     void deactivateDeadIteration(iteration_index_t);
 
+    /*
+     * File-based encoding: Hint the backend to load the files of the next
+     * iterations in the background while the current one is being processed.
+     * Controlled by the JSON option `prefetch_iterations`, no-op by default.
+     */
+    void prefetchUpcomingIterations();
+
     void initSeriesInLinearReadMode();
 
     void close();
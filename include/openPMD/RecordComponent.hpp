@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include "openPMD/ChunkInfo.hpp"
 #include "openPMD/Dataset.hpp"
 #include "openPMD/Datatype.hpp"
 #include "openPMD/auxiliary/ShareRaw.hpp"
@@ -30,9 +31,9 @@
 
 #include <array>
 #include <cmath>
+#include <deque>
 #include <limits>
 #include <memory>
-#include <queue>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -51,6 +52,9 @@ namespace openPMD
 template <typename T>
 class DynamicMemoryView;
 
+template <typename T>
+class ReadOnlyMemoryView;
+
 class RecordComponent;
 
 namespace internal
@@ -69,7 +73,7 @@ namespace internal
         /**
          * Chunk reading/writing requests on the contained dataset.
          */
-        std::queue<IOTask> m_chunks;
+        std::deque<IOTask> m_chunks;
 
         void push_chunk(IOTask &&task);
         /**
@@ -103,7 +107,7 @@ namespace internal
         void reset() override
         {
             BaseRecordComponentData::reset();
-            m_chunks = std::queue<IOTask>();
+            m_chunks = std::deque<IOTask>();
             m_constantValue = -1;
             m_name = std::string();
             m_isEmpty = false;
@@ -117,6 +121,17 @@ namespace internal
 template <typename>
 class BaseRecord;
 
+/**
+ * A chunk selected by RecordComponent::loadChunksInRange(), along with the
+ * buffer that its data will be loaded into upon the next flush.
+ */
+template <typename T>
+struct SelectedChunk
+{
+    ChunkInfo chunk;
+    std::shared_ptr<T> data;
+};
+
 class RecordComponent : public BaseRecordComponent
 {
     template <typename T, typename T_key, typename T_container>
@@ -133,6 +148,7 @@ class RecordComponent : public BaseRecordComponent
     friend class DynamicMemoryView;
     friend class internal::RecordComponentData;
     friend class MeshRecordComponent;
+    friend class Series;
     template <typename T>
     friend T &internal::makeOwning(T &self, Series);
 
@@ -244,6 +260,56 @@ public:
      */
     shared_ptr_dataset_types loadChunkVariant(Offset = {0u}, Extent = {-1u});
 
+    /** Load and allocate only those chunks that may contain values in the
+     *  closed interval [lower, upper].
+     *
+     * Uses the chunk statistics reported by availableChunks() (see
+     * ChunkStatistics) to skip chunks whose values cannot match. Chunks
+     * without statistics are always loaded. The loaded chunks are
+     * restricted to the selection given by offset and extent, which follow
+     * the same conventions as in loadChunk().
+     *
+     * Note that values are not filtered individually, i.e. a loaded chunk
+     * may still contain values outside the requested interval.
+     *
+     * As with loadChunk(), data is only available after the next flush.
+     *
+     * @return The selected chunks along with their (yet to be filled)
+     *         buffers.
+     */
+    template <typename T>
+    std::vector<SelectedChunk<T>> loadChunksInRange(
+        T lower, T upper, Offset offset = {0u}, Extent extent = {-1u});
+
+    /** Load a chunk of data, avoiding copies where the backend allows it.
+     *
+     * If the backend can lend its own memory for the requested chunk,
+     * the returned view points directly into it. This is currently the
+     * case for the ADIOS2 Inline engine (the writer's buffers) and for
+     * uncompressed, contiguous HDF5 datasets in serial read-only mode
+     * (memory-mapped file contents), as long as the selection is
+     * contiguous in memory and T matches the dataset's datatype.
+     * Otherwise, the openPMD API falls back to allocating a buffer and
+     * loading the chunk into it.
+     *
+     * Unlike loadChunk(), this call is a
+     * <a
+     * href="https://openpmd-api.readthedocs.io/en/latest/usage/workflow.html#deferred-data-api-contract">
+     * flush point</a> and the data is available right away.
+     * Views into backend memory are valid until the next flush point or
+     * until the next step is begun, whichever comes first.
+     *
+     * @param offset Offset within the dataset. Set to {0u} for full selection.
+     * @param extent Extent within the dataset, counted from the offset.
+     *               Set to {-1u} for full selection.
+     *               If offset is non-zero and extent is {-1u} the leftover
+     *               extent in the record component will be selected.
+     * @return Read-only view into the loaded data.
+     */
+    template <typename T>
+    ReadOnlyMemoryView<T>
+    loadChunkView(Offset offset = {0u}, Extent extent = {-1u});
+
     /** Load a chunk of data into pre-allocated memory.
      *
      * @param data   Preallocated, contiguous buffer, large enough to load the
@@ -413,6 +479,9 @@ public:
      * This may save memory if the openPMD backend in use is able to provide
      * users a view into its own buffers, avoiding the need to allocate
      * a new buffer.
+     * The HDF5 and JSON backends serve such views from a pool of staging
+     * buffers that are reused after writing, so repeated calls with similar
+     * sizes (e.g. once per iteration) do not allocate.
      *
      * Data can be written into the returned buffer until the next <a
      * href="https://openpmd-api.readthedocs.io/en/latest/usage/workflow.html#deferred-data-api-contract">
@@ -436,6 +505,8 @@ public:
      *        storeChunk() API on it.
      *        If the backend supports it, the buffer is not read before the next
      *        flush point and becomes invalid afterwards.
+     *        The Series option write_buffer_budget does not trigger flushes
+     *        between this call and the next flush point.
      *
      * @return View into a buffer that can be filled with data.
      */
@@ -28,6 +28,7 @@
 #include "openPMD/auxiliary/TypeTraits.hpp"
 #include "openPMD/auxiliary/UniquePtr.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 
@@ -93,6 +94,131 @@ inline std::shared_ptr<T> RecordComponent::loadChunk(Offset o, Extent e)
 #endif
 }
 
+template <typename T>
+inline std::vector<SelectedChunk<T>>
+RecordComponent::loadChunksInRange(T lower, T upper, Offset o, Extent e)
+{
+    uint8_t dim = getDimensionality();
+
+    // default arguments
+    //   offset = {0u}: expand to right dim {0u, 0u, ...}
+    Offset offset = o;
+    if (o.size() == 1u && o.at(0) == 0u && dim > 1u)
+        offset = Offset(dim, 0u);
+
+    //   extent = {-1u}: take full size
+    Extent extent(dim, 1u);
+    if (e.size() == 1u && e.at(0) == -1u)
+    {
+        extent = getExtent();
+        for (uint8_t i = 0u; i < dim; ++i)
+            extent[i] -= offset[i];
+    }
+    else
+        extent = e;
+
+    if (extent.size() != dim || offset.size() != dim)
+    {
+        std::ostringstream oss;
+        oss << "Dimensionality of selection ("
+            << "offset=" << offset.size() << "D, "
+            << "extent=" << extent.size() << "D) "
+            << "and record component (" << int(dim) << "D) "
+            << "do not match.";
+        throw std::runtime_error(oss.str());
+    }
+
+    std::vector<SelectedChunk<T>> res;
+    for (auto const &chunk :
+         availableChunks_impl(/* withStatistics = */ true))
+    {
+        if (chunk.statistics.has_value() &&
+            !chunk.statistics->mayContain(
+                static_cast<double>(lower), static_cast<double>(upper)))
+        {
+            continue;
+        }
+        auto restricted =
+            chunk_assignment::restrictToSelection(chunk, offset, extent);
+        if (!restricted.has_value())
+        {
+            continue;
+        }
+        ChunkInfo selected = std::move(*restricted);
+        auto data = loadChunk<T>(selected.offset, selected.extent);
+        res.push_back({std::move(selected), std::move(data)});
+    }
+    return res;
+}
+
+template <typename T>
+inline ReadOnlyMemoryView<T> RecordComponent::loadChunkView(Offset o, Extent e)
+{
+    uint8_t dim = getDimensionality();
+
+    // default arguments
+    //   offset = {0u}: expand to right dim {0u, 0u, ...}
+    Offset offset = o;
+    if (o.size() == 1u && o.at(0) == 0u && dim > 1u)
+        offset = Offset(dim, 0u);
+
+    //   extent = {-1u}: take full size
+    Extent extent(dim, 1u);
+    if (e.size() == 1u && e.at(0) == -1u)
+    {
+        extent = getExtent();
+        for (uint8_t i = 0u; i < dim; ++i)
+            extent[i] -= offset[i];
+    }
+    else
+        extent = e;
+
+    uint64_t numPoints = 1u;
+    for (auto const &dimensionSize : extent)
+        numPoints *= dimensionSize;
+
+    /*
+     * Only ask the backend for a view if the selection is valid, otherwise
+     * loadChunk() below will throw an appropriate error.
+     */
+    bool validSelection = extent.size() == dim && offset.size() == dim;
+    if (validSelection)
+    {
+        Extent dse = getExtent();
+        for (uint8_t i = 0; i < dim; ++i)
+            validSelection = validSelection && dse[i] >= offset[i] + extent[i];
+    }
+    if (validSelection && numPoints > 0 && !constant() &&
+        isSame(determineDatatype<T>(), getDatatype()))
+    {
+        Parameter<Operation::READ_DATASET_VIEW> dView;
+        dView.offset = offset;
+        dView.extent = extent;
+        dView.dtype = getDatatype();
+        IOHandler()->enqueue(IOTask(this, dView));
+        IOHandler()->flush(internal::defaultFlushParams);
+        auto &out = *dView.out;
+        if (out.backendManagedBuffer)
+        {
+            return ReadOnlyMemoryView<T>{
+                std::move(out.owner),
+                static_cast<T const *>(out.ptr),
+                numPoints,
+                /* zeroCopy = */ true};
+        }
+    }
+
+    auto data = loadChunk<T>(std::move(offset), std::move(extent));
+    seriesFlush_impl</* flush_entire_series = */ false>(
+        {FlushLevel::UserFlush});
+    T const *ptr = data.get();
+    return ReadOnlyMemoryView<T>{
+        std::static_pointer_cast<void const>(std::move(data)),
+        ptr,
+        numPoints,
+        /* zeroCopy = */ false};
+}
+
 template <typename T>
 inline void
 RecordComponent::loadChunk(std::shared_ptr<T> data, Offset o, Extent e)
@@ -321,8 +447,11 @@ RecordComponent::storeChunk(Offset o, Extent e, F &&createBuffer)
                 "using storeChunk() (see RecordComponent::resetDataset()).");
         }
         dCreate.options = rc.m_dataset.value().options;
+        dCreate.initialChunks = {ChunkInfo(o, e)};
         IOHandler()->enqueue(IOTask(this, dCreate));
     }
+    // the span must stay valid, so the write buffer budget cannot flush now
+    IOHandler()->m_spansSinceFlush = true;
     Parameter<Operation::GET_BUFFER_VIEW> getBufferView;
     getBufferView.offset = o;
     getBufferView.extent = e;
@@ -28,6 +28,7 @@
 #include "openPMD/IterationEncoding.hpp"
 #include "openPMD/Streaming.hpp"
 #include "openPMD/WriteIterations.hpp"
+#include "openPMD/auxiliary/Codec.hpp"
 #include "openPMD/auxiliary/TypeTraits.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
 #include "openPMD/backend/Attributable.hpp"
@@ -181,6 +182,40 @@ namespace internal
          * True if a user opts into lazy parsing.
          */
         bool m_parseLazily = false;
+        /**
+         * Number of upcoming iterations for which Series::readIterations()
+         * hints the backend to start loading in advance.
+         * Only used in file-based iteration encoding, zero disables it.
+         */
+        unsigned int m_prefetchIterations = 0;
+        /**
+         * Whether rank 0 alone reads the metadata of a Series opened in
+         * parallel and broadcasts it to the other ranks.
+         * Only used for read-only HDF5 and JSON/TOML.
+         */
+        bool m_collectiveMetadata = false;
+        /**
+         * Number of files that may be closed in the background at the same
+         * time, zero closes them synchronously.
+         * Only used for serial HDF5 and JSON/TOML.
+         */
+        unsigned int m_filesInFlight = 0;
+        /**
+         * Series option write_buffer_budget, passed on to
+         * AbstractIOHandler::m_writeBufferBudget. Zero disables it.
+         */
+        std::size_t m_writeBufferBudget = 0;
+        /**
+         * Series option codec_advisor. If set, datasets without an explicit
+         * "codec" option get one picked by trial-encoding their first
+         * chunk, see RecordComponent::flush().
+         */
+        std::optional<auxiliary::CodecAdvisor> m_codecAdvisor;
+        /**
+         * Codecs picked by the advisor, by path of the record component
+         * below the iteration, so that later iterations reuse them.
+         */
+        std::map<std::string, std::string> m_codecDecisions;
 
         /**
          * In variable-based encoding, all backends except ADIOS2 can only write
@@ -253,6 +288,7 @@ class Series : public Attributable
     friend class Iteration;
     friend class Writable;
     friend class ReadIterations;
+    friend class RecordComponent;
     friend class SeriesIterator;
     friend class internal::SeriesData;
     friend class internal::AttributableData;
@@ -629,6 +665,14 @@ public:
      */
     void flush(std::string backendConfig = "{}");
 
+    /** Bytes of chunk payload stored for writing that are still held by the
+     *  openPMD-api, i.e. not yet written to or copied by the backend.
+     *
+     * See the Series option write_buffer_budget for flushing automatically
+     * once too many bytes are pending.
+     */
+    std::size_t pendingWriteBytes() const;
+
     /**
      * @brief Entry point to the reading end of the streaming API.
      *
@@ -662,6 +706,39 @@ public:
      */
     void parseBase();
 
+    /**
+     * @brief Load the same selection of one record component from several
+     *        iterations in one call, e.g. for extracting probe values or a
+     *        small box over time.
+     *
+     * All selections are read in one single flush of the backend.
+     * Iterations whose parsing has been deferred (see the JSON/TOML option
+     * `defer_iteration_parsing`) are not parsed for this in group-based
+     * iteration encoding, instead only the requested dataset is opened.
+     * Only available in Access::READ_RANDOM_ACCESS mode.
+     *
+     * @tparam T Datatype to load the data as, same restrictions as in
+     *           RecordComponent::loadChunk().
+     * @param recordComponent Path of the record component within each
+     *        iteration, e.g. "meshes/E/x", "meshes/rho" (scalar mesh) or
+     *        "particles/e/position/x".
+     * @param offset Offset of the selection, as in
+     *        RecordComponent::loadChunk().
+     * @param extent Extent of the selection, must be given explicitly.
+     * @param iterationIndices Iterations to load from, in this order.
+     *        If empty, load from all iterations of the Series.
+     * @return Buffer of (number of iterations) * (product of extent)
+     *         elements, holding the selection of one iteration after
+     *         another, each in row-major order. The data is available upon
+     *         returning.
+     */
+    template <typename T>
+    std::shared_ptr<T> loadTimeSeries(
+        std::string const &recordComponent,
+        Offset const &offset,
+        Extent const &extent,
+        std::vector<IterationIndex_t> iterationIndices = {});
+
     /**
      * @brief Entry point to the writing end of the streaming API.
      *
@@ -754,8 +831,8 @@ OPENPMD_private
     /**
      * @brief Parse non-backend-specific configuration in JSON config.
      *
-     * Currently this parses the keys defer_iteration_parsing, backend and
-     * iteration_encoding.
+     * Currently this parses the keys defer_iteration_parsing,
+     * prefetch_iterations, backend and iteration_encoding.
      *
      * @tparam TracingJSON template parameter so we don't have
      *         to include the JSON lib here
@@ -905,6 +982,23 @@ OPENPMD_private
 
     AbstractIOHandler *runDeferredInitialization();
 
+    /*
+     * For use by loadTimeSeries().
+     * Look up the record component in each of the given iterations (all
+     * iterations if empty). Iterations with deferred parsing in group-based
+     * encoding are not parsed, the returned record component is opened
+     * directly by its path instead.
+     */
+    std::vector<RecordComponent> timeSeriesComponents(
+        std::string const &recordComponent,
+        std::vector<IterationIndex_t> &iterationIndices);
+    /*
+     * For use by loadTimeSeries().
+     * Enqueue the chunks loaded from the given record components and flush
+     * them in one go.
+     */
+    void flushTimeSeriesComponents(std::vector<RecordComponent> &);
+
     AbstractIOHandler *IOHandler();
     AbstractIOHandler const *IOHandler() const;
 }; // Series
@@ -915,6 +1009,8 @@ namespace debug
 }
 } // namespace openPMD
 
+#include "openPMD/Series.tpp"
+
 // Make sure that this one is always included if Series.hpp is included,
 // otherwise Series::readIterations() cannot be used
 #include "openPMD/ReadIterations.hpp"
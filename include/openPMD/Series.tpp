@@ -0,0 +1,62 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "openPMD/Error.hpp"
+#include "openPMD/RecordComponent.hpp"
+#include "openPMD/Series.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openPMD
+{
+template <typename T>
+inline std::shared_ptr<T> Series::loadTimeSeries(
+    std::string const &recordComponent,
+    Offset const &offset,
+    Extent const &extent,
+    std::vector<IterationIndex_t> iterationIndices)
+{
+    if (extent.size() == 1u && extent.at(0) == -1u)
+    {
+        throw error::WrongAPIUsage(
+            "[Series::loadTimeSeries] Extent must be specified explicitly.");
+    }
+    auto components = timeSeriesComponents(recordComponent, iterationIndices);
+
+    size_t numPoints = 1;
+    for (auto const &dimensionSize : extent)
+    {
+        numPoints *= dimensionSize;
+    }
+    std::shared_ptr<T> res{
+        new T[components.size() * numPoints], [](T *ptr) { delete[] ptr; }};
+    for (size_t i = 0; i < components.size(); ++i)
+    {
+        components[i].loadChunkRaw(res.get() + i * numPoints, offset, extent);
+    }
+    flushTimeSeriesComponents(components);
+    return res;
+}
+} // namespace openPMD
@@ -38,6 +38,8 @@ class Span
 {
     template <typename>
     friend class DynamicMemoryView;
+    template <typename>
+    friend class ReadOnlyMemoryView;
 
 private:
     T *m_ptr;
@@ -130,4 +132,56 @@ public:
         return Span<T>{static_cast<T *>(m_param.out->ptr), m_size};
     }
 };
+
+/**
+ * @brief A read-only view into a loaded chunk, as returned by
+ *      RecordComponent::loadChunkView().
+ *      The view either points into memory managed by the backend (see
+ *      zeroCopy()) or owns a buffer allocated by the openPMD API.
+ */
+template <typename T>
+class ReadOnlyMemoryView
+{
+    friend class RecordComponent;
+
+private:
+    std::shared_ptr<void const> m_owner;
+    T const *m_ptr = nullptr;
+    size_t m_size = 0;
+    bool m_zeroCopy = false;
+
+    ReadOnlyMemoryView(
+        std::shared_ptr<void const> owner,
+        T const *ptr,
+        size_t size,
+        bool zeroCopy)
+        : m_owner(std::move(owner))
+        , m_ptr(ptr)
+        , m_size(size)
+        , m_zeroCopy(zeroCopy)
+    {}
+
+public:
+    explicit ReadOnlyMemoryView() = default;
+
+    /**
+     * @brief Acquire the loaded data.
+     *
+     * If zeroCopy() is true, the data is only valid until the next flush
+     * point or the next step.
+     */
+    Span<T const> currentBuffer() const
+    {
+        return Span<T const>{m_ptr, m_size};
+    }
+
+    /**
+     * @brief Whether the view points into memory managed by the backend
+     *      (true) or into a buffer owned by the view (false).
+     */
+    bool zeroCopy() const
+    {
+        return m_zeroCopy;
+    }
+};
 } // namespace openPMD
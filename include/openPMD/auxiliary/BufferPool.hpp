@@ -0,0 +1,87 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/auxiliary/Export.hpp"
+#include "openPMD/auxiliary/UniquePtr.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace openPMD
+{
+namespace auxiliary
+{
+    /**
+     * Pool of staging buffers, grouped into size classes of powers of two.
+     *
+     * Buffers handed out by acquire() return to the pool when they are
+     * deleted, so a loop that repeatedly stages data of similar size only
+     * allocates in its first iteration. Used by backends without native
+     * support for span-based storeChunk() to serve the buffer views.
+     * Not thread-safe.
+     */
+    class OPENPMDAPI_EXPORT BufferPool
+    {
+    public:
+        /**
+         * Free buffers per size class that are kept for reuse, further
+         * released buffers are deallocated.
+         */
+        static constexpr size_t maxFreeBuffersPerSizeClass = 16;
+
+        BufferPool();
+
+        /**
+         * @brief Get a buffer of at least the given size in bytes.
+         *
+         * The buffer is suitably aligned for any scalar type. Deleting the
+         * returned pointer releases the buffer back into the pool, even if
+         * the pool has been destroyed in the meantime (the buffer is then
+         * deallocated).
+         */
+        UniquePtrWithLambda<void> acquire(size_t bytes);
+
+        /** Number of calls to acquire() served by a recycled buffer. */
+        size_t hits() const;
+        /** Number of calls to acquire() that needed an allocation. */
+        size_t misses() const;
+        /** Total size of the free buffers currently held by the pool. */
+        size_t freeBytes() const;
+
+        /** Deallocate all free buffers. */
+        void clear();
+
+    private:
+        struct State
+        {
+            // size class exponent -> free buffers of that class
+            std::map<unsigned, std::vector<std::unique_ptr<char[]>>>
+                freeBuffers;
+            size_t hits = 0;
+            size_t misses = 0;
+        };
+        std::shared_ptr<State> m_state;
+    };
+} // namespace auxiliary
+} // namespace openPMD
@@ -0,0 +1,165 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/auxiliary/Export.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace openPMD
+{
+namespace auxiliary
+{
+    /**
+     * Built-in lossless codec for dataset contents, available independent of
+     * any external compression library.
+     *
+     * The data is optionally shuffled first, i.e. the bytes (or bits) of
+     * equal significance of all elements are grouped together, which makes
+     * slowly varying numeric data far easier to compress. It is then packed
+     * with a fast LZ77 coder emitting the LZ4 block format.
+     */
+    struct OPENPMDAPI_EXPORT Codec
+    {
+        enum class Shuffle : std::uint8_t
+        {
+            None = 0,
+            Byte = 1,
+            Bit = 2
+        };
+
+        Shuffle shuffle = Shuffle::Byte;
+        bool compress = true;
+
+        /**
+         * Parse the value of the dataset option "codec":
+         * "none", "shuffle", "bitshuffle", "lz", "shuffle_lz" or
+         * "bitshuffle_lz". Returns an empty optional for unknown names.
+         */
+        static std::optional<Codec> fromString(std::string const &);
+        std::string toString() const;
+
+        /** Whether this codec leaves the data untouched. */
+        bool isIdentity() const;
+
+        /**
+         * Encode the given elements into a self-describing payload.
+         * If compression does not pay off, the (shuffled) data is stored as
+         * is, so the payload is at most headerSize bytes larger than the
+         * input.
+         */
+        std::vector<char> encode(
+            void const *data, size_t numElements, size_t typeSize) const;
+
+        /**
+         * Decode a payload created by encode(), independent of the codec
+         * that was used to create it. Throws on corrupt payloads.
+         */
+        static std::vector<char> decode(void const *payload, size_t size);
+
+        static constexpr size_t headerSize = 16;
+    };
+
+    /**
+     * Picks a codec for a dataset by trial-encoding a sample of its contents
+     * with each candidate codec, one thread per candidate.
+     */
+    class OPENPMDAPI_EXPORT CodecAdvisor
+    {
+    public:
+        enum class Objective
+        {
+            Balanced, //!< maximize compression ratio times throughput
+            Ratio //!< maximize compression ratio
+        };
+
+        struct Trial
+        {
+            Codec codec;
+            double ratio = 1.;
+            //! bytes of the sample encoded per second
+            double throughput = 0.;
+        };
+
+        struct Decision
+        {
+            //! empty if no candidate reached minRatio
+            std::optional<Codec> codec;
+            std::vector<Trial> trials;
+            size_t sampledBytes = 0;
+
+            /** Human-readable summary for logging. */
+            std::string toString() const;
+        };
+
+        Objective objective = Objective::Balanced;
+        /**
+         * Upper bound for the size of the sample, taken as a few evenly
+         * spaced blocks from the data.
+         */
+        size_t sampleBytes = 64 * 1024;
+        /**
+         * Compression ratio that a candidate must reach to be chosen at
+         * all, below it the data is stored uncompressed.
+         */
+        double minRatio = 1.1;
+        std::vector<Codec> candidates = {
+            Codec{Codec::Shuffle::None, true},
+            Codec{Codec::Shuffle::Byte, true},
+            Codec{Codec::Shuffle::Bit, true}};
+
+        Decision
+        advise(void const *data, size_t numElements, size_t typeSize) const;
+    };
+
+    /*
+     * The building blocks of the codec, exposed for testing.
+     * The shuffle functions handle numElements * typeSize bytes.
+     */
+    OPENPMDAPI_EXPORT void byteShuffle(
+        void const *in, void *out, size_t numElements, size_t typeSize);
+    OPENPMDAPI_EXPORT void byteUnshuffle(
+        void const *in, void *out, size_t numElements, size_t typeSize);
+    OPENPMDAPI_EXPORT void bitShuffle(
+        void const *in, void *out, size_t numElements, size_t typeSize);
+    OPENPMDAPI_EXPORT void bitUnshuffle(
+        void const *in, void *out, size_t numElements, size_t typeSize);
+
+    /** Worst-case size of lzCompress() output for size bytes of input. */
+    OPENPMDAPI_EXPORT size_t lzCompressBound(size_t size);
+    /**
+     * Compress into out, which must hold lzCompressBound(size) bytes.
+     * Returns the number of bytes written.
+     */
+    OPENPMDAPI_EXPORT size_t
+    lzCompress(void const *in, size_t size, void *out);
+    /**
+     * Decompress exactly rawSize bytes into out.
+     * Throws if the input is corrupt.
+     */
+    OPENPMDAPI_EXPORT void
+    lzDecompress(void const *in, size_t size, void *out, size_t rawSize);
+} // namespace auxiliary
+} // namespace openPMD
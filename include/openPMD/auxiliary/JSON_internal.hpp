@@ -201,6 +201,17 @@ namespace json
      */
     ParsedConfig parseOptions(std::string const &options, bool considerFiles);
 
+    /**
+     * Like parseOptions() for inline options (no files), but parse each
+     * distinct options string only once.
+     * The results are interned in a process-wide cache and shared between
+     * callers, so they are immutable. Meant for options that are parsed
+     * repeatedly on hot paths, such as flush parameters and dataset options.
+     * Copy the result into a TracingJSON for tracing accessed keys.
+     */
+    std::shared_ptr<ParsedConfig const>
+    parseOptionsCached(std::string const &options);
+
 #if openPMD_HAVE_MPI
 
     /**
@@ -28,6 +28,7 @@
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <type_traits>
 #include <utility>
 #include <variant>
@@ -167,6 +168,50 @@ namespace auxiliary
         return allocatePtr(dtype, numPoints);
     }
 
+    /*
+     * If the hyperslab (offset, extent) within a row-major array of the
+     * given shape occupies one contiguous range of memory, return the index
+     * of its first element. Otherwise, or if the hyperslab is empty, return
+     * an empty optional.
+     */
+    inline std::optional<uint64_t> contiguousSelectionStart(
+        Extent const &shape, Offset const &offset, Extent const &extent)
+    {
+        auto dim = shape.size();
+        if (offset.size() != dim || extent.size() != dim)
+        {
+            return std::nullopt;
+        }
+        for (size_t i = 0; i < dim; ++i)
+        {
+            if (extent[i] == 0 || offset[i] + extent[i] > shape[i])
+            {
+                return std::nullopt;
+            }
+        }
+        // skip trailing dimensions that are selected in their full size
+        size_t partial = dim;
+        while (partial > 0 && offset[partial - 1] == 0 &&
+               extent[partial - 1] == shape[partial - 1])
+        {
+            --partial;
+        }
+        // all dimensions before the last partial one must be single slices
+        for (size_t i = 0; i + 1 < partial; ++i)
+        {
+            if (extent[i] != 1)
+            {
+                return std::nullopt;
+            }
+        }
+        uint64_t start = 0;
+        for (size_t i = 0; i < dim; ++i)
+        {
+            start = start * shape[i] + offset[i];
+        }
+        return start;
+    }
+
     /*
      * A buffer for the WRITE_DATASET task that can either be a std::shared_ptr
      * or a std::unique_ptr.
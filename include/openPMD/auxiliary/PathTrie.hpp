@@ -0,0 +1,87 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "openPMD/auxiliary/Export.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openPMD
+{
+namespace auxiliary
+{
+    /**
+     * Prefix tree over '/'-separated names, e.g. the variable or attribute
+     * names of an ADIOS2 step.
+     *
+     * Names are split at every slash, empty components included, so
+     * "/data/0" and "data/0" are different names. Listing the children or
+     * descendants of a prefix only visits the subtree below that prefix,
+     * independent of the number of names in the rest of the tree.
+     * A prefix with or without a single trailing slash denotes the same
+     * node, the empty prefix is equivalent to "/".
+     */
+    class OPENPMDAPI_EXPORT PathTrie
+    {
+    public:
+        struct Child
+        {
+            std::string name;
+            //! A name ends at this child
+            bool isEntry = false;
+            //! Further names continue below this child
+            bool hasChildren = false;
+        };
+
+        void insert(std::string const &name);
+
+        void clear();
+
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * @brief Direct children of a prefix, in lexicographic order.
+         */
+        [[nodiscard]] std::vector<Child>
+        children(std::string const &prefix) const;
+
+        /**
+         * @brief All names below a prefix, relative to the prefix and in
+         *        lexicographic order of their components.
+         */
+        [[nodiscard]] std::vector<std::string>
+        descendants(std::string const &prefix) const;
+
+    private:
+        struct Node
+        {
+            std::map<std::string, std::unique_ptr<Node>> children;
+            bool isEntry = false;
+        };
+        Node m_root;
+
+        Node const *find(std::string const &prefix) const;
+    };
+} // namespace auxiliary
+} // namespace openPMD
@@ -165,6 +165,13 @@ public:
     ChunkTable availableChunks();
 
 protected:
+    /*
+     * Like availableChunks(), but asks backends that compute
+     * ChunkStatistics from the data to do so, see
+     * RecordComponent::loadChunksInRange().
+     */
+    ChunkTable availableChunks_impl(bool withStatistics);
+
     using Data_t = internal::BaseRecordComponentData;
     std::shared_ptr<Data_t> m_baseRecordComponentData;
 
@@ -45,6 +45,9 @@ class AbstractIOHandlerImplCommon;
 template <typename>
 class Span;
 class Series;
+class HierarchyIOHandlerImpl;
+class MemoryIOHandlerImpl;
+class SharedMemoryIOHandlerImpl;
 
 namespace internal
 {
@@ -95,8 +98,11 @@ class Writable final
     template <typename>
     friend class AbstractIOHandlerImplCommon;
     friend class JSONIOHandlerImpl;
+    friend class HierarchyIOHandlerImpl;
+    friend class MemoryIOHandlerImpl;
+    friend class SharedMemoryIOHandlerImpl;
     friend struct test::TestHelper;
-    friend std::string concrete_h5_file_position(Writable *);
+    friend std::string const &concrete_h5_file_position(Writable *);
     friend std::string concrete_bp1_file_position(Writable *);
     template <typename>
     friend class Span;
@@ -184,5 +190,23 @@ OPENPMD_private
      *
      */
     bool written = false;
+
+    /**
+     * Cached result of resolving the path of this Writable within its file
+     * from the file positions along its parent chain, see
+     * concrete_h5_file_position().
+     * The file positions of the chain (starting with this Writable) are
+     * kept alongside the path and compared upon each lookup, so that the
+     * cache is implicitly invalidated if this Writable or any ancestor is
+     * re-parented or assigned a new file position.
+     * Keeping them alive here also ensures that a new file position cannot
+     * be allocated at the address of a cached one.
+     */
+    struct ResolvedFilePosition
+    {
+        std::string path;
+        std::vector<std::shared_ptr<AbstractFilePosition>> chain;
+    };
+    ResolvedFilePosition resolvedFilePosition;
 };
 } // namespace openPMD
@@ -0,0 +1,119 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "openPMD/auxiliary/Export.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace openPMD
+{
+namespace benchmark
+{
+    /**
+     * Summary of a set of time measurements (in seconds), e.g. the
+     * repetitions of one benchmark run.
+     * Percentiles are computed by linear interpolation between the closest
+     * ranks.
+     */
+    struct OPENPMDAPI_EXPORT Statistics
+    {
+        std::size_t samples = 0;
+        double min = 0;
+        double max = 0;
+        double mean = 0;
+        double median = 0;
+        double p90 = 0;
+        double p99 = 0;
+
+        static Statistics fromSamples(std::vector<double> samples);
+
+        /**
+         * @param sorted Samples in ascending order, must not be empty.
+         * @param percentile Between 0 and 100.
+         */
+        static double
+        percentile(std::vector<double> const &sorted, double percentile);
+    };
+
+    /**
+     * One line in the machine-readable output of a benchmark.
+     */
+    struct OPENPMDAPI_EXPORT Result
+    {
+        /**
+         * What was measured, e.g. "write" or "read:block".
+         */
+        std::string name;
+        /**
+         * Free-form description of the setup, e.g. backend, JSON config,
+         * number of ranks. Emitted as separate columns in CSV.
+         */
+        std::map<std::string, std::string> parameters;
+        Statistics seconds;
+        /**
+         * Payload bytes moved in one repetition (summed over all ranks).
+         */
+        std::uint64_t bytes = 0;
+        /**
+         * Peak resident set size in bytes during the measurement
+         * (maximum over all ranks), if the platform reports it.
+         */
+        std::optional<std::uint64_t> peakRSS;
+    };
+
+    /**
+     * Write the results as a JSON array of objects.
+     */
+    OPENPMDAPI_EXPORT void
+    writeJSON(std::ostream &, std::vector<Result> const &);
+
+    /**
+     * Write the results as CSV with a header line. The parameter columns are
+     * the union of all parameter keys, in alphabetical order.
+     */
+    OPENPMDAPI_EXPORT void
+    writeCSV(std::ostream &, std::vector<Result> const &);
+
+    /**
+     * High-water mark of the resident set size of this process, in bytes.
+     * Empty if the platform does not report it.
+     */
+    OPENPMDAPI_EXPORT std::optional<std::uint64_t> peakResidentSetSize();
+
+    /**
+     * Reset the high-water mark reported by peakResidentSetSize() to the
+     * current resident set size, so that subsequent measurements can be
+     * attributed to one benchmark phase.
+     * Only supported on Linux.
+     *
+     * @return Whether the reset was successful.
+     */
+    OPENPMDAPI_EXPORT bool resetPeakResidentSetSize();
+} // namespace benchmark
+} // namespace openPMD
@@ -75,6 +75,8 @@ namespace benchmark
                 {
                     if (line.find("VmRSS") == 0)
                         std::cout << line << " ";
+                    if (line.find("VmHWM") == 0)
+                        std::cout << line << " ";
                     if (line.find("VmSize") == 0)
                         std::cout << line << " ";
                     if (line.find("VmSwap") == 0)
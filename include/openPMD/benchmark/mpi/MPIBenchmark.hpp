@@ -34,7 +34,9 @@
 
 #include <mpi.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <exception>
 #include <iostream>
 #include <set>
@@ -70,6 +72,37 @@ public:
 
     DatasetFillerProvider m_dfp;
 
+    /**
+     * Patterns for reading back the written data. Each configuration is read
+     * once per pattern and repetition.
+     * The first pattern determines the read times in
+     * MPIBenchmarkReport::durations.
+     */
+    std::vector<BenchmarkReadPattern> readPatterns{
+        BenchmarkReadPattern::Block};
+
+    BenchmarkFlushPattern flushPattern = BenchmarkFlushPattern::PerStoreChunk;
+
+    /**
+     * How often each configuration is executed.
+     * MPIBenchmarkReport::results contains percentile statistics across the
+     * repetitions, MPIBenchmarkReport::durations the median.
+     */
+    unsigned int repetitions = 1;
+
+    /**
+     * Number of mesh records written per iteration, each with extent
+     * totalExtent. The first one is called "id", the others "id_<i>".
+     */
+    unsigned int meshRecords = 1;
+
+    /**
+     * Number of particle species written per iteration, each with one
+     * one-dimensional record "id" containing as many particles as the meshes
+     * have cells. Named "particles_<i>".
+     */
+    unsigned int particleSpecies = 0;
+
     /**
      * Construct an MPI benchmark manually.
      * @param basePath The path to write to. Will be extended with the
@@ -160,6 +193,15 @@ private:
 
     std::pair<Offset, Extent> slice(int size);
 
+    /**
+     * One-dimensional decomposition of the particle records, following the
+     * block sizes of the mesh decomposition.
+     */
+    std::pair<Offset, Extent> sliceParticles(Extent const &meshExtent);
+
+    static std::string meshName(unsigned int i);
+    static std::string speciesName(unsigned int i);
+
     /**
      * @brief Struct used by MPIBenchmark::runBenchmark in switchType.
      *        Does the actual heavy lifting.
@@ -177,11 +219,13 @@ private:
         {}
 
         /**
-         * Execute a single read benchmark.
+         * Execute a single write benchmark.
          * @tparam T Type of the dataset to write.
          * @param jsonConfig Backend-specific config.
          * @param offset Local offset of the chunk to write.
          * @param extent Local extent of the chunk to write.
+         * @param particleOffset Local offset of the particle chunk to write.
+         * @param particleExtent Local extent of the particle chunk to write.
          * @param extension File extension to control the openPMD backend.
          * @param datasetFiller The DatasetFiller to provide data for writing.
          * @param iterations The number of iterations to write.
@@ -192,6 +236,8 @@ private:
             std::string const &jsonConfig,
             Offset &offset,
             Extent &extent,
+            Offset &particleOffset,
+            Extent &particleExtent,
             std::string const &extension,
             std::shared_ptr<DatasetFiller<T>> datasetFiller,
             Series::IterationIndex_t iterations);
@@ -199,16 +245,22 @@ private:
         /**
          * Execute a single read benchmark.
          * @tparam T Type of the dataset to read.
-         * @param offset Local offset of the chunk to read.
-         * @param extent Local extent of the chunk to read.
+         * @param pattern Which portion of the datasets to read.
+         * @param offset Local offset of the chunk that this rank wrote.
+         * @param extent Local extent of the chunk that this rank wrote.
+         * @param particleOffset Local offset of the written particle chunk.
+         * @param particleExtent Local extent of the written particle chunk.
          * @param extension File extension to control the openPMD backend.
          * @param iterations The number of iterations to read.
-         * @return The time passed.
+         * @return The time passed and the number of bytes read by this rank.
          */
         template <typename T>
-        typename Clock::duration readBenchmark(
-            Offset &offset,
-            Extent &extent,
+        std::pair<typename Clock::duration, std::uint64_t> readBenchmark(
+            BenchmarkReadPattern pattern,
+            Offset const &offset,
+            Extent const &extent,
+            Offset const &particleOffset,
+            Extent const &particleExtent,
             std::string extension,
             Series::IterationIndex_t iterations);
 
@@ -273,6 +325,47 @@ std::pair<Offset, Extent> MPIBenchmark<DatasetFillerProvider>::slice(int size)
     return m_blockSlicer->sliceBlock(totalExtent, size, rank);
 }
 
+template <typename DatasetFillerProvider>
+std::pair<Offset, Extent> MPIBenchmark<DatasetFillerProvider>::sliceParticles(
+    Extent const &meshExtent)
+{
+    unsigned long long localItems = 1;
+    for (auto ext : meshExtent)
+    {
+        localItems *= ext;
+    }
+    unsigned long long itemsBefore = 0;
+    MPI_Exscan(
+        &localItems,
+        &itemsBefore,
+        1,
+        MPI_UNSIGNED_LONG_LONG,
+        MPI_SUM,
+        this->communicator);
+    int rank;
+    MPI_Comm_rank(this->communicator, &rank);
+    if (rank == 0)
+    {
+        // MPI_Exscan leaves the receive buffer undefined on rank 0
+        itemsBefore = 0;
+    }
+    return std::make_pair(
+        Offset{Offset::value_type(itemsBefore)},
+        Extent{Extent::value_type(localItems)});
+}
+
+template <typename DatasetFillerProvider>
+std::string MPIBenchmark<DatasetFillerProvider>::meshName(unsigned int i)
+{
+    return i == 0 ? "id" : "id_" + std::to_string(i);
+}
+
+template <typename DatasetFillerProvider>
+std::string MPIBenchmark<DatasetFillerProvider>::speciesName(unsigned int i)
+{
+    return "particles_" + std::to_string(i);
+}
+
 template <typename DatasetFillerProvider>
 void MPIBenchmark<DatasetFillerProvider>::addConfiguration(
     std::string jsonConfig,
@@ -300,7 +393,7 @@ void MPIBenchmark<DatasetFillerProvider>::addConfiguration(
 template <typename DatasetFillerProvider>
 void MPIBenchmark<DatasetFillerProvider>::resetConfigurations()
 {
-    this->m_compressions.clear();
+    this->m_configurations.clear();
 }
 
 template <typename DatasetFillerProvider>
@@ -311,10 +404,19 @@ MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::writeBenchmark(
     std::string const &jsonConfig,
     Offset &offset,
     Extent &extent,
+    Offset &particleOffset,
+    Extent &particleExtent,
     std::string const &extension,
     std::shared_ptr<DatasetFiller<T>> datasetFiller,
     Series::IterationIndex_t iterations)
 {
+    auto flushPattern = m_benchmark->flushPattern;
+    Extent totalParticles{1};
+    for (auto ext : m_benchmark->totalExtent)
+    {
+        totalParticles[0] *= ext;
+    }
+
     MPI_Barrier(m_benchmark->communicator);
     auto start = Clock::now();
 
@@ -328,20 +430,53 @@ MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::writeBenchmark(
     for (Series::IterationIndex_t i = 0; i < iterations; i++)
     {
         auto writeData = datasetFiller->produceData();
-
-        MeshRecordComponent id =
-            series.iterations[i].meshes["id"][MeshRecordComponent::SCALAR];
-
         Datatype datatype = determineDatatype(writeData);
-        Dataset dataset = Dataset(datatype, m_benchmark->totalExtent);
+        Iteration iteration = series.iterations[i];
 
-        id.resetDataset(dataset);
+        for (unsigned int m = 0; m < m_benchmark->meshRecords; ++m)
+        {
+            MeshRecordComponent id =
+                iteration.meshes[meshName(m)][MeshRecordComponent::SCALAR];
+
+            Dataset dataset = Dataset(datatype, m_benchmark->totalExtent);
+
+            id.resetDataset(dataset);
+            if (flushPattern == BenchmarkFlushPattern::PerStoreChunk)
+            {
+                series.flush();
+            }
+
+            id.storeChunk<T>(writeData, offset, extent);
+            if (flushPattern == BenchmarkFlushPattern::PerStoreChunk)
+            {
+                series.flush();
+            }
+        }
 
-        series.flush();
+        for (unsigned int p = 0; p < m_benchmark->particleSpecies; ++p)
+        {
+            RecordComponent id = iteration.particles[speciesName(p)]["id"]
+                                                    [RecordComponent::SCALAR];
+
+            id.resetDataset(Dataset(datatype, totalParticles));
+            if (flushPattern == BenchmarkFlushPattern::PerStoreChunk)
+            {
+                series.flush();
+            }
+
+            id.storeChunk<T>(writeData, particleOffset, particleExtent);
+            if (flushPattern == BenchmarkFlushPattern::PerStoreChunk)
+            {
+                series.flush();
+            }
+        }
 
-        id.storeChunk<T>(writeData, offset, extent);
-        series.flush();
+        if (flushPattern == BenchmarkFlushPattern::PerIteration)
+        {
+            series.flush();
+        }
     }
+    series.close();
 
     MPI_Barrier(m_benchmark->communicator);
     auto end = Clock::now();
@@ -359,13 +494,66 @@ MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::writeBenchmark(
 template <typename DatasetFillerProvider>
 template <typename Clock>
 template <typename T>
-typename Clock::duration
+std::pair<typename Clock::duration, std::uint64_t>
 MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::readBenchmark(
-    Offset &offset,
-    Extent &extent,
+    BenchmarkReadPattern pattern,
+    Offset const &offset,
+    Extent const &extent,
+    Offset const &particleOffset,
+    Extent const &particleExtent,
     std::string extension,
     Series::IterationIndex_t iterations)
 {
+    auto const &totalExtent = m_benchmark->totalExtent;
+    Offset meshReadOffset;
+    Extent meshReadExtent;
+    Offset particleReadOffset;
+    Extent particleReadExtent;
+    switch (pattern)
+    {
+    case BenchmarkReadPattern::Block:
+        meshReadOffset = offset;
+        meshReadExtent = extent;
+        particleReadOffset = particleOffset;
+        particleReadExtent = particleExtent;
+        break;
+    case BenchmarkReadPattern::FullScan:
+        meshReadOffset = Offset(totalExtent.size(), 0);
+        meshReadExtent = totalExtent;
+        particleReadOffset = {0};
+        particleReadExtent = {1};
+        for (auto ext : totalExtent)
+        {
+            particleReadExtent[0] *= ext;
+        }
+        break;
+    case BenchmarkReadPattern::Slice:
+        meshReadOffset = Offset(totalExtent.size(), 0);
+        meshReadExtent = totalExtent;
+        if (!totalExtent.empty())
+        {
+            meshReadOffset[0] = totalExtent[0] / 2;
+            meshReadExtent[0] = std::min<Extent::value_type>(totalExtent[0], 1);
+        }
+        // particles have no spatial structure here, read the own block
+        particleReadOffset = particleOffset;
+        particleReadExtent = particleExtent;
+        break;
+    }
+
+    auto itemsIn = [](Extent const &ext) {
+        std::uint64_t res = 1;
+        for (auto e : ext)
+        {
+            res *= e;
+        }
+        return res;
+    };
+    std::uint64_t bytesPerIteration =
+        (m_benchmark->meshRecords * itemsIn(meshReadExtent) +
+         m_benchmark->particleSpecies * itemsIn(particleReadExtent)) *
+        sizeof(T);
+
     MPI_Barrier(m_benchmark->communicator);
     // let every thread measure time
     auto start = Clock::now();
@@ -377,16 +565,28 @@ MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::readBenchmark(
 
     for (Series::IterationIndex_t i = 0; i < iterations; i++)
     {
-        MeshRecordComponent id =
-            series.iterations[i].meshes["id"][MeshRecordComponent::SCALAR];
-
-        auto chunk_data = id.loadChunk<T>(offset, extent);
+        Iteration iteration = series.iterations[i];
+        std::vector<std::shared_ptr<T>> chunks;
+        for (unsigned int m = 0; m < m_benchmark->meshRecords; ++m)
+        {
+            MeshRecordComponent id =
+                iteration.meshes[meshName(m)][MeshRecordComponent::SCALAR];
+            chunks.push_back(id.loadChunk<T>(meshReadOffset, meshReadExtent));
+        }
+        for (unsigned int p = 0; p < m_benchmark->particleSpecies; ++p)
+        {
+            RecordComponent id = iteration.particles[speciesName(p)]["id"]
+                                                    [RecordComponent::SCALAR];
+            chunks.push_back(
+                id.loadChunk<T>(particleReadOffset, particleReadExtent));
+        }
         series.flush();
     }
+    series.close();
 
     MPI_Barrier(m_benchmark->communicator);
     auto end = Clock::now();
-    return end - start;
+    return std::make_pair(end - start, bytesPerIteration * iterations);
 }
 
 template <typename DatasetFillerProvider>
@@ -415,6 +615,8 @@ void MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::call(
         }
 
         auto localCuboid = exec.m_benchmark->slice(size);
+        auto localParticles =
+            exec.m_benchmark->sliceParticles(localCuboid.second);
 
         extentT blockSize = 1;
         for (auto ext : localCuboid.second)
@@ -423,15 +625,63 @@ void MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::call(
         }
         dsf->setNumberOfItems(blockSize);
 
-        auto writeTime = exec.writeBenchmark<T>(
-            jsonConfig,
-            localCuboid.first,
-            localCuboid.second,
-            backend,
-            dsf,
-            iterations);
-        auto readTime = exec.readBenchmark<T>(
-            localCuboid.first, localCuboid.second, backend, iterations);
+        auto const &readPatterns = exec.m_benchmark->readPatterns;
+        unsigned int repetitions =
+            std::max(exec.m_benchmark->repetitions, 1u);
+        std::vector<typename Clock::duration> writeTimes;
+        std::vector<std::vector<typename Clock::duration>> readTimes(
+            readPatterns.size());
+        std::optional<std::uint64_t> writePeakRSS;
+        std::vector<std::optional<std::uint64_t>> readPeakRSS(
+            readPatterns.size());
+        std::vector<std::uint64_t> readBytes(readPatterns.size(), 0);
+        auto updatePeakRSS = [](std::optional<std::uint64_t> &peak) {
+            auto current = benchmark::peakResidentSetSize();
+            if (current.has_value())
+            {
+                peak = std::max(peak.value_or(0), *current);
+            }
+        };
+
+        for (unsigned int rep = 0; rep < repetitions; ++rep)
+        {
+            benchmark::resetPeakResidentSetSize();
+            writeTimes.push_back(exec.writeBenchmark<T>(
+                jsonConfig,
+                localCuboid.first,
+                localCuboid.second,
+                localParticles.first,
+                localParticles.second,
+                backend,
+                dsf,
+                iterations));
+            updatePeakRSS(writePeakRSS);
+            for (size_t p = 0; p < readPatterns.size(); ++p)
+            {
+                benchmark::resetPeakResidentSetSize();
+                auto [readTime, bytes] = exec.readBenchmark<T>(
+                    readPatterns[p],
+                    localCuboid.first,
+                    localCuboid.second,
+                    localParticles.first,
+                    localParticles.second,
+                    backend,
+                    iterations);
+                readTimes[p].push_back(readTime);
+                readBytes[p] = bytes;
+                updatePeakRSS(readPeakRSS[p]);
+            }
+        }
+
+        auto median = [](std::vector<typename Clock::duration> times) {
+            if (times.empty())
+            {
+                return typename Clock::duration{};
+            }
+            auto middle = times.begin() + times.size() / 2;
+            std::nth_element(times.begin(), middle, times.end());
+            return *middle;
+        };
         report.addReport(
             rootThread,
             jsonConfig,
@@ -439,7 +689,42 @@ void MPIBenchmark<DatasetFillerProvider>::BenchmarkExecution<Clock>::call(
             size,
             dt2,
             iterations,
-            std::make_pair(writeTime, readTime));
+            std::make_pair(
+                median(writeTimes),
+                readTimes.empty() ? typename Clock::duration{}
+                                  : median(readTimes[0])));
+
+        benchmark::Result result;
+        result.parameters = {
+            {"json_config", jsonConfig},
+            {"backend", backend},
+            {"ranks", std::to_string(size)},
+            {"datatype", datatypeToString(dt2)},
+            {"iterations", std::to_string(iterations)},
+            {"mesh_records", std::to_string(exec.m_benchmark->meshRecords)},
+            {"particle_species",
+             std::to_string(exec.m_benchmark->particleSpecies)},
+            {"flush_pattern",
+             benchmarkFlushPatternAsString(exec.m_benchmark->flushPattern)}};
+        std::uint64_t recordsPerIteration = exec.m_benchmark->meshRecords +
+            exec.m_benchmark->particleSpecies;
+        std::uint64_t writeBytes =
+            recordsPerIteration * blockSize * sizeof(T) * iterations;
+
+        result.name = "write";
+        report.addResult(
+            rootThread, result, writeTimes, writeBytes, writePeakRSS);
+        for (size_t p = 0; p < readPatterns.size(); ++p)
+        {
+            result.name =
+                "read:" + benchmarkReadPatternAsString(readPatterns[p]);
+            report.addResult(
+                rootThread,
+                result,
+                readTimes[p],
+                readBytes[p],
+                readPeakRSS[p]);
+        }
     }
 }
 } // namespace openPMD
@@ -26,15 +26,69 @@
 
 #include "openPMD/Datatype.hpp"
 #include "openPMD/Series.hpp"
+#include "openPMD/benchmark/BenchmarkResult.hpp"
 
 #include "string.h"
+#include <chrono>
+#include <cstdint>
 #include <map>
 #include <mpi.h>
+#include <optional>
+#include <string>
 #include <tuple>
 #include <vector>
 
 namespace openPMD
 {
+/**
+ * Access patterns used by MPIBenchmark for reading back the written data,
+ * modeled after examples/8b_benchmark_read_parallel.cpp.
+ */
+enum class BenchmarkReadPattern
+{
+    Block, //!< each rank reads back the block that it wrote
+    FullScan, //!< each rank reads the entire dataset
+    Slice //!< each rank reads the central hyperplane orthogonal to dim 0
+};
+
+/**
+ * When MPIBenchmark flushes the Series during writing.
+ */
+enum class BenchmarkFlushPattern
+{
+    PerStoreChunk, //!< after declaring and after storing each record
+    PerIteration, //!< once per iteration, after all records are stored
+    OnClose //!< only when closing the Series
+};
+
+inline std::string benchmarkReadPatternAsString(BenchmarkReadPattern pattern)
+{
+    switch (pattern)
+    {
+    case BenchmarkReadPattern::Block:
+        return "block";
+    case BenchmarkReadPattern::FullScan:
+        return "fullscan";
+    case BenchmarkReadPattern::Slice:
+        return "slice";
+    }
+    return "unknown";
+}
+
+inline std::string benchmarkFlushPatternAsString(BenchmarkFlushPattern pattern)
+{
+    switch (pattern)
+    {
+    case BenchmarkFlushPattern::PerStoreChunk:
+        return "per_store_chunk";
+    case BenchmarkFlushPattern::PerIteration:
+        return "per_iteration";
+    case BenchmarkFlushPattern::OnClose:
+        return "on_close";
+    }
+    return "unknown";
+}
+
 /**
  * The report for a single benchmark produced by
  * <openPMD/benchmark/mpi/MPIBenchmark>.
@@ -72,6 +126,15 @@ struct MPIBenchmarkReport
         ITERATIONS
     };
 
+    /**
+     * Machine-readable results, one entry per configuration and phase
+     * (write, and read per read pattern), with statistics across
+     * repetitions. Use benchmark::writeJSON() or benchmark::writeCSV() for
+     * output.
+     * Only populated on the root rank.
+     */
+    std::vector<benchmark::Result> results;
+
     /**
      * Add results for a certain compression strategy and level.
      *
@@ -110,6 +173,26 @@ struct MPIBenchmarkReport
         Datatype dt,
         Series::IterationIndex_t iterations);
 
+    /**
+     * Collectively add a machine-readable result.
+     * Per repetition, the slowest rank determines the time.
+     * Bytes are summed and peak RSS is maximized across ranks.
+     *
+     * @param rootThread The MPI rank which will collect the data.
+     * @param result Name and parameters of the result, the measured
+     *        quantities are filled in from the other arguments.
+     * @param localTimes Time measured on this rank, one per repetition.
+     *        Must have the same length on all ranks.
+     * @param localBytes Bytes moved by this rank in one repetition.
+     * @param localPeakRSS Peak RSS on this rank, if known.
+     */
+    void addResult(
+        int rootThread,
+        benchmark::Result result,
+        std::vector<Duration> const &localTimes,
+        std::uint64_t localBytes,
+        std::optional<std::uint64_t> localPeakRSS);
+
 private:
     template <typename D, typename Dummy = D>
     struct MPIDatatype
@@ -245,6 +328,70 @@ void MPIBenchmarkReport<Duration>::addReport(
     }
 }
 
+template <typename Duration>
+void MPIBenchmarkReport<Duration>::addResult(
+    int rootThread,
+    benchmark::Result result,
+    std::vector<Duration> const &localTimes,
+    std::uint64_t localBytes,
+    std::optional<std::uint64_t> localPeakRSS)
+{
+    int rank;
+    MPI_Comm_rank(communicator, &rank);
+
+    std::vector<double> localSeconds;
+    localSeconds.reserve(localTimes.size());
+    for (auto const &duration : localTimes)
+    {
+        localSeconds.push_back(
+            std::chrono::duration<double>(duration).count());
+    }
+    std::vector<double> maxSeconds(localSeconds.size());
+    MPI_Reduce(
+        localSeconds.data(),
+        maxSeconds.data(),
+        int(localSeconds.size()),
+        MPI_DOUBLE,
+        MPI_MAX,
+        rootThread,
+        communicator);
+
+    unsigned long long bytes = localBytes;
+    unsigned long long sumBytes = 0;
+    MPI_Reduce(
+        &bytes,
+        &sumBytes,
+        1,
+        MPI_UNSIGNED_LONG_LONG,
+        MPI_SUM,
+        rootThread,
+        communicator);
+
+    // 0 encodes an unknown value, as no process runs without memory
+    unsigned long long peakRSS = localPeakRSS.value_or(0);
+    unsigned long long maxPeakRSS = 0;
+    MPI_Reduce(
+        &peakRSS,
+        &maxPeakRSS,
+        1,
+        MPI_UNSIGNED_LONG_LONG,
+        MPI_MAX,
+        rootThread,
+        communicator);
+
+    if (rank == rootThread)
+    {
+        result.seconds =
+            benchmark::Statistics::fromSamples(std::move(maxSeconds));
+        result.bytes = sumBytes;
+        if (maxPeakRSS > 0)
+        {
+            result.peakRSS = maxPeakRSS;
+        }
+        results.push_back(std::move(result));
+    }
+}
+
 template <typename Duration>
 MPIBenchmarkReport<Duration>::MPIBenchmarkReport(MPI_Comm comm)
     : communicator{comm}
@@ -23,6 +23,11 @@
 
 #include "openPMD/auxiliary/Mpi.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
 #include <utility>
 
 #ifdef _WIN32
@@ -46,6 +51,21 @@ bool ChunkInfo::operator==(ChunkInfo const &other) const
     return this->offset == other.offset && this->extent == other.extent;
 }
 
+ChunkStatistics::ChunkStatistics(double min_in, double max_in, uint64_t count_in)
+    : min(min_in), max(max_in), count(count_in)
+{}
+
+bool ChunkStatistics::mayContain(double lower, double upper) const
+{
+    return count > 0 && lower <= max && upper >= min;
+}
+
+bool ChunkStatistics::operator==(ChunkStatistics const &other) const
+{
+    return this->min == other.min && this->max == other.max &&
+        this->count == other.count;
+}
+
 WrittenChunkInfo::WrittenChunkInfo(
     Offset offset_in, Extent extent_in, int sourceID_in)
     : ChunkInfo(std::move(offset_in), std::move(extent_in))
@@ -62,6 +82,423 @@ bool WrittenChunkInfo::operator==(WrittenChunkInfo const &other) const
         this->ChunkInfo::operator==(other);
 }
 
+namespace chunk_assignment
+{
+    namespace
+    {
+        uint64_t numberOfElements(Extent const &extent)
+        {
+            return std::accumulate(
+                extent.begin(),
+                extent.end(),
+                uint64_t(1),
+                std::multiplies<uint64_t>());
+        }
+
+        void requireReaders(RankMeta const &rankMetaOut, char const *strategy)
+        {
+            if (rankMetaOut.empty())
+            {
+                throw std::runtime_error(
+                    std::string("[") + strategy +
+                    "] Cannot distribute chunks among zero reading ranks.");
+            }
+        }
+
+        /*
+         * Split a chunk into pieces of at most maxElements elements along
+         * dimension dim (or the dimension with largest extent).
+         * A piece cannot be smaller than one slab orthogonal to that
+         * dimension, so pieces may still exceed maxElements.
+         */
+        void splitChunk(
+            WrittenChunkInfo chunk,
+            uint64_t maxElements,
+            std::optional<size_t> dim,
+            ChunkTable &res)
+        {
+            auto elements = numberOfElements(chunk.extent);
+            if (elements <= maxElements || chunk.extent.empty())
+            {
+                res.push_back(std::move(chunk));
+                return;
+            }
+            size_t splitDim;
+            if (dim.has_value())
+            {
+                splitDim = *dim;
+                if (splitDim >= chunk.extent.size())
+                {
+                    throw std::runtime_error(
+                        "[BinPacking] Cannot split " +
+                        std::to_string(chunk.extent.size()) +
+                        "D chunk along dimension " + std::to_string(splitDim) +
+                        ".");
+                }
+            }
+            else
+            {
+                splitDim = std::max_element(
+                               chunk.extent.begin(), chunk.extent.end()) -
+                    chunk.extent.begin();
+            }
+            uint64_t slabSize = elements / chunk.extent[splitDim];
+            uint64_t slabsPerPiece =
+                std::max<uint64_t>(1, maxElements / slabSize);
+            for (uint64_t start = 0; start < chunk.extent[splitDim];
+                 start += slabsPerPiece)
+            {
+                Offset offset = chunk.offset;
+                Extent extent = chunk.extent;
+                offset[splitDim] += start;
+                extent[splitDim] =
+                    std::min(slabsPerPiece, chunk.extent[splitDim] - start);
+                res.emplace_back(
+                    std::move(offset), std::move(extent), chunk.sourceID);
+            }
+        }
+    } // namespace
+
+    PartialAssignment::PartialAssignment(ChunkTable notAssigned_in)
+        : notAssigned(std::move(notAssigned_in))
+    {}
+
+    PartialAssignment::PartialAssignment(
+        ChunkTable notAssigned_in, Assignment assigned_in)
+        : notAssigned(std::move(notAssigned_in))
+        , assigned(std::move(assigned_in))
+    {}
+
+    Assignment Strategy::assign(
+        ChunkTable table,
+        RankMeta const &rankMetaIn,
+        RankMeta const &rankMetaOut)
+    {
+        return assign(
+            PartialAssignment(std::move(table)), rankMetaIn, rankMetaOut);
+    }
+
+    PartialAssignment PartialStrategy::assign(
+        ChunkTable table,
+        RankMeta const &rankMetaIn,
+        RankMeta const &rankMetaOut)
+    {
+        return assign(
+            PartialAssignment(std::move(table)), rankMetaIn, rankMetaOut);
+    }
+
+    FromPartialStrategy::FromPartialStrategy(
+        std::unique_ptr<PartialStrategy> firstPass,
+        std::unique_ptr<Strategy> secondPass)
+        : m_firstPass(std::move(firstPass)), m_secondPass(std::move(secondPass))
+    {}
+
+    Assignment FromPartialStrategy::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &in,
+        RankMeta const &out)
+    {
+        return m_secondPass->assign(
+            m_firstPass->assign(std::move(partialAssignment), in, out),
+            in,
+            out);
+    }
+
+    std::unique_ptr<Strategy> FromPartialStrategy::clone() const
+    {
+        return std::make_unique<FromPartialStrategy>(
+            m_firstPass->clone(), m_secondPass->clone());
+    }
+
+    Assignment RoundRobin::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &,
+        RankMeta const &out)
+    {
+        requireReaders(out, "RoundRobin");
+        auto &res = partialAssignment.assigned;
+        auto it = out.begin();
+        for (auto &chunk : partialAssignment.notAssigned)
+        {
+            res[it->first].push_back(std::move(chunk));
+            if (++it == out.end())
+            {
+                it = out.begin();
+            }
+        }
+        return std::move(res);
+    }
+
+    std::unique_ptr<Strategy> RoundRobin::clone() const
+    {
+        return std::make_unique<RoundRobin>(*this);
+    }
+
+    BinPacking::BinPacking(size_t splitAlongDimension_in)
+        : splitAlongDimension(splitAlongDimension_in)
+    {}
+
+    Assignment BinPacking::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &,
+        RankMeta const &out)
+    {
+        requireReaders(out, "BinPacking");
+        auto &res = partialAssignment.assigned;
+
+        uint64_t total = 0;
+        for (auto const &chunk : partialAssignment.notAssigned)
+        {
+            total += numberOfElements(chunk.extent);
+        }
+        uint64_t ranks = out.size();
+        uint64_t idealLoad =
+            std::max<uint64_t>(1, total / ranks + (total % ranks != 0));
+
+        ChunkTable pieces;
+        for (auto &chunk : partialAssignment.notAssigned)
+        {
+            splitChunk(
+                std::move(chunk), idealLoad, splitAlongDimension, pieces);
+        }
+        std::stable_sort(
+            pieces.begin(),
+            pieces.end(),
+            [](WrittenChunkInfo const &left, WrittenChunkInfo const &right) {
+                return numberOfElements(left.extent) >
+                    numberOfElements(right.extent);
+            });
+
+        // Greedily assign the largest remaining piece to the rank with the
+        // currently lowest load, taking prior assignments into account.
+        using load_t = std::pair<uint64_t, unsigned int>;
+        std::priority_queue<load_t, std::vector<load_t>, std::greater<load_t>>
+            loads;
+        for (auto const &rank : out)
+        {
+            uint64_t load = 0;
+            if (auto it = res.find(rank.first); it != res.end())
+            {
+                for (auto const &chunk : it->second)
+                {
+                    load += numberOfElements(chunk.extent);
+                }
+            }
+            loads.emplace(load, rank.first);
+        }
+        for (auto &piece : pieces)
+        {
+            auto [load, rank] = loads.top();
+            loads.pop();
+            load += numberOfElements(piece.extent);
+            res[rank].push_back(std::move(piece));
+            loads.emplace(load, rank);
+        }
+        return std::move(res);
+    }
+
+    std::unique_ptr<Strategy> BinPacking::clone() const
+    {
+        return std::make_unique<BinPacking>(*this);
+    }
+
+    ByHostname::ByHostname(std::unique_ptr<Strategy> withinNode)
+        : m_withinNode(std::move(withinNode))
+    {}
+
+    PartialAssignment ByHostname::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &in,
+        RankMeta const &out)
+    {
+        std::map<std::string, RankMeta> readersPerHost;
+        for (auto const &[rank, host] : out)
+        {
+            readersPerHost[host].emplace(rank, host);
+        }
+
+        std::map<std::string, ChunkTable> chunksPerHost;
+        ChunkTable leftover;
+        for (auto &chunk : partialAssignment.notAssigned)
+        {
+            auto writer = in.find(chunk.sourceID);
+            if (writer == in.end() ||
+                readersPerHost.find(writer->second) == readersPerHost.end())
+            {
+                leftover.push_back(std::move(chunk));
+            }
+            else
+            {
+                chunksPerHost[writer->second].push_back(std::move(chunk));
+            }
+        }
+
+        for (auto &[host, chunks] : chunksPerHost)
+        {
+            auto withinNode = m_withinNode->assign(
+                PartialAssignment(std::move(chunks)),
+                in,
+                readersPerHost.at(host));
+            for (auto &[rank, table] : withinNode)
+            {
+                auto &target = partialAssignment.assigned[rank];
+                target.insert(
+                    target.end(),
+                    std::make_move_iterator(table.begin()),
+                    std::make_move_iterator(table.end()));
+            }
+        }
+        partialAssignment.notAssigned = std::move(leftover);
+        return partialAssignment;
+    }
+
+    std::unique_ptr<PartialStrategy> ByHostname::clone() const
+    {
+        return std::make_unique<ByHostname>(m_withinNode->clone());
+    }
+
+    OneDimensionalBlockSlicer::OneDimensionalBlockSlicer(size_t dim)
+        : m_dim(dim)
+    {}
+
+    std::pair<Offset, Extent> OneDimensionalBlockSlicer::sliceBlock(
+        Extent const &totalExtent, int size, int rank)
+    {
+        Offset offset(totalExtent.size(), 0);
+        Extent extent = totalExtent;
+        if (totalExtent.empty() || size <= 0)
+        {
+            return {std::move(offset), std::move(extent)};
+        }
+        size_t dim;
+        if (m_dim.has_value())
+        {
+            dim = *m_dim;
+            if (dim >= totalExtent.size())
+            {
+                throw std::runtime_error(
+                    "[OneDimensionalBlockSlicer] Cannot slice " +
+                    std::to_string(totalExtent.size()) +
+                    "D extent along dimension " + std::to_string(dim) + ".");
+            }
+        }
+        else
+        {
+            dim = std::max_element(totalExtent.begin(), totalExtent.end()) -
+                totalExtent.begin();
+        }
+        if (rank >= size)
+        {
+            extent[dim] = 0;
+            return {std::move(offset), std::move(extent)};
+        }
+
+        // Offset of rank r is the upper gaussian bracket of N/n*r, computed
+        // as (N div n)*r + ceil((N%n)*r/n) to avoid overflow.
+        uint64_t stride = totalExtent[dim] / size;
+        uint64_t rest = totalExtent[dim] % size;
+        auto offsetOf = [stride, rest, size](uint64_t r) {
+            uint64_t padDivident = rest * r;
+            uint64_t pad = padDivident / size;
+            if (pad * size < padDivident)
+            {
+                ++pad;
+            }
+            return stride * r + pad;
+        };
+        offset[dim] = offsetOf(rank);
+        extent[dim] = offsetOf(rank + 1) - offset[dim];
+        return {std::move(offset), std::move(extent)};
+    }
+
+    std::unique_ptr<BlockSlicer> OneDimensionalBlockSlicer::clone() const
+    {
+        return std::make_unique<OneDimensionalBlockSlicer>(*this);
+    }
+
+    ByCuboidSlice::ByCuboidSlice(std::unique_ptr<BlockSlicer> blockSlicer)
+        : m_blockSlicer(std::move(blockSlicer))
+    {}
+
+    Assignment ByCuboidSlice::assign(
+        PartialAssignment partialAssignment,
+        RankMeta const &,
+        RankMeta const &out)
+    {
+        requireReaders(out, "ByCuboidSlice");
+        auto &res = partialAssignment.assigned;
+        auto const &chunks = partialAssignment.notAssigned;
+        if (chunks.empty())
+        {
+            return std::move(res);
+        }
+
+        Extent totalExtent(chunks.front().offset.size(), 0);
+        for (auto const &chunk : chunks)
+        {
+            for (size_t i = 0; i < totalExtent.size(); ++i)
+            {
+                totalExtent[i] = std::max(
+                    totalExtent[i], chunk.offset.at(i) + chunk.extent.at(i));
+            }
+        }
+
+        int size = static_cast<int>(out.size());
+        int index = 0;
+        for (auto const &rank : out)
+        {
+            auto [offset, extent] =
+                m_blockSlicer->sliceBlock(totalExtent, size, index++);
+            for (auto const &chunk : chunks)
+            {
+                if (auto restricted =
+                        restrictToSelection(chunk, offset, extent);
+                    restricted.has_value())
+                {
+                    res[rank.first].push_back(std::move(*restricted));
+                }
+            }
+        }
+        return std::move(res);
+    }
+
+    std::unique_ptr<Strategy> ByCuboidSlice::clone() const
+    {
+        return std::make_unique<ByCuboidSlice>(m_blockSlicer->clone());
+    }
+
+    std::optional<WrittenChunkInfo> restrictToSelection(
+        WrittenChunkInfo const &chunk,
+        Offset const &offset,
+        Extent const &extent)
+    {
+        auto dim = chunk.offset.size();
+        if (chunk.extent.size() != dim || offset.size() != dim ||
+            extent.size() != dim)
+        {
+            throw std::runtime_error(
+                "[restrictToSelection] Dimensionalities of chunk and "
+                "selection do not match.");
+        }
+        Offset resOffset(dim);
+        Extent resExtent(dim);
+        for (size_t i = 0; i < dim; ++i)
+        {
+            auto begin = std::max(chunk.offset[i], offset[i]);
+            auto end = std::min(
+                chunk.offset[i] + chunk.extent[i], offset[i] + extent[i]);
+            if (begin >= end)
+            {
+                return std::nullopt;
+            }
+            resOffset[i] = begin;
+            resExtent[i] = end - begin;
+        }
+        return std::make_optional<WrittenChunkInfo>(
+            std::move(resOffset), std::move(resExtent), chunk.sourceID);
+    }
+} // namespace chunk_assignment
+
 namespace host_info
 {
     constexpr size_t MAX_HOSTNAME_LENGTH = 256;
@@ -45,6 +45,10 @@ Format determineFormat(std::string const &filename)
         return Format::JSON;
     if (auxiliary::ends_with(filename, ".toml"))
         return Format::TOML;
+    if (auxiliary::ends_with(filename, ".shm"))
+        return Format::SHM;
+    if (auxiliary::ends_with(filename, ".mem"))
+        return Format::MEMORY;
     if (auxiliary::ends_with(filename, ".%E"))
         return Format::GENERIC;
 
@@ -72,6 +76,10 @@ std::string suffix(Format f)
         return ".json";
     case Format::TOML:
         return ".toml";
+    case Format::SHM:
+        return ".shm";
+    case Format::MEMORY:
+        return ".mem";
     case Format::GENERIC:
         return ".%E";
     default:
@@ -225,6 +225,7 @@ void ADIOS2File::finalize()
         {
             if (streamStatus == StreamStatus::DuringStep)
             {
+                commitGroupTableDeltas();
                 engine.EndStep();
             }
             engine.Close();
@@ -715,12 +716,9 @@ void ADIOS2File::configure_IO()
 
 auto ADIOS2File::detectGroupTable() -> UseGroupTable
 {
-    auto const &attributes = availableAttributes();
-    auto lower_bound =
-        attributes.lower_bound(adios_defaults::str_activeTablePrefix);
-    if (lower_bound != attributes.end() &&
-        auxiliary::starts_with(
-            lower_bound->first, adios_defaults::str_activeTablePrefix))
+    if (!availableAttributes()
+             .children(adios_defaults::str_activeTablePrefix)
+             .empty())
     {
         return UseGroupTable::Yes;
     }
@@ -975,6 +973,22 @@ void ADIOS2File::flush_impl(
         if (m_impl->m_writeAttributesFromThisRank)
         {
             m_IO.DefineAttribute<uint64_t>(adios_defaults::str_adios2Schema, 0);
+            bool statistics = true;
+            for (auto const &[key, value] : m_IO.Parameters())
+            {
+                if (auxiliary::lowerCase(std::string(key)) == "statslevel" &&
+                    value == "0")
+                {
+                    statistics = false;
+                }
+            }
+            if (statistics &&
+                !m_IO.InquireAttribute<bool_representation>(
+                    adios_defaults::str_blockStatistics))
+            {
+                m_IO.DefineAttribute<bool_representation>(
+                    adios_defaults::str_blockStatistics, 1);
+            }
         }
         initializedDefaults = true;
     }
@@ -1185,6 +1199,7 @@ AdvanceStatus ADIOS2File::advance(AdvanceMode mode)
                 adios_defaults::str_usesstepsAttribute, 1);
         }
 
+        commitGroupTableDeltas();
         flush(
             ADIOS2FlushParams{FlushLevel::UserFlush},
             [](ADIOS2File &, adios2::Engine &eng) { eng.EndStep(); },
@@ -1238,76 +1253,61 @@ void ADIOS2File::drop()
     assert(m_buffer.empty());
 }
 
-static std::vector<std::string> availableAttributesOrVariablesPrefixed(
-    std::string const &prefix,
-    ADIOS2File::AttributeMap_t const &(ADIOS2File::*getBasicMap)(),
-    ADIOS2File &ba)
-{
-    std::string var = auxiliary::ends_with(prefix, '/') ? prefix : prefix + '/';
-    ADIOS2File::AttributeMap_t const &attributes = (ba.*getBasicMap)();
-    std::vector<std::string> ret;
-    for (auto it = attributes.lower_bound(prefix); it != attributes.end(); ++it)
-    {
-        if (auxiliary::starts_with(it->first, var))
-        {
-            ret.emplace_back(auxiliary::replace_first(it->first, var, ""));
-        }
-        else
-        {
-            break;
-        }
-    }
-    return ret;
-}
-
 std::vector<std::string>
 ADIOS2File::availableAttributesPrefixed(std::string const &prefix)
 {
-    return availableAttributesOrVariablesPrefixed(
-        prefix, &ADIOS2File::availableAttributes, *this);
+    return availableAttributes().descendants(prefix);
 }
 
 std::vector<std::string>
 ADIOS2File::availableVariablesPrefixed(std::string const &prefix)
 {
-    return availableAttributesOrVariablesPrefixed(
-        prefix, &ADIOS2File::availableVariables, *this);
+    return availableVariables().descendants(prefix);
 }
 
 void ADIOS2File::invalidateAttributesMap()
 {
-    m_availableAttributes = std::optional<AttributeMap_t>();
+    m_availableAttributes = std::optional<auxiliary::PathTrie>();
 }
 
-ADIOS2File::AttributeMap_t const &ADIOS2File::availableAttributes()
+auxiliary::PathTrie const &ADIOS2File::availableAttributes()
 {
-    if (m_availableAttributes)
-    {
-        return m_availableAttributes.value();
-    }
-    else
+    if (!m_availableAttributes)
     {
-        m_availableAttributes = std::make_optional(m_IO.AvailableAttributes());
-        return m_availableAttributes.value();
+        // ADIOS2 has no names-only query for attributes, the values it
+        // stringifies are dropped right away
+        auxiliary::PathTrie index;
+        for (auto const &pair : m_IO.AvailableAttributes())
+        {
+            index.insert(pair.first);
+        }
+        m_availableAttributes = std::move(index);
     }
+    return m_availableAttributes.value();
 }
 
 void ADIOS2File::invalidateVariablesMap()
 {
-    m_availableVariables = std::optional<AttributeMap_t>();
+    m_availableVariables = std::optional<auxiliary::PathTrie>();
 }
 
-ADIOS2File::AttributeMap_t const &ADIOS2File::availableVariables()
+auxiliary::PathTrie const &ADIOS2File::availableVariables()
 {
-    if (m_availableVariables)
-    {
-        return m_availableVariables.value();
-    }
-    else
+    if (!m_availableVariables)
     {
-        m_availableVariables = std::make_optional(m_IO.AvailableVariables());
-        return m_availableVariables.value();
+        auxiliary::PathTrie index;
+#if openPMD_HAS_ADIOS_2_9
+        for (auto const &pair :
+             m_IO.AvailableVariables(/* namesOnly = */ true))
+#else
+        for (auto const &pair : m_IO.AvailableVariables())
+#endif
+        {
+            index.insert(pair.first);
+        }
+        m_availableVariables = std::move(index);
     }
+    return m_availableVariables.value();
 }
 
 void ADIOS2File::markActive(Writable *writable)
@@ -1321,20 +1321,39 @@ void ADIOS2File::markActive(Writable *writable)
     {
         if (writeOnly(m_mode) && m_impl->m_writeAttributesFromThisRank)
         {
+            bool const deltas = m_impl->m_deltaMetadata;
+            if (deltas &&
+                !m_IO.InquireAttribute<bool_representation>(
+                    adios_defaults::str_groupTableDeltas))
+            {
+                m_IO.DefineAttribute<bool_representation>(
+                    adios_defaults::str_groupTableDeltas, 1);
+            }
             auto currentStepBuffered = currentStep();
             do
             {
                 using attr_t = unsigned long long;
                 auto filePos = m_impl->setAndGetFilePosition(
                     writable, /* write = */ false);
-                auto fullPath =
-                    adios_defaults::str_activeTablePrefix + filePos->location;
-                m_IO.DefineAttribute<attr_t>(
-                    fullPath,
-                    currentStepBuffered,
-                    /* variableName = */ "",
-                    /* separator = */ "/",
-                    /* allowModification = */ true);
+                bool announce = true;
+                if (deltas)
+                {
+                    m_groupTableMarked.emplace(filePos->location);
+                    // already announced as present in an earlier step?
+                    announce =
+                        m_groupTableActive.emplace(filePos->location).second;
+                }
+                if (announce)
+                {
+                    auto fullPath = adios_defaults::str_activeTablePrefix +
+                        filePos->location;
+                    m_IO.DefineAttribute<attr_t>(
+                        fullPath,
+                        currentStepBuffered,
+                        /* variableName = */ "",
+                        /* separator = */ "/",
+                        /* allowModification = */ true);
+                }
                 m_pathsMarkedAsActive.emplace(writable);
                 writable = writable->parent;
             } while (writable &&
@@ -1351,5 +1370,33 @@ void ADIOS2File::markActive(Writable *writable)
     break;
     }
 }
+
+void ADIOS2File::commitGroupTableDeltas()
+{
+    if (!m_impl->m_deltaMetadata || useGroupTable() == UseGroupTable::No ||
+        !writeOnly(m_mode) || !m_impl->m_writeAttributesFromThisRank)
+    {
+        return;
+    }
+#if openPMD_HAS_ADIOS_2_9
+    for (auto it = m_groupTableActive.begin(); it != m_groupTableActive.end();)
+    {
+        if (m_groupTableMarked.find(*it) != m_groupTableMarked.end())
+        {
+            ++it;
+            continue;
+        }
+        m_IO.DefineAttribute<unsigned long long>(
+            adios_defaults::str_activeTablePrefix + *it,
+            adios_defaults::group_table_inactive,
+            /* variableName = */ "",
+            /* separator = */ "/",
+            /* allowModification = */ true);
+        it = m_groupTableActive.erase(it);
+    }
+#endif
+    m_groupTableMarked.clear();
+    m_pathsMarkedAsActive.clear();
+}
 } // namespace openPMD::detail
 #endif
@@ -28,18 +28,22 @@
 #include "openPMD/IO/ADIOS/ADIOS2FilePosition.hpp"
 #include "openPMD/IO/ADIOS/ADIOS2IOHandler.hpp"
 #include "openPMD/IterationEncoding.hpp"
+#include "openPMD/auxiliary/Codec.hpp"
 #include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/JSON_internal.hpp"
+#include "openPMD/auxiliary/Memory.hpp"
 #include "openPMD/auxiliary/Mpi.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/auxiliary/TypeTraits.hpp"
 
 #include <algorithm>
 #include <cctype> // std::tolower
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <sstream>
 #include <stdexcept>
@@ -239,6 +243,17 @@ void ADIOS2IOHandlerImpl::init(
                 : ModifiableAttributes::No;
         }
 
+        if (m_config.json().contains("delta_metadata"))
+        {
+            auto deltaMetadata = m_config["delta_metadata"].json();
+            if (!deltaMetadata.is_boolean())
+            {
+                throw error::BackendConfigSchema(
+                    {"adios2", "delta_metadata"}, "Must be a boolean value.");
+            }
+            m_deltaMetadata = deltaMetadata.get<bool>();
+        }
+
         if (m_config.json().contains("attribute_writing_ranks"))
         {
             callbackWriteAttributesFromRank(
@@ -788,8 +803,7 @@ void ADIOS2IOHandlerImpl::createDataset(
         auto const varName = nameOfVariable(writable);
 
         std::vector<ParameterizedOperator> operators;
-        json::TracingJSON options =
-            json::parseOptions(parameters.options, /* considerFiles = */ false);
+        json::TracingJSON options{*parameters.getParsedOptions()};
         if (options.json().contains("adios2"))
         {
             json::TracingJSON datasetConfig(options["adios2"]);
@@ -802,6 +816,39 @@ void ADIOS2IOHandlerImpl::createDataset(
         {
             operators = defaultOperators;
         }
+        /*
+         * Explicitly configured operators take precedence over the dataset
+         * option "codec". Otherwise, it maps to its nearest ADIOS2 operator.
+         * Shuffling alone has no use without compression and is ignored.
+         */
+        if (auto codec = parameters.getCodec();
+            codec.has_value() && codec->compress && operators.empty())
+        {
+            if (auto blosc = getCompressionOperator("blosc"); blosc.has_value())
+            {
+                char const *shuffle = "BLOSC_NOSHUFFLE";
+                switch (codec->shuffle)
+                {
+                case auxiliary::Codec::Shuffle::None:
+                    break;
+                case auxiliary::Codec::Shuffle::Byte:
+                    shuffle = "BLOSC_SHUFFLE";
+                    break;
+                case auxiliary::Codec::Shuffle::Bit:
+                    shuffle = "BLOSC_BITSHUFFLE";
+                    break;
+                }
+                operators.push_back(ParameterizedOperator{
+                    *blosc, {{"compressor", "lz4"}, {"doshuffle", shuffle}}});
+            }
+            else
+            {
+                std::cerr << "[ADIOS2] The dataset option 'codec' needs "
+                             "ADIOS2 built with Blosc, dataset '"
+                          << varName << "' will not be compressed."
+                          << std::endl;
+            }
+        }
         parameters.warnUnusedParameters(
             options,
             "adios2",
@@ -1213,6 +1260,99 @@ void ADIOS2IOHandlerImpl::getBufferView(
     }
 }
 
+namespace detail
+{
+    struct GetInlineView
+    {
+        template <typename T>
+        static void call(
+            Parameter<Operation::READ_DATASET_VIEW> &params,
+            adios2::IO &IO,
+            adios2::Engine &engine,
+            std::string const &varName)
+        {
+            auto variable = IO.InquireVariable<T>(varName);
+            if (!variable)
+            {
+                return;
+            }
+            /*
+             * The Inline engine exposes the writer's buffers through the
+             * blocks info. Serve the view from the block that contains the
+             * selection, if the selection is contiguous within that block.
+             */
+            auto blocksInfo =
+                engine.BlocksInfo<T>(variable, engine.CurrentStep());
+            for (auto const &info : blocksInfo)
+            {
+                if (info.IsValue || info.Data() == nullptr ||
+                    info.Start.size() != params.offset.size())
+                {
+                    continue;
+                }
+                Offset relativeOffset(params.offset.size());
+                bool contained = true;
+                for (size_t i = 0; i < params.offset.size(); ++i)
+                {
+                    if (params.offset[i] < info.Start[i])
+                    {
+                        contained = false;
+                        break;
+                    }
+                    relativeOffset[i] = params.offset[i] - info.Start[i];
+                }
+                if (!contained)
+                {
+                    continue;
+                }
+                auto firstElement = auxiliary::contiguousSelectionStart(
+                    Extent(info.Count.begin(), info.Count.end()),
+                    relativeOffset,
+                    params.extent);
+                if (!firstElement.has_value())
+                {
+                    continue;
+                }
+                params.out->ptr = info.Data() + *firstElement;
+                params.out->backendManagedBuffer = true;
+                return;
+            }
+        }
+
+        template <int n, typename... Args>
+        static void call(Args &&...)
+        {
+            // no zero-copy views for this type
+        }
+    };
+} // namespace detail
+
+void ADIOS2IOHandlerImpl::readDatasetView(
+    Writable *writable, Parameter<Operation::READ_DATASET_VIEW> &parameters)
+{
+    parameters.out->backendManagedBuffer = false;
+    /*
+     * Other engines do not lend their read buffers through the public
+     * ADIOS2 API, so only the Inline engine supports zero-copy reads.
+     */
+    if (realEngineType() != "inline" || parameters.dtype == Datatype::BOOL ||
+        parameters.dtype == Datatype::CLONG_DOUBLE)
+    {
+        return;
+    }
+    setAndGetFilePosition(writable);
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    detail::ADIOS2File &ba = getFileData(file, IfFileNotOpen::ThrowError);
+    if (ba.m_mode != adios2::Mode::Read)
+    {
+        return;
+    }
+    std::string varName = nameOfVariable(writable);
+    auto &engine = ba.getEngine();
+    switchAdios2VariableType<detail::GetInlineView>(
+        parameters.dtype, parameters, ba.m_IO, engine, varName);
+}
+
 namespace detail
 {
     template <typename T>
@@ -1289,30 +1429,22 @@ void ADIOS2IOHandlerImpl::listPaths(
     switch (useGroupTable())
     {
     case UseGroupTable::No: {
-        std::vector<std::string> vars =
-            fileData.availableVariablesPrefixed(myName);
-        for (auto var : vars)
+        for (auto &var : fileData.availableVariables().children(myName))
         {
-            auto firstSlash = var.find_first_of('/');
-            if (firstSlash != std::string::npos)
+            if (var.hasChildren)
             {
-                var = var.substr(0, firstSlash);
-                subdirs.emplace(std::move(var));
+                subdirs.emplace(var.name);
             }
-            else
+            if (var.isEntry)
             { // var is a dataset at the current level
-                delete_me.push_back(std::move(var));
+                delete_me.push_back(std::move(var.name));
             }
         }
-        std::vector<std::string> attributes =
-            fileData.availableAttributesPrefixed(myName);
-        for (auto attr : attributes)
+        for (auto &attr : fileData.availableAttributes().children(myName))
         {
-            auto firstSlash = attr.find_first_of('/');
-            if (firstSlash != std::string::npos)
+            if (attr.hasChildren)
             {
-                attr = attr.substr(0, firstSlash);
-                subdirs.emplace(std::move(attr));
+                subdirs.emplace(std::move(attr.name));
             }
         }
         break;
@@ -1320,12 +1452,26 @@ void ADIOS2IOHandlerImpl::listPaths(
     case UseGroupTable::Yes: {
         {
             auto tablePrefix = adios_defaults::str_activeTablePrefix + myName;
-            std::vector attrs =
-                fileData.availableAttributesPrefixed(tablePrefix);
+            // groups directly within the current group
+            std::vector<std::string> attrs;
+            for (auto &attr :
+                 fileData.availableAttributes().children(tablePrefix))
+            {
+                if (attr.isEntry)
+                {
+                    attrs.push_back(std::move(attr.name));
+                }
+            }
             if (fileData.streamStatus ==
                 detail::ADIOS2File::StreamStatus::DuringStep)
             {
                 auto currentStep = fileData.currentStep();
+                // in delta mode, the table stores the step since which a
+                // group is present and is only updated when it disappears
+                bool const deltas =
+                    static_cast<bool>(fileData.m_IO.InquireAttribute<
+                                      detail::bool_representation>(
+                        adios_defaults::str_groupTableDeltas));
                 for (auto const &attrName : attrs)
                 {
                     using table_t = unsigned long long;
@@ -1340,28 +1486,22 @@ void ADIOS2IOHandlerImpl::listPaths(
                                   << std::endl;
                         continue;
                     }
-                    if (attr.Data()[0] != currentStep)
+                    if (deltas
+                            ? attr.Data()[0] ==
+                                adios_defaults::group_table_inactive
+                            : attr.Data()[0] != currentStep)
                     {
                         // group wasn't defined in current step
                         continue;
                     }
-                    auto firstSlash = attrName.find_first_of('/');
-                    if (firstSlash == std::string::npos)
-                    {
-                        subdirs.emplace(attrName);
-                    }
-                    // else // should we maybe consider deeper groups too?
+                    subdirs.emplace(attrName);
                 }
             }
             else
             {
                 for (auto const &attrName : attrs)
                 {
-                    auto firstSlash = attrName.find_first_of('/');
-                    if (firstSlash == std::string::npos)
-                    {
-                        subdirs.emplace(attrName);
-                    }
+                    subdirs.emplace(attrName);
                 }
             }
         }
@@ -1403,16 +1543,12 @@ void ADIOS2IOHandlerImpl::listDatasets(
     auto &fileData = getFileData(file, IfFileNotOpen::ThrowError);
 
     std::unordered_set<std::string> subdirs;
-    for (auto var : fileData.availableVariablesPrefixed(myName))
+    for (auto &var : fileData.availableVariables().children(myName))
     {
-        // if string still contains a slash, variable is a dataset below the
-        // current group
         // we only want datasets contained directly within the current group
-        // let's ensure that
-        auto firstSlash = var.find_first_of('/');
-        if (firstSlash == std::string::npos)
+        if (var.isEntry)
         {
-            subdirs.emplace(std::move(var));
+            subdirs.emplace(std::move(var.name));
         }
     }
     for (auto &dataset : subdirs)
@@ -1437,15 +1573,11 @@ void ADIOS2IOHandlerImpl::listAttributes(
     }
     auto &ba = getFileData(file, IfFileNotOpen::ThrowError);
 
-    std::vector<std::string> attrs =
-        ba.availableAttributesPrefixed(attributePrefix);
-
-    for (auto &rawAttr : attrs)
+    for (auto &attr : ba.availableAttributes().children(attributePrefix))
     {
-        auto attr = auxiliary::removeSlashes(rawAttr);
-        if (attr.find_last_of('/') == std::string::npos)
+        if (attr.isEntry)
         {
-            parameters.attributes->push_back(std::move(attr));
+            parameters.attributes->push_back(std::move(attr.name));
         }
     }
 }
@@ -1501,13 +1633,28 @@ void ADIOS2IOHandlerImpl::availableChunks(
     auto datatype = detail::fromADIOS2Type(ba.m_IO.VariableType(varName));
     bool allSteps = ba.m_mode != adios2::Mode::Read &&
         ba.streamStatus == detail::ADIOS2File::StreamStatus::ReadWithoutStream;
+    /*
+     * Per-block min/max values are only meaningful if the writer did not
+     * disable them via StatsLevel=0, which it records in the file.
+     * Files from other writers get no statistics, so that range-filtered
+     * loads fall back to loading all chunks instead of skipping some.
+     */
+    bool withStatistics = false;
+    if (auto attr = ba.m_IO.InquireAttribute<detail::bool_representation>(
+            adios_defaults::str_blockStatistics);
+        attr)
+    {
+        auto data = attr.Data();
+        withStatistics = !data.empty() && data.front() != 0;
+    }
     switchAdios2VariableType<detail::RetrieveBlocksInfo>(
         datatype,
         parameters,
         ba.m_IO,
         engine,
         varName,
-        /* allSteps = */ allSteps);
+        /* allSteps = */ allSteps,
+        withStatistics);
 }
 
 void ADIOS2IOHandlerImpl::deregister(
@@ -1917,6 +2064,17 @@ namespace detail
                 filedata.uncommittedAttributes.emplace(fullName);
             }
         }
+#if openPMD_HAS_ADIOS_2_9
+        else if (
+            impl->m_deltaMetadata && !IO.AttributeType(fullName).empty() &&
+            AttributeTypes<T>::attributeUnchanged(
+                IO, fullName, std::get<T>(parameters.resource)))
+        {
+            // modifiable attributes keep their value over steps,
+            // redefining them would send them anew in this step
+            return;
+        }
+#endif
 
         auto &value = std::get<T>(parameters.resource);
 #if openPMD_HAS_ADIOS_2_9
@@ -2089,11 +2247,12 @@ namespace detail
         adios2::IO &IO,
         adios2::Engine &engine,
         std::string const &varName,
-        bool allSteps)
+        bool allSteps,
+        [[maybe_unused]] bool withStatistics)
     {
         auto var = IO.InquireVariable<T>(varName);
         auto &table = *params.chunks;
-        auto addBlocksInfo = [&table](auto const &blocksInfo_) {
+        auto addBlocksInfo = [&table, withStatistics](auto const &blocksInfo_) {
             for (auto const &info : blocksInfo_)
             {
                 Offset offset;
@@ -2106,8 +2265,24 @@ namespace detail
                     offset.push_back(info.Start[i]);
                     extent.push_back(info.Count[i]);
                 }
-                table.emplace_back(
+                uint64_t count = std::accumulate(
+                    extent.begin(),
+                    extent.end(),
+                    uint64_t(1),
+                    std::multiplies<uint64_t>());
+                auto &chunk = table.emplace_back(
                     std::move(offset), std::move(extent), info.WriterID);
+                if constexpr (
+                    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+                {
+                    if (withStatistics)
+                    {
+                        chunk.statistics = ChunkStatistics(
+                            static_cast<double>(info.Min),
+                            static_cast<double>(info.Max),
+                            count);
+                    }
+                }
             }
         };
         if (allSteps)
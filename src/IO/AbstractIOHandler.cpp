@@ -22,9 +22,20 @@
 #include "openPMD/IO/AbstractIOHandler.hpp"
 
 #include "openPMD/IO/FlushParametersInternal.hpp"
+#include "openPMD/auxiliary/Filesystem.hpp"
 
 namespace openPMD
 {
+std::optional<std::vector<std::string>>
+AbstractIOHandler::listDirectory(std::string const &dir) const
+{
+    if (!auxiliary::directory_exists(dir))
+    {
+        return std::nullopt;
+    }
+    return auxiliary::list_directory(dir);
+}
+
 std::future<void> AbstractIOHandler::flush(internal::FlushParams const &params)
 {
     internal::ParsedFlushParams parsedParams{params};
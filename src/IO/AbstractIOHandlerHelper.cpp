@@ -28,6 +28,8 @@
 #include "openPMD/IO/HDF5/HDF5IOHandler.hpp"
 #include "openPMD/IO/HDF5/ParallelHDF5IOHandler.hpp"
 #include "openPMD/IO/JSON/JSONIOHandler.hpp"
+#include "openPMD/IO/Memory/MemoryIOHandler.hpp"
+#include "openPMD/IO/SharedMemory/SharedMemoryIOHandler.hpp"
 #include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/auxiliary/JSON_internal.hpp"
 
@@ -142,6 +144,21 @@ std::unique_ptr<AbstractIOHandler> createIOHandler<json::TracingJSON>(
             std::move(options),
             JSONIOHandlerImpl::FileFormat::Toml,
             std::move(originalExtension));
+    case Format::SHM:
+        return constructIOHandler<SharedMemoryIOHandler, openPMD_HAVE_SHM>(
+            "SHM",
+            std::move(path),
+            access,
+            comm,
+            std::move(options),
+            std::move(originalExtension));
+    case Format::MEMORY:
+        return std::make_unique<MemoryIOHandler>(
+            std::move(path),
+            access,
+            comm,
+            std::move(options),
+            std::move(originalExtension));
     default:
         throw error::WrongAPIUsage(
             "Unknown file format! Did you specify a file ending? Specified "
@@ -222,6 +239,19 @@ std::unique_ptr<AbstractIOHandler> createIOHandler<json::TracingJSON>(
             std::move(options),
             JSONIOHandlerImpl::FileFormat::Toml,
             std::move(originalExtension));
+    case Format::SHM:
+        return constructIOHandler<SharedMemoryIOHandler, openPMD_HAVE_SHM>(
+            "SHM",
+            std::move(path),
+            access,
+            std::move(options),
+            std::move(originalExtension));
+    case Format::MEMORY:
+        return std::make_unique<MemoryIOHandler>(
+            std::move(path),
+            access,
+            std::move(options),
+            std::move(originalExtension));
     default:
         throw std::runtime_error(
             "Unknown file format! Did you specify a file ending? Specified "
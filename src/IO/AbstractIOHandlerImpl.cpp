@@ -24,7 +24,9 @@
 #include "openPMD/auxiliary/Environment.hpp"
 #include "openPMD/backend/Writable.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
@@ -108,11 +110,30 @@ std::future<void> AbstractIOHandlerImpl::flush()
 {
     using namespace auxiliary;
 
-    while (!(*m_handler).m_work.empty())
+    auto &work = m_handler->m_work;
+#if openPMD_HAVE_MPI
+    std::optional<internal::CollectiveMetadataFlush> collective;
+    if (m_handler->m_metadataCommunicator.has_value())
     {
-        IOTask &i = (*m_handler).m_work.front();
+        collective.emplace(
+            *this,
+            m_collectiveMetadataCache,
+            *m_handler->m_metadataCommunicator,
+            work);
+    }
+#endif
+    while (!work.empty())
+    {
+        IOTask &i = work.front();
         try
         {
+#if openPMD_HAVE_MPI
+            if (collective.has_value() && collective->intercept(i))
+            {
+                work.pop();
+                continue;
+            }
+#endif
             switch (i.operation)
             {
                 using O = Operation;
@@ -331,6 +352,19 @@ std::future<void> AbstractIOHandlerImpl::flush()
                 getBufferView(i.writable, parameter);
                 break;
             }
+            case O::READ_DATASET_VIEW: {
+                auto &parameter =
+                    deref_dynamic_cast<Parameter<O::READ_DATASET_VIEW>>(
+                        i.parameter.get());
+                writeToStderr(
+                    "[",
+                    i.writable->parent,
+                    "->",
+                    i.writable,
+                    "] READ_DATASET_VIEW");
+                readDatasetView(i.writable, parameter);
+                break;
+            }
             case O::READ_ATT: {
                 auto &parameter = deref_dynamic_cast<Parameter<O::READ_ATT>>(
                     i.parameter.get());
@@ -437,19 +471,45 @@ std::future<void> AbstractIOHandlerImpl::flush()
                 setWritten(i.writable, parameter);
                 break;
             }
+            case O::PREFETCH_FILE: {
+                auto &parameter =
+                    deref_dynamic_cast<Parameter<O::PREFETCH_FILE>>(
+                        i.parameter.get());
+                writeToStderr(
+                    "[",
+                    i.writable->parent,
+                    "->",
+                    i.writable,
+                    "] PREFETCH_FILE: ",
+                    parameter.name);
+                prefetchFile(i.writable, parameter);
+                break;
+            }
+            }
+#if openPMD_HAVE_MPI
+            if (collective.has_value())
+            {
+                collective->record(i);
             }
+#endif
         }
         catch (...)
         {
-            auto base_handler = [&i, this]() {
+#if openPMD_HAVE_MPI
+            if (collective.has_value())
+            {
+                collective->exchange(/* failedLocally = */ true);
+            }
+#endif
+            auto base_handler = [&i, &work]() {
                 std::cerr << "[AbstractIOHandlerImpl] IO Task "
                           << internal::operationAsString(i.operation)
                           << " failed with exception. Clearing IO queue and "
                              "passing on the exception."
                           << std::endl;
-                while (!m_handler->m_work.empty())
+                while (!work.empty())
                 {
-                    m_handler->m_work.pop();
+                    work.pop();
                 }
             };
 
@@ -480,8 +540,14 @@ std::future<void> AbstractIOHandlerImpl::flush()
                 throw;
             }
         }
-        (*m_handler).m_work.pop();
+        work.pop();
+    }
+#if openPMD_HAVE_MPI
+    if (collective.has_value())
+    {
+        collective->exchange(/* failedLocally = */ false);
     }
+#endif
     return std::future<void>();
 }
 
@@ -490,4 +556,71 @@ void AbstractIOHandlerImpl::setWritten(
 {
     w->written = param.target_status;
 }
+
+void AbstractIOHandlerImpl::prefetchFile(
+    Writable *, Parameter<Operation::PREFETCH_FILE> const &)
+{
+    // purely advisory, default implementation does nothing
+}
+
+void AbstractIOHandlerImpl::getPooledBufferView(
+    Writable *writable, Parameter<Operation::GET_BUFFER_VIEW> &parameters)
+{
+    if (parameters.update)
+    {
+        // pooled buffers do not move, parameters.out->ptr is still valid
+        return;
+    }
+    if (access::readOnly(m_handler->m_backendAccess))
+    {
+        parameters.out->backendManagedBuffer = false;
+        return;
+    }
+    size_t numElements = 1;
+    for (auto ext : parameters.extent)
+    {
+        numElements *= ext;
+    }
+    auto buffer =
+        m_bufferPool.acquire(numElements * toBytes(parameters.dtype));
+    parameters.out->ptr = buffer.get();
+    parameters.out->backendManagedBuffer = true;
+
+    Parameter<Operation::WRITE_DATASET> write;
+    write.offset = parameters.offset;
+    write.extent = parameters.extent;
+    write.dtype = parameters.dtype;
+    write.data = auxiliary::WriteBuffer(std::move(buffer));
+    m_pooledBufferViews.emplace_back(writable, std::move(write));
+}
+
+void AbstractIOHandlerImpl::writePooledBufferViews()
+{
+    auto views = std::move(m_pooledBufferViews);
+    m_pooledBufferViews.clear();
+    for (auto &[writable, parameter] : views)
+    {
+        writeToStderr(
+            "[",
+            writable->parent,
+            "->",
+            writable,
+            "] WRITE_DATASET (pooled buffer view), offset=",
+            [&parameter]() { return vec_as_string(parameter.offset); },
+            ", extent=",
+            [&parameter]() { return vec_as_string(parameter.extent); });
+        writeDataset(writable, parameter);
+    }
+    // the buffers return to the pool when views goes out of scope
+}
+
+void AbstractIOHandlerImpl::forgetPooledBufferViews(Writable *writable)
+{
+    m_pooledBufferViews.erase(
+        std::remove_if(
+            m_pooledBufferViews.begin(),
+            m_pooledBufferViews.end(),
+            [writable](auto const &view) { return view.first == writable; }),
+        m_pooledBufferViews.end());
+}
 } // namespace openPMD
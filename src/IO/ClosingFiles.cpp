@@ -0,0 +1,104 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/ClosingFiles.hpp"
+
+#include <chrono>
+#include <exception>
+#include <iostream>
+
+namespace openPMD::internal
+{
+ClosingFiles::~ClosingFiles()
+{
+    for (auto &[name, task] : m_tasks)
+    {
+        try
+        {
+            task.get();
+        }
+        catch (std::exception const &e)
+        {
+            std::cerr << "[Warning] Failed closing file '" << name
+                      << "' in the background: " << e.what() << std::endl;
+        }
+        catch (...)
+        {
+            std::cerr << "[Warning] Failed closing file '" << name
+                      << "' in the background." << std::endl;
+        }
+    }
+}
+
+void ClosingFiles::close(
+    std::string name, std::function<void()> task, unsigned maxInFlight)
+{
+    // the task leaves the queue before its error is rethrown
+    while (!m_tasks.empty() && m_tasks.size() + 1 > maxInFlight)
+    {
+        auto oldest = std::move(m_tasks.front().second);
+        m_tasks.pop_front();
+        oldest.get();
+    }
+    m_tasks.emplace_back(
+        std::move(name), std::async(std::launch::async, std::move(task)));
+}
+
+void ClosingFiles::await(std::string const &name)
+{
+    for (auto it = m_tasks.begin(); it != m_tasks.end();)
+    {
+        if (it->first != name)
+        {
+            ++it;
+            continue;
+        }
+        auto task = std::move(it->second);
+        it = m_tasks.erase(it);
+        task.get();
+    }
+}
+
+void ClosingFiles::awaitAll()
+{
+    while (!m_tasks.empty())
+    {
+        auto oldest = std::move(m_tasks.front().second);
+        m_tasks.pop_front();
+        oldest.get();
+    }
+}
+
+void ClosingFiles::reapFinished()
+{
+    for (auto it = m_tasks.begin(); it != m_tasks.end();)
+    {
+        if (it->second.wait_for(std::chrono::seconds(0)) !=
+            std::future_status::ready)
+        {
+            ++it;
+            continue;
+        }
+        auto task = std::move(it->second);
+        it = m_tasks.erase(it);
+        task.get();
+    }
+}
+} // namespace openPMD::internal
@@ -0,0 +1,576 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/IO/CollectiveMetadata.hpp"
+
+#if openPMD_HAVE_MPI
+#include "openPMD/IO/AbstractIOHandlerImpl.hpp"
+#include "openPMD/auxiliary/DerefDynamicCast.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/auxiliary/TypeTraits.hpp"
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace openPMD::internal
+{
+namespace
+{
+    template <typename T>
+    struct IsOptional : std::false_type
+    {};
+    template <typename T>
+    struct IsOptional<std::optional<T>> : std::true_type
+    {};
+
+    struct Serializer
+    {
+        std::vector<char> &buffer;
+
+        template <typename T>
+        void operator()(T const &val)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                auto begin = reinterpret_cast<char const *>(&val);
+                buffer.insert(buffer.end(), begin, begin + sizeof(T));
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                (*this)(uint64_t(val.size()));
+                buffer.insert(buffer.end(), val.begin(), val.end());
+            }
+            else if constexpr (auxiliary::IsVector_v<T>)
+            {
+                (*this)(uint64_t(val.size()));
+                if constexpr (std::is_trivially_copyable_v<
+                                  typename T::value_type>)
+                {
+                    auto begin = reinterpret_cast<char const *>(val.data());
+                    buffer.insert(
+                        buffer.end(),
+                        begin,
+                        begin + val.size() * sizeof(typename T::value_type));
+                }
+                else
+                {
+                    for (auto const &entry : val)
+                    {
+                        (*this)(entry);
+                    }
+                }
+            }
+            else if constexpr (IsOptional<T>::value)
+            {
+                (*this)(val.has_value());
+                if (val.has_value())
+                {
+                    (*this)(*val);
+                }
+            }
+            else if constexpr (std::is_same_v<T, RecordedError>)
+            {
+                (*this)(val.kind);
+                (*this)(val.what);
+                (*this)(val.affectedObject);
+                (*this)(val.reason);
+                (*this)(val.backend);
+                (*this)(val.description);
+            }
+            else if constexpr (std::is_same_v<T, CachedAttribute>)
+            {
+                (*this)(val.error);
+                if (!val.error.has_value())
+                {
+                    (*this)(val.dtype);
+                    (*this)(uint64_t(val.value.index()));
+                    std::visit(
+                        [this](auto const &v) { (*this)(v); }, val.value);
+                }
+            }
+            else
+            {
+                static_assert(
+                    auxiliary::dependent_false_v<T>, "Cannot serialize type.");
+            }
+        }
+    };
+
+    struct Deserializer
+    {
+        char const *pos;
+        char const *end;
+
+        void require(size_t bytes)
+        {
+            if (size_t(end - pos) < bytes)
+            {
+                throw error::Internal(
+                    "[CollectiveMetadata] Received truncated metadata.");
+            }
+        }
+
+        template <typename T>
+        T get()
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                require(sizeof(T));
+                T res;
+                std::memcpy(&res, pos, sizeof(T));
+                pos += sizeof(T);
+                return res;
+            }
+            else if constexpr (std::is_same_v<T, std::string>)
+            {
+                auto size = get<uint64_t>();
+                require(size);
+                std::string res(pos, size);
+                pos += size;
+                return res;
+            }
+            else if constexpr (auxiliary::IsVector_v<T>)
+            {
+                using value_type = typename T::value_type;
+                auto size = get<uint64_t>();
+                T res;
+                if constexpr (std::is_trivially_copyable_v<value_type>)
+                {
+                    require(size * sizeof(value_type));
+                    res.resize(size);
+                    std::memcpy(res.data(), pos, size * sizeof(value_type));
+                    pos += size * sizeof(value_type);
+                }
+                else
+                {
+                    res.reserve(size);
+                    for (uint64_t i = 0; i < size; ++i)
+                    {
+                        res.push_back(get<value_type>());
+                    }
+                }
+                return res;
+            }
+            else if constexpr (IsOptional<T>::value)
+            {
+                if (get<bool>())
+                {
+                    return T{get<typename T::value_type>()};
+                }
+                return T{};
+            }
+            else if constexpr (std::is_same_v<T, RecordedError>)
+            {
+                RecordedError res;
+                res.kind = get<RecordedError::Kind>();
+                res.what = get<std::string>();
+                res.affectedObject = get<error::AffectedObject>();
+                res.reason = get<error::Reason>();
+                res.backend = get<std::optional<std::string>>();
+                res.description = get<std::string>();
+                return res;
+            }
+            else if constexpr (std::is_same_v<T, CachedAttribute>)
+            {
+                CachedAttribute res;
+                res.error = get<std::optional<RecordedError>>();
+                if (!res.error.has_value())
+                {
+                    res.dtype = get<Datatype>();
+                    res.value = getResource(
+                        get<uint64_t>(),
+                        std::make_index_sequence<
+                            std::variant_size_v<Attribute::resource>>{});
+                }
+                return res;
+            }
+            else
+            {
+                static_assert(
+                    auxiliary::dependent_false_v<T>,
+                    "Cannot deserialize type.");
+            }
+        }
+
+        template <size_t... Is>
+        Attribute::resource
+        getResource(uint64_t index, std::index_sequence<Is...>)
+        {
+            std::optional<Attribute::resource> res;
+            ((index == Is ? (void)res.emplace(
+                                std::in_place_index<Is>,
+                                get<std::variant_alternative_t<
+                                    Is,
+                                    Attribute::resource>>())
+                          : void()),
+             ...);
+            if (!res.has_value())
+            {
+                throw error::Internal(
+                    "[CollectiveMetadata] Received attribute of unknown type.");
+            }
+            return std::move(*res);
+        }
+    };
+
+    void
+    apply(CachedAttribute const &entry, Parameter<Operation::READ_ATT> &param)
+    {
+        if (entry.error.has_value())
+        {
+            entry.error->rethrow();
+        }
+        *param.dtype = entry.dtype;
+        *param.resource = entry.value;
+    }
+} // namespace
+
+RecordedError RecordedError::fromCurrentException()
+{
+    RecordedError res;
+    try
+    {
+        throw;
+    }
+    catch (error::ReadError const &e)
+    {
+        res.kind = Kind::ReadError;
+        res.what = e.what();
+        res.affectedObject = e.affectedObject;
+        res.reason = e.reason;
+        res.backend = e.backend;
+        res.description = e.description;
+    }
+    catch (error::OperationUnsupportedInBackend const &e)
+    {
+        res.kind = Kind::OperationUnsupportedInBackend;
+        res.what = e.what();
+        res.backend = e.backend;
+    }
+    catch (error::NoSuchAttribute const &e)
+    {
+        res.kind = Kind::NoSuchAttribute;
+        res.what = e.what();
+    }
+    catch (std::exception const &e)
+    {
+        res.what = e.what();
+    }
+    catch (...)
+    {
+        res.what = "Unknown exception on rank 0.";
+    }
+    return res;
+}
+
+void RecordedError::rethrow() const
+{
+    switch (kind)
+    {
+    case Kind::ReadError:
+        throw error::ReadError(affectedObject, reason, backend, description);
+    case Kind::OperationUnsupportedInBackend: {
+        // the constructor prepends this again
+        std::string prefix =
+            "Operation unsupported in " + backend.value_or("") + ": ";
+        throw error::OperationUnsupportedInBackend(
+            backend.value_or(""),
+            auxiliary::starts_with(what, prefix) ? what.substr(prefix.size())
+                                                 : what);
+    }
+    case Kind::NoSuchAttribute:
+        throw error::NoSuchAttribute(what);
+    case Kind::Other:
+        break;
+    }
+    throw std::runtime_error(what);
+}
+
+CollectiveMetadataFlush::CollectiveMetadataFlush(
+    AbstractIOHandlerImpl &impl,
+    CollectiveMetadataCache &cache,
+    MPI_Comm comm,
+    std::queue<IOTask> const &work)
+    : m_impl(impl), m_cache(cache), m_comm(comm)
+{
+    int rank;
+    MPI_Comm_rank(m_comm, &rank);
+    m_isRoot = rank == 0;
+
+    /*
+     * Decide up front, so the decision does not depend on how far a rank
+     * gets before a task fails.
+     */
+    auto remaining = work;
+    for (; !remaining.empty(); remaining.pop())
+    {
+        auto &task = remaining.front();
+        switch (task.operation)
+        {
+        case Operation::READ_ATT: {
+            auto &param = auxiliary::deref_dynamic_cast<
+                Parameter<Operation::READ_ATT>>(task.parameter.get());
+            if (auto attributes = m_cache.find(task.writable);
+                attributes != m_cache.end())
+            {
+                if (auto attribute = attributes->second.find(param.name);
+                    attribute != attributes->second.end())
+                {
+                    m_cached.emplace(task.parameter.get(), attribute->second);
+                    break;
+                }
+            }
+            m_needsExchange = true;
+            break;
+        }
+        case Operation::LIST_PATHS:
+        case Operation::LIST_DATASETS:
+        case Operation::LIST_ATTS:
+            m_needsExchange = true;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+bool CollectiveMetadataFlush::intercept(IOTask &task)
+{
+    switch (task.operation)
+    {
+    case Operation::DEREGISTER:
+        m_cache.erase(task.writable);
+        return false;
+    case Operation::READ_ATT:
+        if (auto it = m_cached.find(task.parameter.get()); it != m_cached.end())
+        {
+            apply(
+                it->second,
+                auxiliary::deref_dynamic_cast<Parameter<Operation::READ_ATT>>(
+                    task.parameter.get()));
+            return true;
+        }
+        [[fallthrough]];
+    case Operation::LIST_PATHS:
+    case Operation::LIST_DATASETS:
+    case Operation::LIST_ATTS:
+        if (m_isRoot)
+        {
+            return false;
+        }
+        m_deferred.push_back(task);
+        return true;
+    default:
+        return false;
+    }
+}
+
+void CollectiveMetadataFlush::record(IOTask &task)
+{
+    if (!m_isRoot)
+    {
+        return;
+    }
+    using namespace auxiliary;
+    Serializer out{m_results};
+    switch (task.operation)
+    {
+    case Operation::LIST_PATHS:
+        out(task.operation);
+        out(*deref_dynamic_cast<Parameter<Operation::LIST_PATHS>>(
+                 task.parameter.get())
+                 .paths);
+        break;
+    case Operation::LIST_DATASETS:
+        out(task.operation);
+        out(*deref_dynamic_cast<Parameter<Operation::LIST_DATASETS>>(
+                 task.parameter.get())
+                 .datasets);
+        break;
+    case Operation::LIST_ATTS: {
+        auto const &names =
+            *deref_dynamic_cast<Parameter<Operation::LIST_ATTS>>(
+                 task.parameter.get())
+                 .attributes;
+        out(task.operation);
+        out(names);
+        for (auto const &name : names)
+        {
+            Parameter<Operation::READ_ATT> aRead;
+            aRead.name = name;
+            CachedAttribute entry;
+            try
+            {
+                m_impl.readAttribute(task.writable, aRead);
+                entry.dtype = *aRead.dtype;
+                entry.value = std::move(*aRead.resource);
+            }
+            catch (...)
+            {
+                entry.error = RecordedError::fromCurrentException();
+            }
+            out(entry);
+        }
+        break;
+    }
+    case Operation::READ_ATT: {
+        auto &param = deref_dynamic_cast<Parameter<Operation::READ_ATT>>(
+            task.parameter.get());
+        CachedAttribute entry;
+        entry.dtype = *param.dtype;
+        entry.value = *param.resource;
+        out(task.operation);
+        out(entry);
+        break;
+    }
+    default:
+        return;
+    }
+    m_deferred.push_back(task);
+}
+
+void CollectiveMetadataFlush::exchange(bool failedLocally)
+{
+    if (!m_needsExchange)
+    {
+        return;
+    }
+    m_needsExchange = false;
+
+    std::vector<char> message;
+    if (m_isRoot)
+    {
+        Serializer out{message};
+        out(uint64_t(m_deferred.size()));
+        std::optional<RecordedError> error;
+        if (failedLocally)
+        {
+            error = RecordedError::fromCurrentException();
+        }
+        out(error);
+        message.insert(message.end(), m_results.begin(), m_results.end());
+        m_results.clear();
+    }
+    uint64_t size = message.size();
+    MPI_Bcast(&size, 1, MPI_UINT64_T, 0, m_comm);
+    if (size > uint64_t(INT_MAX))
+    {
+        throw error::OperationUnsupportedInBackend(
+            m_impl.m_handler->backendName(),
+            "[CollectiveMetadata] Metadata of a single flush exceeds 2GB.");
+    }
+    message.resize(size);
+    MPI_Bcast(message.data(), int(size), MPI_CHAR, 0, m_comm);
+
+    auto mismatch = [failedLocally]() {
+        if (!failedLocally)
+        {
+            throw error::Internal(
+                "[CollectiveMetadata] Ranks did not read the same metadata. "
+                "Collective metadata parsing requires that all ranks open "
+                "Series and Iterations collectively.");
+        }
+    };
+
+    Deserializer in{message.data(), message.data() + message.size()};
+    auto count = in.get<uint64_t>();
+    auto error = in.get<std::optional<RecordedError>>();
+    if (count > m_deferred.size() ||
+        (!error.has_value() && count < m_deferred.size()))
+    {
+        mismatch();
+        return;
+    }
+    using namespace auxiliary;
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto &task = m_deferred[i];
+        if (in.get<Operation>() != task.operation)
+        {
+            mismatch();
+            return;
+        }
+        switch (task.operation)
+        {
+        case Operation::LIST_PATHS: {
+            auto paths = in.get<std::vector<std::string>>();
+            if (!m_isRoot)
+            {
+                *deref_dynamic_cast<Parameter<Operation::LIST_PATHS>>(
+                     task.parameter.get())
+                     .paths = std::move(paths);
+            }
+            break;
+        }
+        case Operation::LIST_DATASETS: {
+            auto datasets = in.get<std::vector<std::string>>();
+            if (!m_isRoot)
+            {
+                *deref_dynamic_cast<Parameter<Operation::LIST_DATASETS>>(
+                     task.parameter.get())
+                     .datasets = std::move(datasets);
+            }
+            break;
+        }
+        case Operation::LIST_ATTS: {
+            auto names = in.get<std::vector<std::string>>();
+            auto &attributes = m_cache[task.writable];
+            attributes.clear();
+            for (auto const &name : names)
+            {
+                attributes[name] = in.get<CachedAttribute>();
+            }
+            if (!m_isRoot)
+            {
+                *deref_dynamic_cast<Parameter<Operation::LIST_ATTS>>(
+                     task.parameter.get())
+                     .attributes = std::move(names);
+            }
+            break;
+        }
+        case Operation::READ_ATT: {
+            auto entry = in.get<CachedAttribute>();
+            if (!m_isRoot)
+            {
+                apply(
+                    entry,
+                    deref_dynamic_cast<Parameter<Operation::READ_ATT>>(
+                        task.parameter.get()));
+            }
+            break;
+        }
+        default:
+            mismatch();
+            return;
+        }
+    }
+    m_deferred.clear();
+    if (error.has_value() && !failedLocally)
+    {
+        error->rethrow();
+    }
+}
+} // namespace openPMD::internal
+#endif
@@ -25,7 +25,6 @@ namespace openPMD::internal
 {
 ParsedFlushParams::ParsedFlushParams(FlushParams const &flushParams)
     : flushLevel(flushParams.flushLevel)
-    , backendConfig(json::parseOptions(
-          flushParams.backendConfig, /* considerFiles = */ false))
+    , backendConfig(*json::parseOptionsCached(flushParams.backendConfig))
 {}
 } // namespace openPMD::internal
@@ -28,10 +28,11 @@
 
 #include <hdf5.h>
 
+#include <algorithm>
 #include <array>
 #include <complex>
 #include <map>
-#include <stack>
+#include <numeric>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
@@ -290,27 +291,45 @@ hid_t openPMD::getH5DataSpace(Attribute const &att)
     }
 }
 
-std::string openPMD::concrete_h5_file_position(Writable *w)
+std::string const &openPMD::concrete_h5_file_position(Writable *w)
 {
-    std::stack<Writable *> hierarchy;
     if (!w->abstractFilePosition)
         w = w->parent;
-    while (w)
+    if (!w)
     {
-        hierarchy.push(w);
-        w = w->parent;
+        static std::string const empty;
+        return empty;
     }
 
-    std::string pos;
-    while (!hierarchy.empty())
+    auto &cache = w->resolvedFilePosition;
     {
-        pos += std::dynamic_pointer_cast<HDF5FilePosition>(
-                   hierarchy.top()->abstractFilePosition)
-                   ->location;
-        hierarchy.pop();
+        // cheap check without allocations or reference counting
+        Writable *ancestor = w;
+        auto cached = cache.chain.begin();
+        while (ancestor && cached != cache.chain.end() &&
+               ancestor->abstractFilePosition == *cached)
+        {
+            ancestor = ancestor->parent;
+            ++cached;
+        }
+        if (!ancestor && cached == cache.chain.end())
+        {
+            return cache.path;
+        }
     }
 
-    return auxiliary::replace_all(pos, "//", "/");
+    cache.chain.clear();
+    for (Writable *ancestor = w; ancestor; ancestor = ancestor->parent)
+    {
+        cache.chain.push_back(ancestor->abstractFilePosition);
+    }
+    std::string pos;
+    for (auto it = cache.chain.rbegin(); it != cache.chain.rend(); ++it)
+    {
+        pos += std::dynamic_pointer_cast<HDF5FilePosition>(*it)->location;
+    }
+    cache.path = auxiliary::replace_all(pos, "//", "/");
+    return cache.path;
 }
 
 std::vector<hsize_t> openPMD::getOptimalChunkDims(
@@ -397,4 +416,244 @@ std::vector<hsize_t> openPMD::getOptimalChunkDims(
     return chunk_dims;
 }
 
+std::vector<hsize_t> openPMD::getDecompositionAlignment(
+    std::vector<ChunkInfo> const &blocks, size_t ndims)
+{
+    std::vector<hsize_t> alignment(ndims, 0);
+    for (auto const &block : blocks)
+    {
+        if (block.offset.size() != ndims || block.extent.size() != ndims ||
+            std::find(block.extent.begin(), block.extent.end(), 0) !=
+                block.extent.end())
+        {
+            continue;
+        }
+        for (size_t d = 0; d < ndims; ++d)
+        {
+            alignment[d] = std::gcd(
+                std::gcd(alignment[d], hsize_t(block.offset[d])),
+                hsize_t(block.extent[d]));
+        }
+    }
+    return alignment;
+}
+
+namespace
+{
+hsize_t smallestPrimeFactor(hsize_t n)
+{
+    for (hsize_t p = 2; p * p <= n; ++p)
+    {
+        if (n % p == 0)
+        {
+            return p;
+        }
+    }
+    return n;
+}
+
+// chunks aligned to the decomposition, see getDecompositionAwareChunkDims()
+std::vector<hsize_t> alignedChunkDims(
+    std::vector<hsize_t> const &dims,
+    size_t typeSize,
+    std::vector<hsize_t> const &alignment,
+    size_t minBytes,
+    size_t maxBytes,
+    std::optional<size_t> sliceAxis)
+{
+    auto const ndims = dims.size();
+    auto constrained = [&](size_t d) {
+        return d < alignment.size() && alignment[d] != 0;
+    };
+    auto isSliceAxis = [&](size_t d) {
+        return sliceAxis.has_value() && *sliceAxis == d;
+    };
+
+    std::vector<hsize_t> chunk_dims(ndims);
+    for (size_t d = 0; d < ndims; ++d)
+    {
+        hsize_t extent = constrained(d) ? std::min(alignment[d], dims[d])
+                                        : dims[d];
+        chunk_dims[d] = isSliceAxis(d) ? 1 : std::max<hsize_t>(extent, 1);
+    }
+    auto chunk_bytes = [&]() {
+        size_t res = typeSize;
+        for (auto extent : chunk_dims)
+        {
+            res *= extent;
+        }
+        return res;
+    };
+
+    // shrink the largest dimension first, the slower varying one on ties
+    while (chunk_bytes() > maxBytes)
+    {
+        std::optional<size_t> largest;
+        for (size_t d = 0; d < ndims; ++d)
+        {
+            if (chunk_dims[d] > 1 &&
+                (!largest.has_value() || chunk_dims[d] > chunk_dims[*largest]))
+            {
+                largest = d;
+            }
+        }
+        if (!largest.has_value())
+        {
+            break;
+        }
+        auto &extent = chunk_dims[*largest];
+        if (constrained(*largest))
+        {
+            // stay a divisor of the alignment
+            extent /= smallestPrimeFactor(extent);
+        }
+        else
+        {
+            extent = (extent + 1) / 2;
+        }
+    }
+
+    // grow the smallest unconstrained dimension first
+    while (chunk_bytes() < minBytes)
+    {
+        std::optional<size_t> smallest;
+        for (size_t d = 0; d < ndims; ++d)
+        {
+            if (!constrained(d) && !isSliceAxis(d) &&
+                chunk_dims[d] < dims[d] &&
+                (!smallest.has_value() ||
+                 chunk_dims[d] < chunk_dims[*smallest]))
+            {
+                smallest = d;
+            }
+        }
+        if (!smallest.has_value())
+        {
+            break;
+        }
+        auto &extent = chunk_dims[*smallest];
+        hsize_t previous = extent;
+        extent = std::min(2 * extent, dims[*smallest]);
+        if (chunk_bytes() > maxBytes)
+        {
+            extent = previous;
+            break;
+        }
+    }
+
+    return chunk_dims;
+}
+} // namespace
+
+std::vector<hsize_t> openPMD::getDecompositionAwareChunkDims(
+    std::vector<hsize_t> const &dims,
+    size_t typeSize,
+    std::vector<hsize_t> const &alignment,
+    size_t minBytes,
+    size_t maxBytes,
+    std::optional<size_t> sliceAxis)
+{
+    auto chunkBytes = [typeSize](std::vector<hsize_t> const &chunkDims) {
+        size_t res = typeSize;
+        for (auto extent : chunkDims)
+        {
+            res *= extent;
+        }
+        return res;
+    };
+    size_t datasetBytes = chunkBytes(dims);
+    if (sliceAxis.has_value() && *sliceAxis < dims.size() &&
+        dims[*sliceAxis] > 0)
+    {
+        datasetBytes /= dims[*sliceAxis];
+    }
+    size_t reachableBytes = std::min(minBytes, datasetBytes);
+
+    /*
+     * An uneven decomposition (e.g. 333/333/334) has a tiny alignment,
+     * which would result in tiny chunks. Drop the constraint on the axis
+     * with the finest alignment until the chunks reach minBytes.
+     */
+    auto relaxed = alignment;
+    while (true)
+    {
+        auto res = alignedChunkDims(
+            dims, typeSize, relaxed, minBytes, maxBytes, sliceAxis);
+        if (chunkBytes(res) >= reachableBytes)
+        {
+            return res;
+        }
+        std::optional<size_t> finest;
+        for (size_t d = 0; d < relaxed.size(); ++d)
+        {
+            bool isSliceAxis = sliceAxis.has_value() && *sliceAxis == d;
+            if (relaxed[d] != 0 && !isSliceAxis &&
+                (!finest.has_value() || relaxed[d] < relaxed[*finest]))
+            {
+                finest = d;
+            }
+        }
+        if (!finest.has_value())
+        {
+            return res;
+        }
+        relaxed[*finest] = 0;
+        if (!sliceAxis.has_value() &&
+            std::all_of(relaxed.begin(), relaxed.end(), [](hsize_t a) {
+                return a == 0;
+            }))
+        {
+            // nothing left of the decomposition
+            return getOptimalChunkDims(dims, typeSize);
+        }
+    }
+}
+
+std::pair<size_t, size_t> openPMD::getChunkCacheSize(
+    std::vector<hsize_t> const &dims,
+    std::vector<hsize_t> const &chunkDims,
+    size_t typeSize,
+    size_t maxBytes)
+{
+    // HDF5 defaults, used as lower bounds
+    constexpr size_t defaultBytes = 1024 * 1024;
+    constexpr size_t defaultSlots = 521;
+    constexpr size_t maxSlots = 1000000;
+
+    size_t chunkBytes = typeSize;
+    size_t chunksPerLayer = 1;
+    for (size_t i = 0; i < chunkDims.size(); ++i)
+    {
+        hsize_t chunk = std::max<hsize_t>(chunkDims[i], 1);
+        chunkBytes *= chunk;
+        if (i > 0 && i < dims.size())
+        {
+            chunksPerLayer *= (dims[i] + chunk - 1) / chunk;
+        }
+    }
+
+    size_t bytes = std::max(
+        {std::min(chunkBytes * chunksPerLayer, maxBytes),
+         chunkBytes,
+         defaultBytes});
+
+    size_t slots = std::clamp(
+        100 * std::max<size_t>(bytes / chunkBytes, 1), defaultSlots, maxSlots);
+    auto isPrime = [](size_t n) {
+        for (size_t div = 2; div * div <= n; ++div)
+        {
+            if (n % div == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    while (!isPrime(slots))
+    {
+        ++slots;
+    }
+    return {bytes, slots};
+}
+
 #endif
@@ -36,7 +36,9 @@
 #include "openPMD/IO/HDF5/HDF5Auxiliary.hpp"
 #include "openPMD/IO/HDF5/HDF5FilePosition.hpp"
 #include "openPMD/IO/IOTask.hpp"
+#include "openPMD/auxiliary/Codec.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/auxiliary/Memory.hpp"
 #include "openPMD/auxiliary/Mpi.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/auxiliary/TypeTraits.hpp"
@@ -44,12 +46,21 @@
 
 #include <H5FDmpio.h>
 #include <hdf5.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 #endif
 
+#include <algorithm>
 #include <complex>
+#include <cstdlib>
 #include <cstring>
 #include <future>
 #include <iostream>
+#include <numeric>
 #include <stack>
 #include <string>
 #include <typeinfo>
@@ -74,6 +85,481 @@ namespace openPMD
     } while (0)
 #endif
 
+namespace
+{
+    /*
+     * The dataset option "codec" is implemented with the built-in shuffle
+     * filter of HDF5 and with filters in the formats of the registered
+     * bitshuffle (32008) and LZ4 (32004) plugins. The openPMD-api registers
+     * its own implementation of the latter two, so no plugins need to be
+     * installed for writing or reading. Other readers can use the plugins
+     * (e.g. h5py with hdf5plugin).
+     */
+    constexpr H5Z_filter_t bitshuffleFilterID = 32008;
+    constexpr H5Z_filter_t lz4FilterID = 32004;
+    // client data of the bitshuffle filter: major and minor version of the
+    // format, type size, block size in elements and compression
+    constexpr unsigned bitshuffleNumValues = 5;
+    constexpr unsigned bitshuffleNoCompression = 0;
+    constexpr unsigned bitshuffleLZ4 = 2;
+    constexpr unsigned bitshuffleVersion[2] = {0, 5};
+    // bitshuffle operates on blocks with a multiple of eight elements
+    constexpr size_t bitshuffleBlockMultiple = 8;
+
+    using byte = unsigned char;
+
+    // both formats store sizes in big-endian byte order
+    uint64_t readBigEndian(byte const *in, unsigned numBytes)
+    {
+        uint64_t res = 0;
+        for (unsigned i = 0; i < numBytes; ++i)
+        {
+            res = res << 8 | in[i];
+        }
+        return res;
+    }
+
+    void writeBigEndian(byte *out, uint64_t value, unsigned numBytes)
+    {
+        for (unsigned i = numBytes; i-- > 0;)
+        {
+            out[i] = byte(value);
+            value >>= 8;
+        }
+    }
+
+    size_t defaultBitshuffleBlockSize(size_t typeSize)
+    {
+        size_t res = 8192 / typeSize;
+        res -= res % bitshuffleBlockMultiple;
+        return std::max<size_t>(res, 128);
+    }
+
+    // replaces the filter buffer, returns its new size as filters do
+    size_t replaceFilterBuffer(
+        std::vector<byte> const &res, size_t *bufferSize, void **buffer)
+    {
+        void *out = std::malloc(std::max<size_t>(res.size(), 1));
+        if (!out)
+        {
+            return 0;
+        }
+        std::memcpy(out, res.data(), res.size());
+        std::free(*buffer);
+        *buffer = out;
+        *bufferSize = res.size();
+        return res.size();
+    }
+
+    herr_t bitshuffleSetLocal(hid_t dcpl, hid_t type, hid_t)
+    {
+        unsigned flags = 0;
+        size_t numValues = bitshuffleNumValues;
+        unsigned values[bitshuffleNumValues] = {};
+        if (H5Pget_filter_by_id2(
+                dcpl,
+                bitshuffleFilterID,
+                &flags,
+                &numValues,
+                values,
+                0,
+                nullptr,
+                nullptr) < 0)
+        {
+            return -1;
+        }
+        size_t typeSize = H5Tget_size(type);
+        if (typeSize == 0)
+        {
+            return -1;
+        }
+        values[0] = bitshuffleVersion[0];
+        values[1] = bitshuffleVersion[1];
+        values[2] = unsigned(typeSize);
+        return H5Pmodify_filter(
+            dcpl,
+            bitshuffleFilterID,
+            flags,
+            std::max<size_t>(numValues, 3),
+            values);
+    }
+
+    /*
+     * The data is bit-shuffled in blocks, each LZ4-compressed on its own and
+     * prefixed by its compressed size if compression is enabled. Elements
+     * beyond a multiple of eight stay unshuffled and uncompressed at the end.
+     * Compressed chunks start with the raw size (8 bytes) and the block size
+     * in bytes (4 bytes).
+     */
+    size_t bitshuffleFilter(
+        unsigned flags,
+        size_t numValues,
+        unsigned const values[],
+        size_t numBytes,
+        size_t *bufferSize,
+        void **buffer)
+    {
+        // exceptions must not reach the HDF5 library, return 0 on errors
+        try
+        {
+            if (numValues < 3 || values[2] == 0)
+            {
+                return 0;
+            }
+            size_t typeSize = values[2];
+            size_t blockSize = numValues > 3 && values[3] != 0
+                ? values[3]
+                : defaultBitshuffleBlockSize(typeSize);
+            unsigned compression =
+                numValues > 4 ? values[4] : bitshuffleNoCompression;
+            if ((compression != bitshuffleNoCompression &&
+                 compression != bitshuffleLZ4) ||
+                blockSize % bitshuffleBlockMultiple != 0)
+            {
+                return 0;
+            }
+            bool lz4 = compression == bitshuffleLZ4;
+            bool reverse = flags & H5Z_FLAG_REVERSE;
+
+            auto in = static_cast<byte const *>(*buffer);
+            size_t rawSize = numBytes;
+            std::vector<byte> res;
+            byte *out;
+            if (reverse && lz4)
+            {
+                if (numBytes < 12)
+                {
+                    return 0;
+                }
+                rawSize = readBigEndian(in, 8);
+                blockSize = readBigEndian(in + 8, 4) / typeSize;
+                in += 12;
+                numBytes -= 12;
+                if (blockSize == 0 || blockSize % bitshuffleBlockMultiple != 0)
+                {
+                    return 0;
+                }
+                res.resize(rawSize);
+                out = res.data();
+            }
+            else if (lz4)
+            {
+                size_t numBlocks = rawSize / (blockSize * typeSize) + 1;
+                res.resize(
+                    12 + rawSize +
+                    numBlocks *
+                        (4 + auxiliary::lzCompressBound(blockSize * typeSize)));
+                writeBigEndian(res.data(), rawSize, 8);
+                writeBigEndian(res.data() + 8, blockSize * typeSize, 4);
+                out = res.data() + 12;
+            }
+            else
+            {
+                res.resize(rawSize);
+                out = res.data();
+            }
+            if (rawSize % typeSize != 0)
+            {
+                return 0;
+            }
+            size_t numElements = rawSize / typeSize;
+            byte const *inEnd = in + numBytes;
+
+            std::vector<byte> shuffled(blockSize * typeSize);
+            size_t lastBlock = numElements % blockSize;
+            lastBlock -= lastBlock % bitshuffleBlockMultiple;
+            size_t done = 0;
+            auto processBlock = [&](size_t elements) {
+                size_t bytes = elements * typeSize;
+                if (!lz4)
+                {
+                    if (reverse)
+                    {
+                        auxiliary::bitUnshuffle(in, out, elements, typeSize);
+                    }
+                    else
+                    {
+                        auxiliary::bitShuffle(in, out, elements, typeSize);
+                    }
+                    in += bytes;
+                    out += bytes;
+                }
+                else if (reverse)
+                {
+                    if (inEnd - in < 4)
+                    {
+                        throw std::runtime_error("truncated block");
+                    }
+                    size_t compressed = readBigEndian(in, 4);
+                    in += 4;
+                    if (size_t(inEnd - in) < compressed)
+                    {
+                        throw std::runtime_error("truncated block");
+                    }
+                    auxiliary::lzDecompress(
+                        in, compressed, shuffled.data(), bytes);
+                    auxiliary::bitUnshuffle(
+                        shuffled.data(), out, elements, typeSize);
+                    in += compressed;
+                    out += bytes;
+                }
+                else
+                {
+                    auxiliary::bitShuffle(
+                        in, shuffled.data(), elements, typeSize);
+                    size_t compressed =
+                        auxiliary::lzCompress(shuffled.data(), bytes, out + 4);
+                    writeBigEndian(out, compressed, 4);
+                    in += bytes;
+                    out += 4 + compressed;
+                }
+                done += elements;
+            };
+            for (size_t i = 0; i < numElements / blockSize; ++i)
+            {
+                processBlock(blockSize);
+            }
+            if (lastBlock > 0)
+            {
+                processBlock(lastBlock);
+            }
+            size_t leftover = (numElements - done) * typeSize;
+            if (size_t(inEnd - in) < leftover)
+            {
+                return 0;
+            }
+            std::memcpy(out, in, leftover);
+            out += leftover;
+            res.resize(size_t(out - res.data()));
+            return replaceFilterBuffer(res, bufferSize, buffer);
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    H5Z_class2_t const bitshuffleFilterClass = {
+        H5Z_CLASS_T_VERS,
+        bitshuffleFilterID,
+        1, // encoder present
+        1, // decoder present
+        "bitshuffle; see https://github.com/kiyo-masui/bitshuffle",
+        nullptr,
+        bitshuffleSetLocal,
+        bitshuffleFilter};
+
+    /*
+     * The data is split into blocks of the size given as client data
+     * (default 1 GiB), each LZ4-compressed on its own, or stored as is if
+     * that does not pay off, and prefixed by its compressed size. Chunks
+     * start with the raw size (8 bytes) and the block size (4 bytes).
+     */
+    size_t lz4Filter(
+        unsigned flags,
+        size_t numValues,
+        unsigned const values[],
+        size_t numBytes,
+        size_t *bufferSize,
+        void **buffer)
+    {
+        // exceptions must not reach the HDF5 library, return 0 on errors
+        try
+        {
+            auto in = static_cast<byte const *>(*buffer);
+            auto inEnd = in + numBytes;
+            std::vector<byte> res;
+            if (flags & H5Z_FLAG_REVERSE)
+            {
+                if (numBytes < 12)
+                {
+                    return 0;
+                }
+                size_t rawSize = readBigEndian(in, 8);
+                size_t blockSize = readBigEndian(in + 8, 4);
+                in += 12;
+                res.resize(rawSize);
+                for (size_t done = 0; done < rawSize;)
+                {
+                    size_t bytes = std::min(blockSize, rawSize - done);
+                    if (bytes == 0 || inEnd - in < 4)
+                    {
+                        return 0;
+                    }
+                    size_t compressed = readBigEndian(in, 4);
+                    in += 4;
+                    if (size_t(inEnd - in) < compressed)
+                    {
+                        return 0;
+                    }
+                    if (compressed == bytes)
+                    {
+                        std::memcpy(res.data() + done, in, bytes);
+                    }
+                    else
+                    {
+                        auxiliary::lzDecompress(
+                            in, compressed, res.data() + done, bytes);
+                    }
+                    in += compressed;
+                    done += bytes;
+                }
+            }
+            else
+            {
+                size_t blockSize = numValues > 0 && values[0] != 0
+                    ? values[0]
+                    : size_t(1) << 30;
+                blockSize = std::max<size_t>(std::min(blockSize, numBytes), 1);
+                size_t numBlocks = (numBytes + blockSize - 1) / blockSize;
+                size_t blockBound = 4 + auxiliary::lzCompressBound(blockSize);
+                res.resize(12 + numBlocks * blockBound);
+                writeBigEndian(res.data(), numBytes, 8);
+                writeBigEndian(res.data() + 8, blockSize, 4);
+                byte *out = res.data() + 12;
+                for (size_t done = 0; done < numBytes; done += blockSize)
+                {
+                    size_t bytes = std::min(blockSize, numBytes - done);
+                    size_t compressed =
+                        auxiliary::lzCompress(in + done, bytes, out + 4);
+                    if (compressed >= bytes)
+                    {
+                        std::memcpy(out + 4, in + done, bytes);
+                        compressed = bytes;
+                    }
+                    writeBigEndian(out, compressed, 4);
+                    out += 4 + compressed;
+                }
+                res.resize(size_t(out - res.data()));
+            }
+            return replaceFilterBuffer(res, bufferSize, buffer);
+        }
+        catch (...)
+        {
+            return 0;
+        }
+    }
+
+    H5Z_class2_t const lz4FilterClass = {
+        H5Z_CLASS_T_VERS,
+        lz4FilterID,
+        1, // encoder present
+        1, // decoder present
+        "HDF5 lz4 filter; see "
+        "https://github.com/HDFGroup/hdf5_plugins/blob/master/docs/"
+        "RegisteredFilterPlugins.md",
+        nullptr,
+        nullptr,
+        lz4Filter};
+
+    void setCodecFilters(hid_t dcpl, auxiliary::Codec const &codec)
+    {
+        using Shuffle = auxiliary::Codec::Shuffle;
+        herr_t status = 0;
+        switch (codec.shuffle)
+        {
+        case Shuffle::None:
+            break;
+        case Shuffle::Byte:
+            status = H5Pset_shuffle(dcpl);
+            break;
+        case Shuffle::Bit: {
+            // bitshuffle compresses by itself
+            unsigned values[bitshuffleNumValues] = {
+                0,
+                0,
+                0,
+                0,
+                codec.compress ? bitshuffleLZ4 : bitshuffleNoCompression};
+            status = H5Pset_filter(
+                dcpl,
+                bitshuffleFilterID,
+                H5Z_FLAG_MANDATORY,
+                bitshuffleNumValues,
+                values);
+            break;
+        }
+        }
+        if (status >= 0 && codec.compress && codec.shuffle != Shuffle::Bit)
+        {
+            status = H5Pset_filter(
+                dcpl, lz4FilterID, H5Z_FLAG_MANDATORY, 0, nullptr);
+        }
+        VERIFY(
+            status >= 0,
+            "[HDF5] Internal error: Failed to set the codec filters during "
+            "dataset creation");
+    }
+
+    /*
+     * Name and object type of the n-th link of a group in name order.
+     * Unlike H5Gget_objname_by_idx() and H5Gget_objtype_by_idx(), these take
+     * a link access property, so that the caller controls whether the
+     * metadata reads are collective.
+     */
+    std::string linkName(hid_t group_id, hsize_t index, hid_t lapl)
+    {
+        ssize_t name_length = H5Lget_name_by_idx(
+            group_id, ".", H5_INDEX_NAME, H5_ITER_INC, index, nullptr, 0, lapl);
+        if (name_length < 0)
+        {
+            return {};
+        }
+        std::vector<char> name(name_length + 1);
+        H5Lget_name_by_idx(
+            group_id,
+            ".",
+            H5_INDEX_NAME,
+            H5_ITER_INC,
+            index,
+            name.data(),
+            name_length + 1,
+            lapl);
+        return std::string(name.data(), name_length);
+    }
+
+    // H5O_TYPE_UNKNOWN for links other than hard links
+    H5O_type_t linkedObjectType(hid_t group_id, hsize_t index, hid_t lapl)
+    {
+        H5L_info_t link_info;
+        if (H5Lget_info_by_idx(
+                group_id,
+                ".",
+                H5_INDEX_NAME,
+                H5_ITER_INC,
+                index,
+                &link_info,
+                lapl) < 0 ||
+            link_info.type != H5L_TYPE_HARD)
+        {
+            return H5O_TYPE_UNKNOWN;
+        }
+#if H5_VERSION_GE(1, 12, 0)
+        H5O_info2_t object_info;
+        herr_t status = H5Oget_info_by_idx3(
+            group_id,
+            ".",
+            H5_INDEX_NAME,
+            H5_ITER_INC,
+            index,
+            &object_info,
+            H5O_INFO_BASIC,
+            lapl);
+#else
+        H5O_info_t object_info;
+        herr_t status = H5Oget_info_by_idx(
+            group_id,
+            ".",
+            H5_INDEX_NAME,
+            H5_ITER_INC,
+            index,
+            &object_info,
+            lapl);
+#endif
+        return status < 0 ? H5O_TYPE_UNKNOWN : object_info.type;
+    }
+} // namespace
+
 HDF5IOHandlerImpl::HDF5IOHandlerImpl(
     AbstractIOHandler *handler,
     json::TracingJSON config,
@@ -152,14 +638,18 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
             constexpr char const *const init_json_shadow_str = R"(
             {
               "dataset": {
-                "chunks": null
+                "chunks": null,
+                "decomposition": null,
+                "chunk_cache": null
               },
               "independent_stores": null
             })";
             constexpr char const *const dataset_cfg_mask = R"(
             {
               "dataset": {
-                "chunks": null
+                "chunks": null,
+                "decomposition": null,
+                "chunk_cache": null
               }
             })";
             constexpr char const *const flush_cfg_mask = R"(
@@ -177,6 +667,91 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
             json::merge(m_config.getShadow(), init_json_shadow);
         }
 
+        if (m_config.json().contains("dataset") &&
+            m_config["dataset"].json().contains("chunk_cache"))
+        {
+            auto chunkCacheConfig = m_config["dataset"]["chunk_cache"];
+            chunkCacheConfig.declareFullyRead();
+            m_chunkCache = parseChunkCacheConfig(chunkCacheConfig.json());
+        }
+
+        if (m_config.json().contains("page_buffer"))
+        {
+            auto pageBufferConfig = m_config["page_buffer"];
+            pageBufferConfig.declareFullyRead();
+            auto const &pageBufferJson = pageBufferConfig.json();
+            PageBufferConfig pageBuffer;
+            try
+            {
+                pageBuffer.bytes = pageBufferJson.at("size").get<size_t>();
+                if (pageBufferJson.contains("page_size"))
+                {
+                    pageBuffer.pageSize =
+                        pageBufferJson.at("page_size").get<size_t>();
+                }
+                if (pageBufferJson.contains("min_meta_percent"))
+                {
+                    pageBuffer.minMetaPercent =
+                        pageBufferJson.at("min_meta_percent").get<unsigned>();
+                }
+                if (pageBufferJson.contains("min_raw_percent"))
+                {
+                    pageBuffer.minRawPercent =
+                        pageBufferJson.at("min_raw_percent").get<unsigned>();
+                }
+            }
+            catch (nlohmann::json::exception const &)
+            {
+                throw error::BackendConfigSchema(
+                    {"hdf5", "page_buffer"},
+                    "Must be an object with key 'size' (integer) and optional "
+                    "keys 'page_size', 'min_meta_percent' and "
+                    "'min_raw_percent' (integers).");
+            }
+            if (pageBuffer.pageSize == 0 ||
+                pageBuffer.bytes < pageBuffer.pageSize)
+            {
+                throw error::BackendConfigSchema(
+                    {"hdf5", "page_buffer", "size"},
+                    "Must be at least as large as the page size.");
+            }
+            if (pageBuffer.minMetaPercent + pageBuffer.minRawPercent > 100)
+            {
+                throw error::BackendConfigSchema(
+                    {"hdf5", "page_buffer"},
+                    "'min_meta_percent' and 'min_raw_percent' must not add "
+                    "up to more than 100.");
+            }
+#if H5_VERSION_GE(1, 10, 1)
+            // page buffering only works on files with paged allocation
+            m_pagedFileCreateProperty = H5Pcreate(H5P_FILE_CREATE);
+            status = H5Pset_file_space_strategy(
+                m_pagedFileCreateProperty, H5F_FSPACE_STRATEGY_PAGE, 0, 1);
+            VERIFY(
+                status >= 0,
+                "[HDF5] Internal error: Failed to set file space strategy");
+            status = H5Pset_file_space_page_size(
+                m_pagedFileCreateProperty, pageBuffer.pageSize);
+            VERIFY(
+                status >= 0,
+                "[HDF5] Internal error: Failed to set file space page size");
+            m_pagedFileAccessProperty = H5Pcreate(H5P_FILE_ACCESS);
+            status = H5Pset_page_buffer_size(
+                m_pagedFileAccessProperty,
+                pageBuffer.bytes,
+                pageBuffer.minMetaPercent,
+                pageBuffer.minRawPercent);
+            VERIFY(
+                status >= 0,
+                "[HDF5] Internal error: Failed to set page buffer size");
+            m_pageBuffer = pageBuffer;
+#else
+            std::cerr << "[HDF5] Page buffering requires HDF5 1.10.1 or "
+                         "newer, ignoring 'hdf5.page_buffer'."
+                      << std::endl;
+#endif
+        }
+
         // unused params
         if (do_warn_unused_params)
         {
@@ -212,10 +787,59 @@ HDF5IOHandlerImpl::HDF5IOHandlerImpl(
     else
         m_hdf5_collective_metadata = 0;
 #endif
+
+    // always register the codec filters, they are needed for reading, too
+    for (auto const *filterClass : {&bitshuffleFilterClass, &lz4FilterClass})
+    {
+        if (H5Zregister(filterClass) < 0)
+        {
+            std::cerr << "[HDF5] Failed registering the filter '"
+                      << filterClass->name
+                      << "', datasets using it cannot be accessed."
+                      << std::endl;
+        }
+    }
+
+    // files may only be closed off the main thread if HDF5 serializes its
+    // API calls internally
+#if H5_VERSION_GE(1, 10, 0)
+    hbool_t threadsafe = false;
+    H5is_library_threadsafe(&threadsafe);
+    m_threadsafeLibrary = threadsafe;
+#endif
 }
 
 HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
 {
+    try
+    {
+        // closing the remaining files is the last collective point
+        flushJoinedDatasets();
+        m_joinedDatasets.clear();
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "[HDF5] Failed writing joined arrays before closing: "
+                  << e.what() << std::endl;
+    }
+    try
+    {
+        flushAttributes();
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "[HDF5] Failed writing attributes before closing: "
+                  << e.what() << std::endl;
+    }
+    try
+    {
+        m_closingFiles.awaitAll();
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "[HDF5] Failed closing file in the background: "
+                  << e.what() << std::endl;
+    }
     herr_t status;
     status = H5Tclose(m_H5T_BOOL_ENUM);
     if (status < 0)
@@ -241,6 +865,16 @@ HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
         std::cerr << "[HDF5] Internal error: Failed to close complex long "
                      "double type\n";
 
+    closeDatasetHandles(std::nullopt);
+    for (auto const &[writable, access] : m_datasetAccessProperties)
+    {
+        (void)writable;
+        status = H5Pclose(access.dapl);
+        if (status < 0)
+            std::cerr << "[HDF5] Internal error: Failed to close HDF5 dataset "
+                         "access property\n";
+    }
+
     while (!m_openFileIDs.empty())
     {
         auto file = m_openFileIDs.begin();
@@ -264,6 +898,16 @@ HDF5IOHandlerImpl::~HDF5IOHandlerImpl()
             std::cerr << "[HDF5] Internal error: Failed to close HDF5 file "
                          "access property\n";
     }
+    for (hid_t property : {m_pagedFileAccessProperty, m_pagedFileCreateProperty})
+    {
+        if (property != H5P_DEFAULT)
+        {
+            status = H5Pclose(property);
+            if (status < 0)
+                std::cerr << "[HDF5] Internal error: Failed to close HDF5 "
+                             "page buffering property\n";
+        }
+    }
 }
 
 void HDF5IOHandlerImpl::createFile(
@@ -287,6 +931,7 @@ void HDF5IOHandlerImpl::createFile(
         std::string name = m_handler->directory + parameters.name;
         if (!auxiliary::ends_with(name, ".h5"))
             name += ".h5";
+        m_closingFiles.await(name);
         unsigned flags{};
         switch (m_handler->m_backendAccess)
         {
@@ -316,7 +961,15 @@ void HDF5IOHandlerImpl::createFile(
         hid_t id{};
         if (flags == H5F_ACC_RDWR)
         {
-            id = H5Fopen(name.c_str(), flags, m_fileAccessProperty);
+            id = openH5File(name, flags);
+        }
+        else if (m_pageBuffer.has_value())
+        {
+            id = H5Fcreate(
+                name.c_str(),
+                flags,
+                m_pagedFileCreateProperty,
+                m_pagedFileAccessProperty);
         }
         else
         {
@@ -343,6 +996,7 @@ void HDF5IOHandlerImpl::checkFile(
     {
         name += ".h5";
     }
+    m_closingFiles.await(name);
     bool fileExists =
         auxiliary::file_exists(name) || auxiliary::directory_exists(name);
 
@@ -468,12 +1122,6 @@ void HDF5IOHandlerImpl::createDataset(
             "[HDF5] Creating a dataset in a file opened as read only is not "
             "possible.");
 
-    if (parameters.joinedDimension.has_value())
-    {
-        error::throwOperationUnsupportedInBackend(
-            "ADIOS1", "Joined Arrays currently only supported in ADIOS2");
-    }
-
     if (!writable->written)
     {
         /* Sanitize name */
@@ -483,10 +1131,16 @@ void HDF5IOHandlerImpl::createDataset(
         if (auxiliary::ends_with(name, '/'))
             name = auxiliary::replace_last(name, "/", "");
 
+        /*
+         * Joined arrays start out empty along the joined dimension and are
+         * extended at each collective point, see flushJoinedDatasets().
+         */
+        auto const joinedDim = parameters.joinedDimension;
         std::vector<hsize_t> dims;
         std::uint64_t num_elements = 1u;
-        for (auto const &val : parameters.extent)
+        for (size_t i = 0; i < parameters.extent.size(); ++i)
         {
+            auto val = joinedDim == i ? 0 : parameters.extent[i];
             dims.push_back(static_cast<hsize_t>(val));
             num_elements *= val;
         }
@@ -502,8 +1156,7 @@ void HDF5IOHandlerImpl::createDataset(
         }
 
         json::TracingJSON config = [&]() {
-            auto parsed_config = json::parseOptions(
-                parameters.options, /* considerFiles = */ false);
+            json::ParsedConfig parsed_config = *parameters.getParsedOptions();
             if (auto hdf5_config_it = parsed_config.config.find("hdf5");
                 hdf5_config_it != parsed_config.config.end())
             {
@@ -525,9 +1178,23 @@ void HDF5IOHandlerImpl::createDataset(
             is_resizable_dataset = config["resizable"].json().get<bool>();
         }
 
+        std::optional<auxiliary::Codec> codec = parameters.getCodec();
+#if openPMD_HAVE_MPI
+        if (codec.has_value() && m_communicator.has_value())
+        {
+            // HDF5 applies filters only to collective writes
+            std::cerr << "[HDF5] The dataset option 'codec' is not "
+                         "supported in parallel HDF5, dataset '"
+                      << name << "' will not be compressed." << std::endl;
+            codec.reset();
+        }
+#endif
+
         using chunking_t = std::vector<hsize_t>;
         using compute_chunking_t =
-            std::variant<chunking_t, std::string /* either "none" or "auto"*/>;
+            std::variant<
+                chunking_t,
+                std::string /* "none", "auto" or "decomposition" */>;
 
         bool chunking_config_from_json = false;
         auto throw_chunking_error = [&chunking_config_from_json]() {
@@ -535,19 +1202,28 @@ void HDF5IOHandlerImpl::createDataset(
             {
                 throw error::BackendConfigSchema(
                     {"hdf5", "dataset", "chunks"},
-                    R"(Must be "auto", "none", or a an array of integer.)");
+                    R"(Must be "auto", "none", "decomposition", )"
+                    R"(or a an array of integer.)");
             }
             else
             {
                 throw error::WrongAPIUsage(
                     "Environment variable OPENPMD_HDF5_CHUNKS accepts values "
-                    "'auto' and 'none'.");
+                    "'auto', 'none' and 'decomposition'.");
             }
         };
 
         compute_chunking_t compute_chunking =
             auxiliary::getEnvString("OPENPMD_HDF5_CHUNKS", "auto");
 
+        // hints for chunks = "decomposition"
+        std::optional<std::vector<hsize_t>> decomposition_block;
+        size_t decomposition_min_bytes = 64 * 1024;
+        size_t decomposition_max_bytes = 4 * 1024 * 1024;
+        std::optional<size_t> decomposition_slice_axis;
+
+        std::optional<ChunkCacheConfig> chunk_cache;
+
         // HDF5 specific
         if (config.json().contains("hdf5") &&
             config["hdf5"].json().contains("dataset"))
@@ -583,7 +1259,144 @@ void HDF5IOHandlerImpl::createDataset(
                     throw_chunking_error();
                 }
             }
+
+            if (datasetConfig.json().contains("decomposition"))
+            {
+                auto decompositionConfig = datasetConfig["decomposition"];
+                try
+                {
+                    if (decompositionConfig.json().contains("block"))
+                    {
+                        decomposition_block =
+                            decompositionConfig["block"]
+                                .json()
+                                .get<std::vector<hsize_t>>();
+                    }
+                    if (decompositionConfig.json().contains(
+                            "chunk_size_window"))
+                    {
+                        auto window = decompositionConfig["chunk_size_window"]
+                                          .json()
+                                          .get<std::vector<size_t>>();
+                        if (window.size() != 2 || window[0] > window[1])
+                        {
+                            throw error::BackendConfigSchema(
+                                {"hdf5",
+                                 "dataset",
+                                 "decomposition",
+                                 "chunk_size_window"},
+                                "Must be an array [min, max] of two byte "
+                                "sizes.");
+                        }
+                        decomposition_min_bytes = window[0];
+                        decomposition_max_bytes = window[1];
+                    }
+                    if (decompositionConfig.json().contains("slice_axis"))
+                    {
+                        decomposition_slice_axis =
+                            decompositionConfig["slice_axis"]
+                                .json()
+                                .get<size_t>();
+                    }
+                }
+                catch (nlohmann::json::exception const &)
+                {
+                    throw error::BackendConfigSchema(
+                        {"hdf5", "dataset", "decomposition"},
+                        "Must be an object with optional keys 'block' (array "
+                        "of integer), 'chunk_size_window' (array of two "
+                        "integers) and 'slice_axis' (integer).");
+                }
+            }
+
+            if (datasetConfig.json().contains("chunk_cache"))
+            {
+                auto chunkCacheConfig = datasetConfig["chunk_cache"];
+                chunkCacheConfig.declareFullyRead();
+                chunk_cache = parseChunkCacheConfig(chunkCacheConfig.json());
+            }
+        }
+
+        /*
+         * Since the final extent of a joined array is unknown, chunk sizes
+         * are computed for a mock extent that yields chunks of about 1 MiB.
+         */
+        std::vector<hsize_t> chunking_dims = dims;
+        if (joinedDim.has_value())
+        {
+            hsize_t others = 1;
+            for (size_t i = 0; i < dims.size(); ++i)
+            {
+                if (i != *joinedDim)
+                {
+                    others *= std::max<hsize_t>(dims[i] / 2, 1);
+                }
+            }
+            hsize_t bytes_per_slice = others * toBytes(d);
+            chunking_dims[*joinedDim] = 2 *
+                std::max<hsize_t>(
+                    (1024 * 1024 + bytes_per_slice - 1) / bytes_per_slice, 1);
         }
+
+        auto computeDecompositionAwareChunking = [&]() {
+            std::vector<hsize_t> alignment;
+            if (decomposition_block.has_value())
+            {
+                if (decomposition_block->size() != dims.size())
+                {
+                    throw error::BackendConfigSchema(
+                        {"hdf5", "dataset", "decomposition", "block"},
+                        "Dimensionality must match the dataset's.");
+                }
+                alignment = *decomposition_block;
+            }
+            else
+            {
+                alignment = getDecompositionAlignment(
+                    parameters.initialChunks, dims.size());
+#if openPMD_HAVE_MPI
+                // dataset creation is collective, so merge the alignments
+                // of all writers
+                if (m_communicator.has_value() && !alignment.empty())
+                {
+                    int size = 0;
+                    MPI_Comm_size(*m_communicator, &size);
+                    std::vector<unsigned long long> local(
+                        alignment.begin(), alignment.end());
+                    std::vector<unsigned long long> all(
+                        local.size() * size_t(size));
+                    MPI_Allgather(
+                        local.data(),
+                        int(local.size()),
+                        MPI_UNSIGNED_LONG_LONG,
+                        all.data(),
+                        int(local.size()),
+                        MPI_UNSIGNED_LONG_LONG,
+                        *m_communicator);
+                    for (size_t i = 0; i < all.size(); ++i)
+                    {
+                        auto &merged = alignment[i % alignment.size()];
+                        merged = std::gcd(merged, hsize_t(all[i]));
+                    }
+                }
+#endif
+            }
+            if (decomposition_slice_axis.has_value() &&
+                *decomposition_slice_axis >= dims.size())
+            {
+                throw error::BackendConfigSchema(
+                    {"hdf5", "dataset", "decomposition", "slice_axis"},
+                    "Must be smaller than the dataset's dimensionality.");
+            }
+            return getDecompositionAwareChunkDims(
+                dims,
+                toBytes(d),
+                alignment,
+                decomposition_min_bytes,
+                decomposition_max_bytes,
+                decomposition_slice_axis);
+        };
+
         std::optional<chunking_t> chunking = std::visit(
             auxiliary::overloaded{
                 [&](chunking_t &&explicitly_specified)
@@ -592,10 +1405,17 @@ void HDF5IOHandlerImpl::createDataset(
                 },
                 [&](std::string const &method_name)
                     -> std::optional<chunking_t> {
-                    if (method_name == "auto")
+                    if (method_name == "auto" ||
+                        // offsets of joined arrays are not known yet
+                        (method_name == "decomposition" &&
+                         joinedDim.has_value()))
                     {
 
-                        return getOptimalChunkDims(dims, toBytes(d));
+                        return getOptimalChunkDims(chunking_dims, toBytes(d));
+                    }
+                    else if (method_name == "decomposition")
+                    {
+                        return computeDecompositionAwareChunking();
                     }
                     else if (method_name == "none")
                     {
@@ -608,6 +1428,12 @@ void HDF5IOHandlerImpl::createDataset(
                     }
                 }},
             std::move(compute_chunking));
+        if ((joinedDim.has_value() || codec.has_value()) &&
+            (!chunking.has_value() || chunking->size() != dims.size()))
+        {
+            // extending a dataset and filters require chunked layout
+            chunking = getOptimalChunkDims(chunking_dims, toBytes(d));
+        }
 
         parameters.warnUnusedParameters(
             config,
@@ -676,6 +1502,8 @@ void HDF5IOHandlerImpl::createDataset(
         std::vector<hsize_t> max_dims(dims.begin(), dims.end());
         if (is_resizable_dataset)
             max_dims.assign(dims.size(), H5F_UNLIMITED);
+        else if (joinedDim.has_value())
+            max_dims[*joinedDim] = H5F_UNLIMITED;
 
         hid_t space = H5Screate_simple(
             static_cast<int>(dims.size()), dims.data(), max_dims.data());
@@ -689,7 +1517,8 @@ void HDF5IOHandlerImpl::createDataset(
 
         H5Pset_fill_time(datasetCreationProperty, H5D_FILL_TIME_NEVER);
 
-        if (num_elements != 0u && chunking.has_value())
+        if ((num_elements != 0u || joinedDim.has_value()) &&
+            chunking.has_value())
         {
             if (chunking->size() != parameters.extent.size())
             {
@@ -728,36 +1557,22 @@ void HDF5IOHandlerImpl::createDataset(
                     status == 0,
                     "[HDF5] Internal error: Failed to set chunk size during "
                     "dataset creation");
+                if (codec.has_value())
+                {
+                    setCodecFilters(datasetCreationProperty, *codec);
+                }
+                if (chunk_cache.has_value())
+                {
+                    setupChunkCache(
+                        writable,
+                        *chunk_cache,
+                        chunking_dims,
+                        *chunking,
+                        toBytes(d));
+                }
             }
         }
 
-        std::string const &compression = ""; // @todo read from JSON
-        if (!compression.empty())
-            std::cerr
-                << "[HDF5] Compression not yet implemented in HDF5 backend."
-                << std::endl;
-        /*
-        {
-            std::vector< std::string > args = auxiliary::split(compression,
-        ":"); std::string const& format = args[0]; if( (format == "zlib" ||
-        format == "gzip" || format == "deflate")
-                && args.size() == 2 )
-            {
-                status = H5Pset_deflate(datasetCreationProperty,
-        std::stoi(args[1])); VERIFY(status == 0, "[HDF5] Internal error: Failed
-        to set deflate compression during dataset creation"); } else if( format
-        == "szip" || format == "nbit" || format == "scaleoffset" ) std::cerr <<
-        "[HDF5] Compression format " << format
-                          << " not yet implemented. Data will not be
-        compressed!"
-                          << std::endl;
-            else
-                std::cerr << "[HDF5] Compression format " << format
-                          << " unknown. Data will not be compressed!"
-                          << std::endl;
-        }
-         */
-
         GetH5DataType getH5DataType({
             {typeid(bool).name(), m_H5T_BOOL_ENUM},
             {typeid(std::complex<float>).name(), m_H5T_CFLOAT},
@@ -821,6 +1636,10 @@ void HDF5IOHandlerImpl::createDataset(
             std::make_shared<HDF5FilePosition>(name);
 
         m_fileNames[writable] = file.name;
+        if (joinedDim.has_value())
+        {
+            m_joinedDatasets.push_back({writable, *joinedDim, {}});
+        }
     }
 }
 
@@ -981,6 +1800,7 @@ void HDF5IOHandlerImpl::openFile(
     {
         return;
     }
+    m_closingFiles.await(name);
 
     unsigned flags;
     Access at = m_handler->m_backendAccess;
@@ -994,8 +1814,7 @@ void HDF5IOHandlerImpl::openFile(
     else
         flags = H5F_ACC_RDWR;
 
-    hid_t file_id;
-    file_id = H5Fopen(name.c_str(), flags, m_fileAccessProperty);
+    hid_t file_id = openH5File(name, flags);
     if (file_id < 0)
         throw error::ReadError(
             error::AffectedObject::File,
@@ -1011,6 +1830,40 @@ void HDF5IOHandlerImpl::openFile(
     m_openFileIDs.insert(file_id);
 }
 
+bool HDF5IOHandlerImpl::rankZeroMetadataReads() const
+{
+#if openPMD_HAVE_MPI
+    return m_handler->m_metadataCommunicator.has_value();
+#else
+    return false;
+#endif
+}
+
+void HDF5IOHandlerImpl::advance(
+    Writable *writable, Parameter<Operation::ADVANCE> &parameters)
+{
+    if (parameters.mode == AdvanceMode::ENDSTEP &&
+        access::write(m_handler->m_backendAccess))
+    {
+        // closing an iteration is collective, as is closing a file
+        flushJoinedDatasets();
+    }
+    AbstractIOHandlerImpl::advance(writable, parameters);
+}
+
+void HDF5IOHandlerImpl::closePath(
+    Writable *writable, Parameter<Operation::CLOSE_PATH> const &)
+{
+    if (access::readOnly(m_handler->m_backendAccess) || !writable->written)
+    {
+        return;
+    }
+    auto res = getFile(writable);
+    File file = res ? res.value() : getFile(writable->parent).value();
+    flushAttributes();
+    forgetWrittenAttributes(file.name, concrete_h5_file_position(writable));
+}
+
 void HDF5IOHandlerImpl::closeFile(
     Writable *writable, Parameter<Operation::CLOSE_FILE> const &)
 {
@@ -1022,7 +1875,38 @@ void HDF5IOHandlerImpl::closeFile(
             "present in the backend");
     }
     File file = optionalFile.value();
-    H5Fclose(file.id);
+    flushAttributes();
+    forgetWrittenAttributes(file.name);
+    // file closing is collective, so joined arrays are resolved here
+    flushJoinedDatasets();
+    m_joinedDatasets.erase(
+        std::remove_if(
+            m_joinedDatasets.begin(),
+            m_joinedDatasets.end(),
+            [this, &file](JoinedDataset const &ds) {
+                auto it = m_fileNames.find(ds.writable);
+                return it == m_fileNames.end() || it->second == file.name;
+            }),
+        m_joinedDatasets.end());
+    closeDatasetHandles(file.name);
+    if (m_handler->m_filesInFlight > 0 && m_threadsafeLibrary)
+    {
+        hid_t id = file.id;
+        m_closingFiles.close(
+            file.name,
+            [id, name = file.name]() {
+                if (H5Fclose(id) < 0)
+                {
+                    throw std::runtime_error(
+                        "[HDF5] Failed closing file '" + name + "'.");
+                }
+            },
+            m_handler->m_filesInFlight);
+    }
+    else
+    {
+        H5Fclose(file.id);
+    }
     m_openFileIDs.erase(file.id);
     m_fileNames.erase(writable);
 
@@ -1294,6 +2178,24 @@ void HDF5IOHandlerImpl::openDataset(
     auto extent = parameters.extent;
     *extent = e;
 
+    if (m_chunkCache.has_value())
+    {
+        hid_t datasetCreationProperty = H5Dget_create_plist(dataset_id);
+        std::vector<hsize_t> chunkDims(ndims, 0);
+        if (H5Pget_layout(datasetCreationProperty) == H5D_CHUNKED &&
+            H5Pget_chunk(datasetCreationProperty, ndims, chunkDims.data()) ==
+                ndims)
+        {
+            setupChunkCache(
+                writable,
+                *m_chunkCache,
+                dims,
+                chunkDims,
+                H5Tget_size(dataset_type));
+        }
+        H5Pclose(datasetCreationProperty);
+    }
+
     herr_t status;
     status = H5Sclose(dataset_space);
     if (status != 0)
@@ -1361,7 +2263,10 @@ void HDF5IOHandlerImpl::deleteFile(
 
     if (writable->written)
     {
-        hid_t file_id = getFile(writable).value().id;
+        File file = getFile(writable).value();
+        flushAttributes();
+        forgetWrittenAttributes(file.name);
+        hid_t file_id = file.id;
         herr_t status = H5Fclose(file_id);
         VERIFY(
             status == 0,
@@ -1409,6 +2314,8 @@ void HDF5IOHandlerImpl::deletePath(
          */
         auto res = getFile(writable);
         File file = res ? res.value() : getFile(writable->parent).value();
+        flushAttributes();
+        forgetWrittenAttributes(file.name);
         hid_t node_id = H5Gopen(
             file.id,
             concrete_h5_file_position(writable->parent).c_str(),
@@ -1461,6 +2368,8 @@ void HDF5IOHandlerImpl::deleteDataset(
          */
         auto res = getFile(writable);
         File file = res ? res.value() : getFile(writable->parent).value();
+        flushAttributes();
+        forgetWrittenAttributes(file.name);
         hid_t node_id = H5Gopen(
             file.id,
             concrete_h5_file_position(writable->parent).c_str(),
@@ -1487,6 +2396,7 @@ void HDF5IOHandlerImpl::deleteDataset(
         writable->abstractFilePosition.reset();
 
         m_fileNames.erase(writable);
+        forgetDatasetHandle(writable);
     }
 }
 
@@ -1505,6 +2415,8 @@ void HDF5IOHandlerImpl::deleteAttribute(
         /* Open H5Object to delete in */
         auto res = getFile(writable);
         File file = res ? res.value() : getFile(writable->parent).value();
+        flushAttributes();
+        forgetWrittenAttributes(file.name);
         hid_t node_id = H5Oopen(
             file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
         VERIFY(
@@ -1533,13 +2445,55 @@ void HDF5IOHandlerImpl::writeDataset(
             "[HDF5] Writing into a dataset in a file opened as read only is "
             "not possible.");
 
+    if (parameters.offset.empty() && !parameters.extent.empty())
+    {
+        // joined array, the offset is computed at the next collective point
+        auto joined = std::find_if(
+            m_joinedDatasets.begin(),
+            m_joinedDatasets.end(),
+            [writable](JoinedDataset const &ds) {
+                return ds.writable == writable;
+            });
+        if (joined == m_joinedDatasets.end())
+        {
+            throw error::WrongAPIUsage(
+                "[HDF5] Writing to a joined array is only possible for "
+                "datasets that were created as joined array in the same "
+                "Series.");
+        }
+        /*
+         * The deferred-data contract ends at the next flush, but the write
+         * happens only at the next collective point. Unless the frontend has
+         * handed over the buffer, copy it.
+         */
+        if (!std::holds_alternative<UniquePtrWithLambda<void>>(
+                parameters.data.m_buffer))
+        {
+            size_t bytes = toBytes(parameters.dtype);
+            for (auto ext : parameters.extent)
+            {
+                bytes *= ext;
+            }
+            UniquePtrWithLambda<void> copy(
+                new char[bytes], [](void *ptr) {
+                    delete[] static_cast<char *>(ptr);
+                });
+            if (bytes > 0)
+            {
+                std::memcpy(copy.get(), parameters.data.get(), bytes);
+            }
+            parameters.data = auxiliary::WriteBuffer(std::move(copy));
+        }
+        joined->pendingWrites.push_back(std::move(parameters));
+        return;
+    }
+
     auto res = getFile(writable);
     File file = res ? res.value() : getFile(writable->parent).value();
 
     hid_t dataset_id, filespace, memspace;
     herr_t status;
-    dataset_id = H5Dopen(
-        file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
+    dataset_id = openDatasetHandle(file, writable);
     VERIFY(
         dataset_id >= 0,
         "[HDF5] Internal error: Failed to open HDF5 dataset during dataset "
@@ -1638,47 +2592,124 @@ void HDF5IOHandlerImpl::writeDataset(
         status == 0,
         "[HDF5] Internal error: Failed to close dataset memory space during "
         "dataset write");
-    status = H5Dclose(dataset_id);
-    VERIFY(
-        status == 0,
-        "[HDF5] Internal error: Failed to close dataset " +
-            concrete_h5_file_position(writable) + " during dataset write");
+    releaseDatasetHandle(writable, dataset_id);
+
+    m_fileNames[writable] = file.name;
+}
+
+void HDF5IOHandlerImpl::writeAttribute(
+    Writable *writable, Parameter<Operation::WRITE_ATT> const &parameters)
+{
+    if (parameters.changesOverSteps ==
+        Parameter<Operation::WRITE_ATT>::ChangesOverSteps::Yes)
+    {
+        // cannot do this
+        return;
+    }
+    if (access::readOnly(m_handler->m_backendAccess))
+        throw std::runtime_error(
+            "[HDF5] Writing an attribute in a file opened as read only is not "
+            "possible.");
+
+    auto res = getFile(writable);
+    File file = res ? res.value() : getFile(writable->parent).value();
+    auto &pending = m_pendingAttributes[AttributeLocation{
+        file.name, concrete_h5_file_position(writable)}];
+    pending.fileID = file.id;
+    // a later write of the same attribute within one flush supersedes this one
+    pending.attributes.insert_or_assign(parameters.name, parameters);
 
     m_fileNames[writable] = file.name;
 }
 
-void HDF5IOHandlerImpl::writeAttribute(
-    Writable *writable, Parameter<Operation::WRITE_ATT> const &parameters)
+void HDF5IOHandlerImpl::flushAttributes()
+{
+    auto pendingAttributes = std::move(m_pendingAttributes);
+    m_pendingAttributes.clear();
+    herr_t status;
+    for (auto const &[location, pending] : pendingAttributes)
+    {
+        m_attributesInFlush.insert(location);
+        auto &written = m_writtenAttributes[location];
+        std::vector<Parameter<Operation::WRITE_ATT> const *> toWrite;
+        for (auto const &[name, parameters] : pending.attributes)
+        {
+            auto previous = written.find(name);
+            if (previous != written.end() &&
+                previous->second.first == parameters.dtype &&
+                previous->second.second == parameters.resource)
+            {
+                continue;
+            }
+            toWrite.push_back(&parameters);
+        }
+        if (toWrite.empty())
+        {
+            continue;
+        }
+
+        hid_t fapl = H5Pcreate(H5P_LINK_ACCESS);
+#if H5_VERSION_GE(1, 10, 0) && openPMD_HAVE_MPI
+        if (m_hdf5_collective_metadata)
+        {
+            H5Pset_all_coll_metadata_ops(fapl, true);
+        }
+#endif
+        hid_t node_id = H5Oopen(pending.fileID, location.second.c_str(), fapl);
+        VERIFY(
+            node_id >= 0,
+            "[HDF5] Internal error: Failed to open HDF5 object during "
+            "attribute write");
+        for (auto const *parameters : toWrite)
+        {
+            writeAttributeValue(node_id, location.second, *parameters);
+            written.insert_or_assign(
+                parameters->name,
+                std::make_pair(parameters->dtype, parameters->resource));
+        }
+        status = H5Oclose(node_id);
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to close " + location.second +
+                " during attribute write");
+        status = H5Pclose(fapl);
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to close HDF5 property during "
+            "attribute write");
+    }
+}
+
+void HDF5IOHandlerImpl::forgetWrittenAttributes(
+    std::string const &fileName, std::string const &groupPath)
 {
-    if (parameters.changesOverSteps ==
-        Parameter<Operation::WRITE_ATT>::ChangesOverSteps::Yes)
+    std::string prefix = groupPath;
+    if (!auxiliary::ends_with(prefix, '/'))
     {
-        // cannot do this
-        return;
+        prefix += '/';
     }
-    if (access::readOnly(m_handler->m_backendAccess))
-        throw std::runtime_error(
-            "[HDF5] Writing an attribute in a file opened as read only is not "
-            "possible.");
-
-    auto res = getFile(writable);
-    File file = res ? res.value() : getFile(writable->parent).value();
-    hid_t node_id, attribute_id;
-
-    hid_t fapl = H5Pcreate(H5P_LINK_ACCESS);
-#if H5_VERSION_GE(1, 10, 0) && openPMD_HAVE_MPI
-    if (m_hdf5_collective_metadata)
+    for (auto it = m_writtenAttributes.begin();
+         it != m_writtenAttributes.end();)
     {
-        H5Pset_all_coll_metadata_ops(fapl, true);
+        auto const &[file, path] = it->first;
+        if (file == fileName &&
+            (auxiliary::starts_with(path, prefix) || path + '/' == prefix))
+        {
+            it = m_writtenAttributes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
     }
-#endif
+}
 
-    node_id =
-        H5Oopen(file.id, concrete_h5_file_position(writable).c_str(), fapl);
-    VERIFY(
-        node_id >= 0,
-        "[HDF5] Internal error: Failed to open HDF5 object during attribute "
-        "write");
+void HDF5IOHandlerImpl::writeAttributeValue(
+    hid_t node_id,
+    std::string const &path,
+    Parameter<Operation::WRITE_ATT> const &parameters)
+{
+    hid_t attribute_id;
     Attribute const att(parameters.resource);
     Datatype dtype = parameters.dtype;
     herr_t status;
@@ -1930,7 +2961,7 @@ void HDF5IOHandlerImpl::writeAttribute(
     VERIFY(
         status == 0,
         "[HDF5] Internal error: Failed to write attribute " + name + " at " +
-            concrete_h5_file_position(writable));
+            path);
 
     status = H5Tclose(dataType);
     VERIFY(
@@ -1942,19 +2973,7 @@ void HDF5IOHandlerImpl::writeAttribute(
     VERIFY(
         status == 0,
         "[HDF5] Internal error: Failed to close attribute " + name + " at " +
-            concrete_h5_file_position(writable) + " during attribute write");
-    status = H5Oclose(node_id);
-    VERIFY(
-        status == 0,
-        "[HDF5] Internal error: Failed to close " +
-            concrete_h5_file_position(writable) + " during attribute write");
-    status = H5Pclose(fapl);
-    VERIFY(
-        status == 0,
-        "[HDF5] Internal error: Failed to close HDF5 property during attribute "
-        "write");
-
-    m_fileNames[writable] = file.name;
+            path + " during attribute write");
 }
 
 void HDF5IOHandlerImpl::readDataset(
@@ -1964,8 +2983,7 @@ void HDF5IOHandlerImpl::readDataset(
     File file = res ? res.value() : getFile(writable->parent).value();
     hid_t dataset_id, memspace, filespace;
     herr_t status;
-    dataset_id = H5Dopen(
-        file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
+    dataset_id = openDatasetHandle(file, writable);
     VERIFY(
         dataset_id >= 0,
         "[HDF5] Internal error: Failed to open HDF5 dataset during dataset "
@@ -2093,10 +3111,150 @@ void HDF5IOHandlerImpl::readDataset(
         status == 0,
         "[HDF5] Internal error: Failed to close dataset memory space during "
         "dataset read");
-    status = H5Dclose(dataset_id);
+    releaseDatasetHandle(writable, dataset_id);
+}
+
+void HDF5IOHandlerImpl::getBufferView(
+    Writable *writable, Parameter<Operation::GET_BUFFER_VIEW> &parameters)
+{
+    // written via writeDataset() at the next flush point
+    getPooledBufferView(writable, parameters);
+}
+
+void HDF5IOHandlerImpl::readDatasetView(
+    Writable *writable, Parameter<Operation::READ_DATASET_VIEW> &parameters)
+{
+    parameters.out->backendManagedBuffer = false;
+#ifndef _WIN32
+    /*
+     * Map the file contents of uncompressed, contiguous datasets into memory
+     * instead of reading them. This is only safe if nobody writes to the file
+     * and if the file is a plain POSIX file, i.e. not opened through the
+     * MPI-IO driver or any other virtual file driver.
+     * Type conversions are not possible either, so the type in the file must
+     * match the native type. The workarounds for bool and long double types
+     * are not supported here.
+     */
+    if (!access::readOnly(m_handler->m_backendAccess))
+    {
+        return;
+    }
+    switch (parameters.dtype)
+    {
+        using DT = Datatype;
+    case DT::BOOL:
+    case DT::LONG_DOUBLE:
+    case DT::CLONG_DOUBLE:
+    case DT::UNDEFINED:
+        return;
+    default:
+        break;
+    }
+
+    auto res = getFile(writable);
+    File file = res ? res.value() : getFile(writable->parent).value();
+    // m_fileAccessProperty may be H5P_DEFAULT, so ask the file itself
+    hid_t fileAccessProperty = H5Fget_access_plist(file.id);
+    bool posixDriver = H5Pget_driver(fileAccessProperty) == H5FD_SEC2;
+    H5Pclose(fileAccessProperty);
+    if (!posixDriver)
+    {
+        return;
+    }
+    hid_t dataset_id = H5Dopen(
+        file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
+    VERIFY(
+        dataset_id >= 0,
+        "[HDF5] Internal error: Failed to open HDF5 dataset during dataset "
+        "view read");
+
+    std::optional<uint64_t> firstElement;
+    size_t elementSize = 0;
+    haddr_t datasetAddress = H5Dget_offset(dataset_id);
+    hid_t plist = H5Dget_create_plist(dataset_id);
+    bool contiguous = H5Pget_layout(plist) == H5D_CONTIGUOUS;
+    H5Pclose(plist);
+    if (contiguous && datasetAddress != HADDR_UNDEF)
+    {
+        Attribute a(0);
+        a.dtype = parameters.dtype;
+        GetH5DataType getH5DataType({
+            {typeid(bool).name(), m_H5T_BOOL_ENUM},
+            {typeid(std::complex<float>).name(), m_H5T_CFLOAT},
+            {typeid(std::complex<double>).name(), m_H5T_CDOUBLE},
+            {typeid(std::complex<long double>).name(), m_H5T_CLONG_DOUBLE},
+        });
+        hid_t memoryType = getH5DataType(a);
+        hid_t fileType = H5Dget_type(dataset_id);
+        if (H5Tequal(memoryType, fileType) > 0)
+        {
+            elementSize = H5Tget_size(fileType);
+            hid_t filespace = H5Dget_space(dataset_id);
+            int ndims = H5Sget_simple_extent_ndims(filespace);
+            std::vector<hsize_t> dims(ndims < 0 ? 0 : ndims);
+            H5Sget_simple_extent_dims(filespace, dims.data(), nullptr);
+            H5Sclose(filespace);
+            firstElement = auxiliary::contiguousSelectionStart(
+                Extent(dims.begin(), dims.end()),
+                parameters.offset,
+                parameters.extent);
+        }
+        H5Tclose(fileType);
+        H5Tclose(memoryType);
+    }
+    herr_t status = H5Dclose(dataset_id);
     VERIFY(
         status == 0,
-        "[HDF5] Internal error: Failed to close dataset during dataset read");
+        "[HDF5] Internal error: Failed to close dataset during dataset view "
+        "read");
+    if (!firstElement.has_value())
+    {
+        return;
+    }
+
+    size_t numElements = 1;
+    for (auto ext : parameters.extent)
+    {
+        numElements *= ext;
+    }
+    ssize_t nameLength = H5Fget_name(file.id, nullptr, 0);
+    if (nameLength <= 0)
+    {
+        return;
+    }
+    std::string fileName(nameLength + 1, '\0');
+    H5Fget_name(file.id, fileName.data(), fileName.size());
+    fileName.resize(nameLength);
+
+    off_t byteOffset =
+        off_t(datasetAddress) + off_t(*firstElement * elementSize);
+    off_t pageSize = off_t(sysconf(_SC_PAGESIZE));
+    off_t alignedOffset = byteOffset - byteOffset % pageSize;
+    size_t mappedLength =
+        numElements * elementSize + size_t(byteOffset - alignedOffset);
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+    void *mapping =
+        mmap(nullptr, mappedLength, PROT_READ, MAP_PRIVATE, fd, alignedOffset);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        return;
+    }
+    parameters.out->owner = std::shared_ptr<void const>(
+        mapping, [mappedLength](void const *ptr) {
+            munmap(const_cast<void *>(ptr), mappedLength);
+        });
+    parameters.out->ptr =
+        static_cast<char const *>(mapping) + (byteOffset - alignedOffset);
+    parameters.out->backendManagedBuffer = true;
+#else
+    (void)writable;
+#endif
 }
 
 void HDF5IOHandlerImpl::readAttribute(
@@ -2106,6 +3264,8 @@ void HDF5IOHandlerImpl::readAttribute(
         throw std::runtime_error(
             "[HDF5] Internal error: Writable not marked written during "
             "attribute read");
+    // make attribute writes of the current flush visible
+    flushAttributes();
 
     auto res = getFile(writable);
     File file = res ? res.value() : getFile(writable->parent).value();
@@ -2117,7 +3277,7 @@ void HDF5IOHandlerImpl::readAttribute(
 #if H5_VERSION_GE(1, 10, 0) && openPMD_HAVE_MPI
     if (m_hdf5_collective_metadata)
     {
-        H5Pset_all_coll_metadata_ops(fapl, true);
+        H5Pset_all_coll_metadata_ops(fapl, !rankZeroMetadataReads());
     }
 #endif
 
@@ -2134,7 +3294,8 @@ void HDF5IOHandlerImpl::readAttribute(
                 "' during attribute read");
     }
     std::string const &attr_name = parameters.name;
-    attr_id = H5Aopen(obj_id, attr_name.c_str(), H5P_DEFAULT);
+    attr_id =
+        H5Aopen_by_name(obj_id, ".", attr_name.c_str(), H5P_DEFAULT, fapl);
     if (attr_id < 0)
     {
         throw error::ReadError(
@@ -2736,7 +3897,7 @@ void HDF5IOHandlerImpl::listPaths(
 #if H5_VERSION_GE(1, 10, 0) && openPMD_HAVE_MPI
     if (m_hdf5_collective_metadata)
     {
-        H5Pset_all_coll_metadata_ops(gapl, true);
+        H5Pset_all_coll_metadata_ops(gapl, !rankZeroMetadataReads());
     }
 #endif
 
@@ -2747,7 +3908,7 @@ void HDF5IOHandlerImpl::listPaths(
         "[HDF5] Internal error: Failed to open HDF5 group during path listing");
 
     H5G_info_t group_info;
-    herr_t status = H5Gget_info(node_id, &group_info);
+    herr_t status = H5Gget_info_by_name(node_id, ".", &group_info, gapl);
     VERIFY(
         status == 0,
         "[HDF5] Internal error: Failed to get HDF5 group info for " +
@@ -2756,12 +3917,9 @@ void HDF5IOHandlerImpl::listPaths(
     auto paths = parameters.paths;
     for (hsize_t i = 0; i < group_info.nlinks; ++i)
     {
-        if (H5G_GROUP == H5Gget_objtype_by_idx(node_id, i))
+        if (linkedObjectType(node_id, i, gapl) == H5O_TYPE_GROUP)
         {
-            ssize_t name_length = H5Gget_objname_by_idx(node_id, i, nullptr, 0);
-            std::vector<char> name(name_length + 1);
-            H5Gget_objname_by_idx(node_id, i, name.data(), name_length + 1);
-            paths->push_back(std::string(name.data(), name_length));
+            paths->push_back(linkName(node_id, i, gapl));
         }
     }
 
@@ -2792,7 +3950,7 @@ void HDF5IOHandlerImpl::listDatasets(
 #if H5_VERSION_GE(1, 10, 0) && openPMD_HAVE_MPI
     if (m_hdf5_collective_metadata)
     {
-        H5Pset_all_coll_metadata_ops(gapl, true);
+        H5Pset_all_coll_metadata_ops(gapl, !rankZeroMetadataReads());
     }
 #endif
 
@@ -2804,7 +3962,7 @@ void HDF5IOHandlerImpl::listDatasets(
         "listing");
 
     H5G_info_t group_info;
-    herr_t status = H5Gget_info(node_id, &group_info);
+    herr_t status = H5Gget_info_by_name(node_id, ".", &group_info, gapl);
     VERIFY(
         status == 0,
         "[HDF5] Internal error: Failed to get HDF5 group info for " +
@@ -2813,12 +3971,9 @@ void HDF5IOHandlerImpl::listDatasets(
     auto datasets = parameters.datasets;
     for (hsize_t i = 0; i < group_info.nlinks; ++i)
     {
-        if (H5G_DATASET == H5Gget_objtype_by_idx(node_id, i))
+        if (linkedObjectType(node_id, i, gapl) == H5O_TYPE_DATASET)
         {
-            ssize_t name_length = H5Gget_objname_by_idx(node_id, i, nullptr, 0);
-            std::vector<char> name(name_length + 1);
-            H5Gget_objname_by_idx(node_id, i, name.data(), name_length + 1);
-            datasets->push_back(std::string(name.data(), name_length));
+            datasets->push_back(linkName(node_id, i, gapl));
         }
     }
 
@@ -2841,6 +3996,7 @@ void HDF5IOHandlerImpl::listAttributes(
         throw std::runtime_error(
             "[HDF5] Internal error: Writable not marked written during "
             "attribute listing");
+    flushAttributes();
 
     auto res = getFile(writable);
     File file = res ? res.value() : getFile(writable->parent).value();
@@ -2850,7 +4006,7 @@ void HDF5IOHandlerImpl::listAttributes(
 #if H5_VERSION_GE(1, 10, 0) && openPMD_HAVE_MPI
     if (m_hdf5_collective_metadata)
     {
-        H5Pset_all_coll_metadata_ops(fapl, true);
+        H5Pset_all_coll_metadata_ops(fapl, !rankZeroMetadataReads());
     }
 #endif
 
@@ -2864,10 +4020,11 @@ void HDF5IOHandlerImpl::listAttributes(
     herr_t status;
 #if H5_VERSION_GE(1, 12, 0)
     H5O_info2_t object_info;
-    status = H5Oget_info3(node_id, &object_info, H5O_INFO_NUM_ATTRS);
+    status = H5Oget_info_by_name3(
+        node_id, ".", &object_info, H5O_INFO_NUM_ATTRS, fapl);
 #else
     H5O_info_t object_info;
-    status = H5Oget_info(node_id, &object_info);
+    status = H5Oget_info_by_name(node_id, ".", &object_info, fapl);
 #endif
     VERIFY(
         status == 0,
@@ -2885,7 +4042,7 @@ void HDF5IOHandlerImpl::listAttributes(
             i,
             nullptr,
             0,
-            H5P_DEFAULT);
+            fapl);
         std::vector<char> name(name_length + 1);
         H5Aget_name_by_idx(
             node_id,
@@ -2895,7 +4052,7 @@ void HDF5IOHandlerImpl::listAttributes(
             i,
             name.data(),
             name_length + 1,
-            H5P_DEFAULT);
+            fapl);
         attributes->push_back(std::string(name.data(), name_length));
     }
 
@@ -2915,6 +4072,16 @@ void HDF5IOHandlerImpl::deregister(
     Writable *writable, Parameter<Operation::DEREGISTER> const &)
 {
     m_fileNames.erase(writable);
+    forgetPooledBufferViews(writable);
+    forgetDatasetHandle(writable);
+    m_joinedDatasets.erase(
+        std::remove_if(
+            m_joinedDatasets.begin(),
+            m_joinedDatasets.end(),
+            [writable](JoinedDataset const &ds) {
+                return ds.writable == writable;
+            }),
+        m_joinedDatasets.end());
 }
 
 void HDF5IOHandlerImpl::touch(Writable *, Parameter<Operation::TOUCH> const &)
@@ -2941,9 +4108,366 @@ HDF5IOHandlerImpl::getFile(Writable *writable)
     return std::make_optional(std::move(res));
 }
 
+hid_t HDF5IOHandlerImpl::openH5File(std::string const &name, unsigned flags)
+{
+    if (m_pageBuffer.has_value())
+    {
+        // files written without paged allocation reject a page buffer,
+        // open those without one
+        hid_t id;
+        H5E_BEGIN_TRY
+        {
+            id = H5Fopen(name.c_str(), flags, m_pagedFileAccessProperty);
+        }
+        H5E_END_TRY;
+        if (id >= 0)
+        {
+            return id;
+        }
+    }
+    return H5Fopen(name.c_str(), flags, m_fileAccessProperty);
+}
+
+auto HDF5IOHandlerImpl::parseChunkCacheConfig(nlohmann::json const &config)
+    -> std::optional<ChunkCacheConfig>
+{
+    auto throw_schema_error = []() {
+        throw error::BackendConfigSchema(
+            {"hdf5", "dataset", "chunk_cache"},
+            R"(Must be "auto", "none" or an object with optional keys )"
+            R"('size' and 'slots' (integer or "auto"), 'policy' (number )"
+            R"(between 0 and 1), 'max_size' and 'total_max_size' )"
+            R"((integer).)");
+    };
+    if (config.is_string())
+    {
+        auto method = json::asLowerCaseStringDynamic(config).value();
+        if (method == "auto")
+        {
+            return ChunkCacheConfig{};
+        }
+        else if (method == "none")
+        {
+            return std::nullopt;
+        }
+        throw_schema_error();
+    }
+    if (!config.is_object())
+    {
+        throw_schema_error();
+    }
+
+    auto sizeOrAuto = [&](char const *key) -> std::optional<size_t> {
+        if (!config.contains(key))
+        {
+            return std::nullopt;
+        }
+        auto const &value = config.at(key);
+        if (value.is_string() &&
+            json::asLowerCaseStringDynamic(value).value() == "auto")
+        {
+            return std::nullopt;
+        }
+        if (!value.is_number_unsigned())
+        {
+            throw_schema_error();
+        }
+        return value.get<size_t>();
+    };
+    ChunkCacheConfig res;
+    res.bytes = sizeOrAuto("size");
+    res.slots = sizeOrAuto("slots");
+    if (config.contains("policy"))
+    {
+        auto const &policy = config.at("policy");
+        if (!policy.is_number() || policy.get<double>() < 0. ||
+            policy.get<double>() > 1.)
+        {
+            throw_schema_error();
+        }
+        res.preemption = policy.get<double>();
+    }
+    if (config.contains("max_size"))
+    {
+        if (!config.at("max_size").is_number_unsigned())
+        {
+            throw_schema_error();
+        }
+        res.maxBytes = config.at("max_size").get<size_t>();
+    }
+    if (config.contains("total_max_size"))
+    {
+        if (!config.at("total_max_size").is_number_unsigned())
+        {
+            throw_schema_error();
+        }
+        res.totalMaxBytes = config.at("total_max_size").get<size_t>();
+    }
+    return res;
+}
+
+void HDF5IOHandlerImpl::setupChunkCache(
+    Writable *writable,
+    ChunkCacheConfig const &config,
+    std::vector<hsize_t> const &dims,
+    std::vector<hsize_t> const &chunkDims,
+    size_t typeSize)
+{
+    auto [autoBytes, autoSlots] =
+        getChunkCacheSize(dims, chunkDims, typeSize, config.maxBytes);
+    hid_t dapl = H5Pcreate(H5P_DATASET_ACCESS);
+    VERIFY(
+        dapl >= 0,
+        "[HDF5] Internal error: Failed to create dataset access property");
+    size_t cacheBytes = config.bytes.value_or(autoBytes);
+    herr_t status = H5Pset_chunk_cache(
+        dapl, config.slots.value_or(autoSlots), cacheBytes, config.preemption);
+    VERIFY(
+        status >= 0,
+        "[HDF5] Internal error: Failed to set chunk cache on dataset access "
+        "property");
+    forgetDatasetHandle(writable);
+    m_datasetAccessProperties[writable] = DatasetAccess{dapl, cacheBytes};
+}
+
+hid_t HDF5IOHandlerImpl::openDatasetHandle(File const &file, Writable *writable)
+{
+    if (auto it = m_openDatasets.find(writable); it != m_openDatasets.end())
+    {
+        it->second.lastUse = ++m_datasetUseCounter;
+        return it->second.id;
+    }
+    auto access = m_datasetAccessProperties.find(writable);
+    if (access == m_datasetAccessProperties.end())
+    {
+        return H5Dopen(
+            file.id, concrete_h5_file_position(writable).c_str(), H5P_DEFAULT);
+    }
+    hid_t dataset_id = H5Dopen(
+        file.id,
+        concrete_h5_file_position(writable).c_str(),
+        access->second.dapl);
+    if (dataset_id < 0)
+    {
+        return dataset_id;
+    }
+    // make room in the budget, closing the least recently used handles
+    size_t budget = m_chunkCache.has_value()
+        ? m_chunkCache->totalMaxBytes
+        : ChunkCacheConfig{}.totalMaxBytes;
+    while (!m_openDatasets.empty() &&
+           m_openDatasetsCacheBytes + access->second.cacheBytes > budget)
+    {
+        auto lru = std::min_element(
+            m_openDatasets.begin(),
+            m_openDatasets.end(),
+            [](auto const &left, auto const &right) {
+                return left.second.lastUse < right.second.lastUse;
+            });
+        if (H5Dclose(lru->second.id) < 0)
+        {
+            std::cerr << "[HDF5] Internal error: Failed to close dataset "
+                         "handle\n";
+        }
+        m_openDatasetsCacheBytes -= lru->second.cacheBytes;
+        m_openDatasets.erase(lru);
+    }
+    m_openDatasets.emplace(
+        writable,
+        OpenDataset{
+            dataset_id, access->second.cacheBytes, ++m_datasetUseCounter});
+    m_openDatasetsCacheBytes += access->second.cacheBytes;
+    return dataset_id;
+}
+
+void HDF5IOHandlerImpl::releaseDatasetHandle(
+    Writable *writable, hid_t dataset_id)
+{
+    if (auto it = m_openDatasets.find(writable);
+        it != m_openDatasets.end() && it->second.id == dataset_id)
+    {
+        // kept open until the file is closed or the budget is exceeded
+        return;
+    }
+    herr_t status = H5Dclose(dataset_id);
+    VERIFY(
+        status == 0,
+        "[HDF5] Internal error: Failed to close dataset " +
+            concrete_h5_file_position(writable));
+}
+
+void HDF5IOHandlerImpl::closeDatasetHandles(
+    std::optional<std::string> const &fileName)
+{
+    for (auto it = m_openDatasets.begin(); it != m_openDatasets.end();)
+    {
+        if (fileName.has_value())
+        {
+            auto file = m_fileNames.find(it->first);
+            if (file != m_fileNames.end() && file->second != *fileName)
+            {
+                ++it;
+                continue;
+            }
+        }
+        if (H5Dclose(it->second.id) < 0)
+        {
+            std::cerr << "[HDF5] Internal error: Failed to close dataset "
+                         "handle\n";
+        }
+        m_openDatasetsCacheBytes -= it->second.cacheBytes;
+        it = m_openDatasets.erase(it);
+    }
+}
+
+void HDF5IOHandlerImpl::forgetDatasetHandle(Writable *writable)
+{
+    if (auto it = m_openDatasets.find(writable); it != m_openDatasets.end())
+    {
+        H5Dclose(it->second.id);
+        m_openDatasetsCacheBytes -= it->second.cacheBytes;
+        m_openDatasets.erase(it);
+    }
+    if (auto it = m_datasetAccessProperties.find(writable);
+        it != m_datasetAccessProperties.end())
+    {
+        H5Pclose(it->second.dapl);
+        m_datasetAccessProperties.erase(it);
+    }
+}
+
+void HDF5IOHandlerImpl::flushJoinedDatasets()
+{
+    if (m_joinedDatasets.empty())
+    {
+        return;
+    }
+    /*
+     * One fused scan over all joined arrays yields this rank's offset into
+     * each of them, one reduction their new global size.
+     */
+    size_t const n = m_joinedDatasets.size();
+    std::vector<unsigned long long> localSizes(n, 0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto const &ds = m_joinedDatasets[i];
+        for (auto const &write : ds.pendingWrites)
+        {
+            localSizes[i] += write.extent.at(ds.joinedDimension);
+        }
+    }
+    std::vector<unsigned long long> offsets(n, 0);
+    std::vector<unsigned long long> totals = localSizes;
+#if openPMD_HAVE_MPI
+    if (m_communicator.has_value())
+    {
+        int rank = 0;
+        MPI_Comm_rank(*m_communicator, &rank);
+        MPI_Exscan(
+            localSizes.data(),
+            offsets.data(),
+            int(n),
+            MPI_UNSIGNED_LONG_LONG,
+            MPI_SUM,
+            *m_communicator);
+        if (rank == 0)
+        {
+            // MPI_Exscan leaves the receive buffer undefined on rank 0
+            std::fill(offsets.begin(), offsets.end(), 0);
+        }
+        MPI_Allreduce(
+            localSizes.data(),
+            totals.data(),
+            int(n),
+            MPI_UNSIGNED_LONG_LONG,
+            MPI_SUM,
+            *m_communicator);
+    }
+#endif
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto &ds = m_joinedDatasets[i];
+        auto pendingWrites = std::move(ds.pendingWrites);
+        ds.pendingWrites.clear();
+        if (totals[i] == 0)
+        {
+            continue;
+        }
+        File file = getFile(ds.writable).value();
+        hid_t dataset_id = openDatasetHandle(file, ds.writable);
+        VERIFY(
+            dataset_id >= 0,
+            "[HDF5] Internal error: Failed to open HDF5 dataset during joined "
+            "array write");
+        hid_t dataset_space = H5Dget_space(dataset_id);
+        int ndims = H5Sget_simple_extent_ndims(dataset_space);
+        VERIFY(
+            ndims > int(ds.joinedDimension),
+            "[HDF5] Internal error: Failed to retrieve dimensionality of "
+            "joined array");
+        std::vector<hsize_t> dims(ndims);
+        H5Sget_simple_extent_dims(dataset_space, dims.data(), nullptr);
+        herr_t status = H5Sclose(dataset_space);
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to close dataset space during "
+            "joined array write");
+
+        // append to what previous flushes wrote
+        hsize_t offset = dims[ds.joinedDimension] + offsets[i];
+        dims[ds.joinedDimension] += totals[i];
+        status = H5Dset_extent(dataset_id, dims.data());
+        VERIFY(
+            status == 0,
+            "[HDF5] Internal error: Failed to extend joined array " +
+                concrete_h5_file_position(ds.writable));
+        releaseDatasetHandle(ds.writable, dataset_id);
+
+        for (auto &write : pendingWrites)
+        {
+            write.offset = Offset(write.extent.size(), 0);
+            write.offset[ds.joinedDimension] = offset;
+            offset += write.extent[ds.joinedDimension];
+            writeDataset(ds.writable, write);
+        }
+    }
+}
+
 std::future<void> HDF5IOHandlerImpl::flush(internal::ParsedFlushParams &params)
 {
+    if (params.flushLevel == FlushLevel::UserFlush)
+    {
+        // flush point: the user is done filling buffers from storeChunk()
+        writePooledBufferViews();
+    }
     auto res = AbstractIOHandlerImpl::flush();
+    flushAttributes();
+    if (params.flushLevel == FlushLevel::UserFlush &&
+        !m_attributesInFlush.empty())
+    {
+        /*
+         * Forget objects without attribute writes since the last user flush
+         * that wrote attributes, e.g. those of closed Iterations, so the
+         * cache does not grow with each Iteration. At worst, unchanged
+         * attributes are written again.
+         */
+        for (auto it = m_writtenAttributes.begin();
+             it != m_writtenAttributes.end();)
+        {
+            if (m_attributesInFlush.find(it->first) ==
+                m_attributesInFlush.end())
+            {
+                it = m_writtenAttributes.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        m_attributesInFlush.clear();
+    }
+    m_closingFiles.reapFinished();
 
     if (params.backendConfig.json().contains("hdf5"))
     {
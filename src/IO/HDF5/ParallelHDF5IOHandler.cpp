@@ -91,6 +91,13 @@ ParallelHDF5IOHandlerImpl::ParallelHDF5IOHandlerImpl(
     // Set this so the parent class can use the MPI communicator in functions
     // that are written with special implemenations for MPI-enabled HDF5.
     m_communicator = m_mpiComm;
+    if (m_pageBuffer.has_value())
+    {
+        std::cerr << "[HDF5] Page buffering is not supported by parallel "
+                     "HDF5, ignoring 'hdf5.page_buffer'."
+                  << std::endl;
+        m_pageBuffer.reset();
+    }
     m_datasetTransferProperty = H5Pcreate(H5P_DATASET_XFER);
     m_fileAccessProperty = H5Pcreate(H5P_FILE_ACCESS);
     m_fileCreateProperty = H5Pcreate(H5P_FILE_CREATE);
@@ -358,6 +365,28 @@ ParallelHDF5IOHandlerImpl::ParallelHDF5IOHandlerImpl(
 
 ParallelHDF5IOHandlerImpl::~ParallelHDF5IOHandlerImpl()
 {
+    try
+    {
+        // closing the remaining files is the last collective point
+        flushJoinedDatasets();
+        m_joinedDatasets.clear();
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "[HDF5] Failed writing joined arrays before closing: "
+                  << e.what() << std::endl;
+    }
+    try
+    {
+        flushAttributes();
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "[HDF5] Failed writing attributes before closing: "
+                  << e.what() << std::endl;
+    }
+    // parallel HDF5 does not close files with objects still open in them
+    closeDatasetHandles(std::nullopt);
     herr_t status;
     while (!m_openFileIDs.empty())
     {
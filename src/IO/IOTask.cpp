@@ -19,6 +19,7 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 #include "openPMD/IO/IOTask.hpp"
+#include "openPMD/Error.hpp"
 #include "openPMD/auxiliary/JSON_internal.hpp"
 #include "openPMD/backend/Attributable.hpp"
 
@@ -31,6 +32,45 @@ Writable *getWritable(Attributable *a)
     return &a->writable();
 }
 
+std::shared_ptr<json::ParsedConfig const>
+Parameter<Operation::CREATE_DATASET>::getParsedOptions() const
+{
+    return parsedOptions ? parsedOptions : json::parseOptionsCached(options);
+}
+
+std::optional<auxiliary::Codec>
+Parameter<Operation::CREATE_DATASET>::getCodec() const
+{
+    auto const &config = getParsedOptions()->config;
+    auto it = config.find("codec");
+    if (it == config.end())
+    {
+        return std::nullopt;
+    }
+    std::optional<auxiliary::Codec> res;
+    if (auto codecName = json::asLowerCaseStringDynamic(*it);
+        codecName.has_value())
+    {
+        // "auto" is resolved by the frontend, see RecordComponent::flush()
+        res = *codecName == "auto"
+            ? std::make_optional<auxiliary::Codec>(
+                  auxiliary::Codec{auxiliary::Codec::Shuffle::None, false})
+            : auxiliary::Codec::fromString(*codecName);
+    }
+    if (!res.has_value())
+    {
+        throw error::BackendConfigSchema(
+            {"codec"},
+            R"(Must be one of "none", "lz", "shuffle", "shuffle_lz", )"
+            R"("bitshuffle" or "bitshuffle_lz".)");
+    }
+    if (res->isIdentity())
+    {
+        res.reset();
+    }
+    return res;
+}
+
 template <>
 void Parameter<Operation::CREATE_DATASET>::warnUnusedParameters<
     json::TracingJSON>(
@@ -42,7 +82,7 @@ void Parameter<Operation::CREATE_DATASET>::warnUnusedParameters<
      * Fake-read non-backend-specific options. Some backends don't read those
      * and we don't want to have warnings for them.
      */
-    for (char const *key : {"resizable"})
+    for (char const *key : {"resizable", "codec"})
     {
         config[key];
     }
@@ -149,6 +189,12 @@ namespace internal
         case Operation::AVAILABLE_CHUNKS:
             return "AVAILABLE_CHUNKS";
             break;
+        case Operation::PREFETCH_FILE:
+            return "PREFETCH_FILE";
+            break;
+        case Operation::READ_DATASET_VIEW:
+            return "READ_DATASET_VIEW";
+            break;
         default:
             return "unknown";
             break;
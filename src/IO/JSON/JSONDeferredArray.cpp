@@ -0,0 +1,577 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/IO/JSON/JSONDeferredArray.hpp"
+#include "openPMD/Error.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+namespace openPMD::json
+{
+namespace
+{
+    // marks binary values as DeferredArray stand-ins
+    constexpr std::uint8_t deferredArraySubtype = 0x4f;
+    // distance in bytes after which a new block of elements begins
+    constexpr uint64_t blockSize = 1 << 20;
+    // smaller selections are parsed in the calling thread
+    constexpr uint64_t parallelThreshold = 8 * blockSize;
+
+    [[noreturn]] void corrupt(std::string const &what)
+    {
+        throw error::ReadError(
+            error::AffectedObject::Dataset,
+            error::Reason::UnexpectedContent,
+            "JSON",
+            what);
+    }
+
+    /*
+     * Input iterator over a stream that counts the characters taken from it,
+     * so the SAX handler knows the byte position of each event.
+     * The nlohmann::json parser takes the opening and closing brackets of
+     * arrays right before reporting them, but reads one character past
+     * numbers.
+     */
+    class CountingIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = char;
+        using difference_type = std::ptrdiff_t;
+        using pointer = char const *;
+        using reference = char;
+
+        CountingIterator() = default;
+        CountingIterator(std::istream &stream, uint64_t *counter)
+            : m_it(stream), m_counter(counter)
+        {}
+
+        char operator*() const
+        {
+            return *m_it;
+        }
+
+        CountingIterator &operator++()
+        {
+            ++m_it;
+            ++*m_counter;
+            return *this;
+        }
+
+        bool operator==(CountingIterator const &other) const
+        {
+            return m_it == other.m_it;
+        }
+
+        bool operator!=(CountingIterator const &other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        std::istreambuf_iterator<char> m_it;
+        uint64_t *m_counter = nullptr;
+    };
+
+    /*
+     * Builds the JSON value like nlohmann::json::parse() would, except for
+     * arrays under the key "data", which are only scanned for their shape
+     * and block positions.
+     */
+    class DeferringSax
+    {
+    public:
+        using json = nlohmann::json;
+
+        DeferringSax(json &root, uint64_t const *position)
+            : m_root(root), m_position(position)
+        {}
+
+        bool null()
+        {
+            if (deferring())
+            {
+                m_deferred.hasNull = true;
+            }
+            return value(nullptr);
+        }
+
+        bool boolean(bool val)
+        {
+            return value(val);
+        }
+
+        bool number_integer(json::number_integer_t val)
+        {
+            return value(val);
+        }
+
+        bool number_unsigned(json::number_unsigned_t val)
+        {
+            return value(val);
+        }
+
+        bool number_float(json::number_float_t val, json::string_t const &)
+        {
+            return value(val);
+        }
+
+        bool string(json::string_t &val)
+        {
+            return value(std::move(val));
+        }
+
+        bool binary(json::binary_t &val)
+        {
+            return value(json::binary(std::move(val)));
+        }
+
+        bool start_object(std::size_t)
+        {
+            if (deferring())
+            {
+                startDeferredElement(/* isArray = */ false);
+                return true;
+            }
+            m_stack.push_back(insert(json::object()));
+            return true;
+        }
+
+        bool key(json::string_t &val)
+        {
+            if (deferring())
+            {
+                return true;
+            }
+            m_objectElement = &(*m_stack.back())[val];
+            m_keyIsData = val == "data";
+            return true;
+        }
+
+        bool end_object()
+        {
+            if (deferring())
+            {
+                endDeferredElement();
+                return true;
+            }
+            m_stack.pop_back();
+            return true;
+        }
+
+        bool start_array(std::size_t)
+        {
+            if (deferring())
+            {
+                startDeferredElement(/* isArray = */ true);
+                return true;
+            }
+            if (m_keyIsData && !m_stack.empty() && m_stack.back()->is_object())
+            {
+                m_keyIsData = false;
+                m_deferred = DeferredArray();
+                // right behind the opening bracket
+                m_deferred.blocks.push_back({0, *m_position});
+                m_frames.push_back({0, true, true});
+                return true;
+            }
+            m_stack.push_back(insert(json::array()));
+            return true;
+        }
+
+        bool end_array()
+        {
+            if (deferring())
+            {
+                endDeferredElement();
+                return true;
+            }
+            m_stack.pop_back();
+            return true;
+        }
+
+        bool parse_error(
+            std::size_t, std::string const &, nlohmann::detail::exception const &ex)
+        {
+            switch ((ex.id / 100) % 100)
+            {
+            case 1:
+                throw *static_cast<json::parse_error const *>(&ex);
+            case 4:
+                throw *static_cast<json::out_of_range const *>(&ex);
+            default:
+                throw std::runtime_error(ex.what());
+            }
+        }
+
+    private:
+        struct Frame
+        {
+            uint64_t count = 0;
+            bool isArray = true;
+            // reached by descending along the first elements only
+            bool onFirstPath = false;
+        };
+
+        json &m_root;
+        uint64_t const *m_position;
+        std::vector<json *> m_stack;
+        json *m_objectElement = nullptr;
+        bool m_keyIsData = false;
+
+        // the deferred array currently being scanned, if m_frames is not empty
+        DeferredArray m_deferred;
+        std::vector<Frame> m_frames;
+
+        bool deferring() const
+        {
+            return !m_frames.empty();
+        }
+
+        template <typename T>
+        bool value(T &&val)
+        {
+            if (deferring())
+            {
+                startDeferredElement(/* isArray = */ false);
+                endDeferredElement();
+                return true;
+            }
+            insert(json(std::forward<T>(val)));
+            return true;
+        }
+
+        json *insert(json val)
+        {
+            m_keyIsData = false;
+            if (m_stack.empty())
+            {
+                m_root = std::move(val);
+                return &m_root;
+            }
+            if (m_stack.back()->is_array())
+            {
+                m_stack.back()->push_back(std::move(val));
+                return &m_stack.back()->back();
+            }
+            *m_objectElement = std::move(val);
+            return m_objectElement;
+        }
+
+        void startDeferredElement(bool isArray)
+        {
+            auto &parent = m_frames.back();
+            bool onFirstPath =
+                parent.isArray && parent.onFirstPath && parent.count == 0;
+            ++parent.count;
+            m_frames.push_back({0, isArray, onFirstPath});
+        }
+
+        void endDeferredElement()
+        {
+            auto frame = m_frames.back();
+            m_frames.pop_back();
+            auto depth = m_frames.size();
+            if (frame.isArray && frame.onFirstPath)
+            {
+                if (m_deferred.shape.size() <= depth)
+                {
+                    m_deferred.shape.resize(depth + 1);
+                }
+                m_deferred.shape[depth] = frame.count;
+            }
+            if (depth == 0)
+            {
+                finishDeferred(frame.count);
+            }
+            else if (depth == 1)
+            {
+                // an element of the outermost array is complete
+                auto position = *m_position;
+                if (position - m_deferred.blocks.back().begin >= blockSize)
+                {
+                    m_deferred.blocks.push_back(
+                        {m_frames.back().count, position});
+                }
+            }
+        }
+
+        void finishDeferred(uint64_t length)
+        {
+            // right behind the closing bracket
+            m_deferred.end = *m_position - 1;
+            m_deferred.length = length;
+            // a block may have been opened after the last element
+            while (m_deferred.blocks.size() > 1 &&
+                   m_deferred.blocks.back().firstElement >= length)
+            {
+                m_deferred.blocks.pop_back();
+            }
+            insert(m_deferred.toJson());
+        }
+    };
+
+    template <typename T>
+    void putValue(std::vector<std::uint8_t> &out, T value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto begin = reinterpret_cast<std::uint8_t const *>(&value);
+        out.insert(out.end(), begin, begin + sizeof(T));
+    }
+
+    class ValueReader
+    {
+    public:
+        explicit ValueReader(std::vector<std::uint8_t> const &in) : m_in(in)
+        {}
+
+        uint64_t get()
+        {
+            uint64_t res;
+            if (m_pos + sizeof(res) > m_in.size())
+            {
+                corrupt("Invalid reference to deferred dataset contents.");
+            }
+            std::memcpy(&res, m_in.data() + m_pos, sizeof(res));
+            m_pos += sizeof(res);
+            return res;
+        }
+
+    private:
+        std::vector<std::uint8_t> const &m_in;
+        size_t m_pos = 0;
+    };
+
+    /*
+     * The text of a block is a comma-separated list of elements, possibly
+     * with a leading or trailing comma.
+     */
+    nlohmann::json parseBlock(char const *begin, char const *end)
+    {
+        auto isSpace = [](char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        };
+        while (begin != end && isSpace(*begin))
+        {
+            ++begin;
+        }
+        if (begin != end && *begin == ',')
+        {
+            ++begin;
+        }
+        while (begin != end && isSpace(*(end - 1)))
+        {
+            --end;
+        }
+        if (begin != end && *(end - 1) == ',')
+        {
+            --end;
+        }
+        std::string text;
+        text.reserve(end - begin + 2);
+        text += '[';
+        text.append(begin, end);
+        text += ']';
+        return nlohmann::json::parse(text);
+    }
+} // namespace
+
+bool DeferredArray::isDeferred(nlohmann::json const &j)
+{
+    if (!j.is_binary())
+    {
+        return false;
+    }
+    auto const &binary = j.get_binary();
+    return binary.has_subtype() && binary.subtype() == deferredArraySubtype;
+}
+
+nlohmann::json DeferredArray::toJson() const
+{
+    std::vector<std::uint8_t> out;
+    putValue<uint64_t>(out, end);
+    putValue<uint64_t>(out, length);
+    putValue<uint64_t>(out, shape.size());
+    for (auto extent : shape)
+    {
+        putValue<uint64_t>(out, extent);
+    }
+    putValue<uint64_t>(out, blocks.size());
+    for (auto const &block : blocks)
+    {
+        putValue<uint64_t>(out, block.firstElement);
+        putValue<uint64_t>(out, block.begin);
+    }
+    putValue<uint64_t>(out, hasNull ? 1 : 0);
+    return nlohmann::json::binary(std::move(out), deferredArraySubtype);
+}
+
+DeferredArray DeferredArray::fromJson(nlohmann::json const &j)
+{
+    if (!isDeferred(j))
+    {
+        corrupt("Invalid reference to deferred dataset contents.");
+    }
+    ValueReader in(j.get_binary());
+    DeferredArray res;
+    res.end = in.get();
+    res.length = in.get();
+    res.shape.resize(in.get());
+    for (auto &extent : res.shape)
+    {
+        extent = in.get();
+    }
+    res.blocks.resize(in.get());
+    for (auto &block : res.blocks)
+    {
+        block.firstElement = in.get();
+        block.begin = in.get();
+    }
+    res.hasNull = in.get() != 0;
+    if (res.blocks.empty())
+    {
+        corrupt("Invalid reference to deferred dataset contents.");
+    }
+    return res;
+}
+
+nlohmann::json DeferredArray::load(
+    std::string const &path, uint64_t first, uint64_t count) const
+{
+    auto res = nlohmann::json::array();
+    if (count == 0)
+    {
+        return res;
+    }
+    auto last = first + count;
+    if (last > length)
+    {
+        corrupt("Selection exceeds the dataset in file '" + path + "'.");
+    }
+    auto byFirstElement = [](Block const &block, uint64_t element) {
+        return block.firstElement < element;
+    };
+    // blocks [firstBlock, lastBlock) contain the selection
+    size_t firstBlock =
+        std::upper_bound(
+            blocks.begin(),
+            blocks.end(),
+            first,
+            [](uint64_t element, Block const &block) {
+                return element < block.firstElement;
+            }) -
+        blocks.begin() - 1;
+    size_t lastBlock =
+        std::lower_bound(blocks.begin(), blocks.end(), last, byFirstElement) -
+        blocks.begin();
+    auto blockEnd = [this](size_t block) {
+        return block + 1 < blocks.size() ? blocks[block + 1].begin : end;
+    };
+
+    auto begin = blocks[firstBlock].begin;
+    std::string text(blockEnd(lastBlock - 1) - begin, '\0');
+    {
+        std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+        file.seekg(std::streamoff(begin));
+        file.read(text.data(), std::streamsize(text.size()));
+        if (!file.good())
+        {
+            throw error::ReadError(
+                error::AffectedObject::File,
+                error::Reason::Inaccessible,
+                "JSON",
+                "Failed reading dataset contents from file '" + path + "'.");
+        }
+    }
+
+    auto numBlocks = lastBlock - firstBlock;
+    std::vector<nlohmann::json> parsed(numBlocks);
+    auto parseBlocks = [&](size_t from, size_t to) {
+        for (size_t i = from; i < to; ++i)
+        {
+            auto block = firstBlock + i;
+            parsed[i] = parseBlock(
+                text.data() + (blocks[block].begin - begin),
+                text.data() + (blockEnd(block) - begin));
+        }
+    };
+    size_t numThreads = std::min<size_t>(
+        numBlocks, std::max(1u, std::thread::hardware_concurrency()));
+    if (numThreads > 1 && text.size() >= parallelThreshold)
+    {
+        std::vector<std::future<void>> tasks;
+        for (size_t thread = 0; thread < numThreads; ++thread)
+        {
+            tasks.push_back(std::async(
+                std::launch::async,
+                parseBlocks,
+                thread * numBlocks / numThreads,
+                (thread + 1) * numBlocks / numThreads));
+        }
+        for (auto &task : tasks)
+        {
+            task.get();
+        }
+    }
+    else
+    {
+        parseBlocks(0, numBlocks);
+    }
+
+    for (size_t i = 0; i < numBlocks; ++i)
+    {
+        auto element = blocks[firstBlock + i].firstElement;
+        for (auto &value : parsed[i])
+        {
+            if (element >= first && element < last)
+            {
+                res.push_back(std::move(value));
+            }
+            ++element;
+        }
+    }
+    if (res.size() != count)
+    {
+        corrupt(
+            "Dataset contents in file '" + path +
+            "' changed after opening the file.");
+    }
+    return res;
+}
+
+std::shared_ptr<nlohmann::json> parseDeferringData(std::istream &stream)
+{
+    auto res = std::make_shared<nlohmann::json>();
+    uint64_t position = 0;
+    DeferringSax sax(*res, &position);
+    nlohmann::json::sax_parse(
+        CountingIterator(stream, &position), CountingIterator(), &sax);
+    return res;
+}
+} // namespace openPMD::json
@@ -20,6 +20,7 @@
  */
 
 #include "openPMD/IO/JSON/JSONIOHandler.hpp"
+#include "openPMD/IO/FlushParametersInternal.hpp"
 
 namespace openPMD
 {
@@ -49,8 +50,13 @@ JSONIOHandler::JSONIOHandler(
 {}
 #endif
 
-std::future<void> JSONIOHandler::flush(internal::ParsedFlushParams &)
+std::future<void> JSONIOHandler::flush(internal::ParsedFlushParams &params)
 {
+    if (params.flushLevel == FlushLevel::UserFlush)
+    {
+        // flush point: the user is done filling buffers from storeChunk()
+        m_impl.writePooledBufferViews();
+    }
     return m_impl.flush();
 }
 } // namespace openPMD
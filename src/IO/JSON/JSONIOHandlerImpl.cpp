@@ -25,6 +25,7 @@
 #include "openPMD/Error.hpp"
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/AbstractIOHandlerImpl.hpp"
+#include "openPMD/auxiliary/Codec.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/JSON_internal.hpp"
 #include "openPMD/auxiliary/Memory.hpp"
@@ -37,8 +38,11 @@
 #include <toml.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <exception>
 #include <iostream>
+#include <numeric>
 #include <optional>
 
 namespace openPMD
@@ -65,6 +69,15 @@ namespace openPMD
 
 namespace
 {
+    /*
+     * Turn a slash-separated path of group names into the string form of a
+     * JSON pointer, '~' is the escape character within its tokens.
+     */
+    std::string toPointerString(std::string const &path)
+    {
+        return auxiliary::replace_all_nonrecursively(path, "~", "~0");
+    }
+
     struct DefaultValue
     {
         template <typename T>
@@ -125,6 +138,417 @@ namespace
         }
         return *accum_ptr;
     }
+
+    /*
+     * Datasets with the option "codec" are encoded when writing the file:
+     * "data" then holds the encoded contents as a base64 string and "extent"
+     * the shape of the array. In memory, they hold a regular nested array.
+     */
+    struct CodecSupport
+    {
+        template <typename T>
+        static constexpr bool call()
+        {
+            if constexpr (auxiliary::IsComplex_v<T>)
+            {
+                return !std::is_same_v<typename T::value_type, long double>;
+            }
+            else
+            {
+                return std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                    !std::is_same_v<T, long double>;
+            }
+        }
+
+        static constexpr char const *errorMsg = "JSON codec";
+    };
+
+    // complex numbers are stored as pairs of their components
+    template <typename T>
+    struct CodecElement
+    {
+        using type = T;
+    };
+    template <typename T>
+    struct CodecElement<std::complex<T>>
+    {
+        using type = T;
+    };
+
+    constexpr char const *base64Chars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string base64Encode(std::vector<char> const &in)
+    {
+        std::string res;
+        res.reserve((in.size() + 2) / 3 * 4);
+        for (size_t i = 0; i < in.size(); i += 3)
+        {
+            uint32_t chunk = uint32_t((unsigned char)in[i]) << 16;
+            if (i + 1 < in.size())
+            {
+                chunk |= uint32_t((unsigned char)in[i + 1]) << 8;
+            }
+            if (i + 2 < in.size())
+            {
+                chunk |= uint32_t((unsigned char)in[i + 2]);
+            }
+            res += base64Chars[(chunk >> 18) & 63];
+            res += base64Chars[(chunk >> 12) & 63];
+            res += i + 1 < in.size() ? base64Chars[(chunk >> 6) & 63] : '=';
+            res += i + 2 < in.size() ? base64Chars[chunk & 63] : '=';
+        }
+        return res;
+    }
+
+    std::vector<char> base64Decode(std::string const &in)
+    {
+        std::array<int, 256> values;
+        values.fill(-1);
+        for (int i = 0; i < 64; ++i)
+        {
+            values[(unsigned char)base64Chars[i]] = i;
+        }
+        std::vector<char> res;
+        res.reserve(in.size() / 4 * 3);
+        uint32_t chunk = 0;
+        unsigned bits = 0;
+        for (char c : in)
+        {
+            if (c == '=')
+            {
+                break;
+            }
+            int value = values[(unsigned char)c];
+            if (value < 0)
+            {
+                throw error::ReadError(
+                    error::AffectedObject::Dataset,
+                    error::Reason::UnexpectedContent,
+                    "JSON",
+                    "Invalid base64 encoding of dataset contents.");
+            }
+            chunk = chunk << 6 | uint32_t(value);
+            bits += 6;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                res.push_back(char((chunk >> bits) & 255));
+            }
+        }
+        return res;
+    }
+
+    template <typename T>
+    void flattenInto(nlohmann::json const &j, std::vector<T> &out)
+    {
+        if (j.is_array())
+        {
+            for (auto const &element : j)
+            {
+                flattenInto(element, out);
+            }
+        }
+        else if (j.is_null())
+        {
+            // unwritten elements, or non-finite floats in JSON
+            out.push_back(
+                std::is_floating_point_v<T>
+                    ? std::numeric_limits<T>::quiet_NaN()
+                    : T{});
+        }
+        else
+        {
+            out.push_back(j.get<T>());
+        }
+    }
+
+    template <typename T>
+    nlohmann::json
+    unflatten(T const *&data, Extent const &extent, size_t dimension)
+    {
+        if (dimension == extent.size())
+        {
+            return *data++;
+        }
+        auto res = nlohmann::json::array();
+        for (size_t i = 0; i < extent[dimension]; ++i)
+        {
+            res.push_back(unflatten(data, extent, dimension + 1));
+        }
+        return res;
+    }
+
+    struct EncodeDataset
+    {
+        template <typename T>
+        static std::string
+        call(nlohmann::json const &data, auxiliary::Codec const &codec)
+        {
+            if constexpr (CodecSupport::call<T>())
+            {
+                using E = typename CodecElement<T>::type;
+                std::vector<E> flat;
+                flattenInto(data, flat);
+                return base64Encode(
+                    codec.encode(flat.data(), flat.size(), sizeof(E)));
+            }
+            else
+            {
+                throw error::Internal(
+                    "[JSON] Datatype does not support the codec.");
+            }
+        }
+
+        static constexpr char const *errorMsg = "JSON codec";
+    };
+
+    struct DecodeDataset
+    {
+        template <typename T>
+        static nlohmann::json
+        call(std::string const &payload, Extent const &extent)
+        {
+            if constexpr (CodecSupport::call<T>())
+            {
+                using E = typename CodecElement<T>::type;
+                auto bytes = base64Decode(payload);
+                auto decoded = auxiliary::Codec::decode(
+                    bytes.data(), bytes.size());
+                size_t numElements = std::accumulate(
+                    extent.begin(),
+                    extent.end(),
+                    size_t(1),
+                    std::multiplies<size_t>());
+                if (decoded.size() != numElements * sizeof(E))
+                {
+                    throw error::ReadError(
+                        error::AffectedObject::Dataset,
+                        error::Reason::UnexpectedContent,
+                        "JSON",
+                        "Size of encoded dataset contents does not match "
+                        "its extent.");
+                }
+                std::vector<E> flat(numElements);
+                std::memcpy(flat.data(), decoded.data(), decoded.size());
+                E const *it = flat.data();
+                return unflatten(it, extent, 0);
+            }
+            else
+            {
+                throw error::ReadError(
+                    error::AffectedObject::Dataset,
+                    error::Reason::UnexpectedContent,
+                    "JSON",
+                    "Datatype does not support encoded dataset contents.");
+            }
+        }
+
+        static constexpr char const *errorMsg = "JSON codec";
+    };
+
+    bool isEncodedDataset(nlohmann::json const &j)
+    {
+        if (!j.is_object())
+        {
+            return false;
+        }
+        auto codec = j.find("codec");
+        auto datatype = j.find("datatype");
+        return codec != j.end() && codec->is_string() &&
+            datatype != j.end() && datatype->is_string() && j.contains("data");
+    }
+
+    // defined below
+    ChunkTable chunksInJSON(nlohmann::json const &);
+    void mergeChunks(ChunkTable &);
+
+    bool containsNull(nlohmann::json const &j)
+    {
+        if (j.is_array())
+        {
+            return std::any_of(j.begin(), j.end(), [](auto const &element) {
+                return containsNull(element);
+            });
+        }
+        return j.is_null();
+    }
+
+    // nested arrays of the same shape as j, with only unwritten elements
+    nlohmann::json unwrittenLike(nlohmann::json const &j)
+    {
+        if (!j.is_array())
+        {
+            return nlohmann::json();
+        }
+        auto res = nlohmann::json::array();
+        for (auto const &element : j)
+        {
+            res.push_back(unwrittenLike(element));
+        }
+        return res;
+    }
+
+    void copyChunk(
+        nlohmann::json &from,
+        nlohmann::json &to,
+        Offset const &offset,
+        Extent const &extent,
+        size_t dimension)
+    {
+        if (dimension == offset.size())
+        {
+            to = std::move(from);
+            return;
+        }
+        for (size_t i = offset[dimension];
+             i < offset[dimension] + extent[dimension];
+             ++i)
+        {
+            copyChunk(from[i], to[i], offset, extent, dimension + 1);
+        }
+    }
+
+    /*
+     * The original contents of datasets while their encoded form is swapped
+     * in for writing the file, see encodeDatasets().
+     */
+    using SwappedOutData =
+        std::vector<std::pair<nlohmann::json *, nlohmann::json>>;
+
+    /*
+     * Encode datasets with a codec in place. Their nested arrays are moved
+     * into `swappedOut` instead of copying the file's contents, so the caller
+     * must call restoreDatasets() after writing, also in case of errors.
+     * Partially written datasets additionally store the list of their
+     * written chunks, unwritten elements would otherwise turn into values.
+     */
+    void encodeDatasets(nlohmann::json &j, SwappedOutData &swappedOut)
+    {
+        if (isEncodedDataset(j))
+        {
+            auto &data = j["data"];
+            Extent extent;
+            for (auto const *dim = &data; dim->is_array();)
+            {
+                extent.push_back(dim->size());
+                if (dim->empty())
+                {
+                    break;
+                }
+                dim = &(*dim)[0];
+            }
+            auto codec = auxiliary::Codec::fromString(j["codec"]);
+            if (!codec.has_value())
+            {
+                throw error::Internal("[JSON] Unknown codec.");
+            }
+            nlohmann::json encoded = switchNonVectorType<EncodeDataset>(
+                stringToDatatype(j["datatype"]), data, *codec);
+            nlohmann::json chunks;
+            if (containsNull(data))
+            {
+                auto table = chunksInJSON(data);
+                mergeChunks(table);
+                chunks = nlohmann::json::array();
+                for (auto const &chunk : table)
+                {
+                    chunks.push_back(
+                        {{"offset", chunk.offset}, {"extent", chunk.extent}});
+                }
+            }
+            swappedOut.emplace_back(&j, std::move(data));
+            data = std::move(encoded);
+            j["extent"] = extent;
+            if (!chunks.is_null())
+            {
+                j["chunks"] = std::move(chunks);
+            }
+            return;
+        }
+        if (j.is_object())
+        {
+            for (auto &child : j)
+            {
+                encodeDatasets(child, swappedOut);
+            }
+        }
+    }
+
+    void restoreDatasets(SwappedOutData &swappedOut)
+    {
+        for (auto &[dataset, data] : swappedOut)
+        {
+            (*dataset)["data"] = std::move(data);
+            dataset->erase("extent");
+            dataset->erase("chunks");
+        }
+        swappedOut.clear();
+    }
+
+    void decodeDatasets(nlohmann::json &j)
+    {
+        if (isEncodedDataset(j) && j["data"].is_string())
+        {
+            if (!j.contains("extent") || !j["extent"].is_array())
+            {
+                throw error::ReadError(
+                    error::AffectedObject::Dataset,
+                    error::Reason::UnexpectedContent,
+                    "JSON",
+                    "Encoded dataset contents lack their extent.");
+            }
+            Extent extent = j["extent"].get<Extent>();
+            auto decoded = switchNonVectorType<DecodeDataset>(
+                stringToDatatype(j["datatype"]),
+                j["data"].get_ref<std::string const &>(),
+                extent);
+            if (auto chunks = j.find("chunks"); chunks != j.end())
+            {
+                auto data = unwrittenLike(decoded);
+                for (auto const &chunk : *chunks)
+                {
+                    auto offset = chunk.at("offset").get<Offset>();
+                    auto chunkExtent = chunk.at("extent").get<Extent>();
+                    if (offset.size() != extent.size() ||
+                        chunkExtent.size() != extent.size())
+                    {
+                        throw error::ReadError(
+                            error::AffectedObject::Dataset,
+                            error::Reason::UnexpectedContent,
+                            "JSON",
+                            "Written chunks of encoded dataset contents do "
+                            "not match its extent.");
+                    }
+                    for (size_t i = 0; i < extent.size(); ++i)
+                    {
+                        if (offset[i] + chunkExtent[i] > extent[i])
+                        {
+                            throw error::ReadError(
+                                error::AffectedObject::Dataset,
+                                error::Reason::UnexpectedContent,
+                                "JSON",
+                                "Written chunks of encoded dataset contents "
+                                "do not match its extent.");
+                        }
+                    }
+                    copyChunk(decoded, data, offset, chunkExtent, 0);
+                }
+                decoded = std::move(data);
+                j.erase("chunks");
+            }
+            j["data"] = std::move(decoded);
+            j.erase("extent");
+            return;
+        }
+        if (j.is_object())
+        {
+            for (auto &child : j)
+            {
+                decodeDatasets(child);
+            }
+        }
+    }
 } // namespace
 
 JSONIOHandlerImpl::JSONIOHandlerImpl(
@@ -163,6 +587,7 @@ std::future<void> JSONIOHandlerImpl::flush()
         putJsonContents(file, false);
     }
     m_dirty.clear();
+    m_closingFiles.reapFinished();
     return std::future<void>();
 }
 
@@ -228,6 +653,7 @@ void JSONIOHandlerImpl::checkFile(
     {
         name += ".json";
     }
+    m_closingFiles.await(name);
     name = fullPath(name);
     using FileExists = Parameter<Operation::CHECK_FILE>::FileExists;
     *parameters.fileExists =
@@ -257,12 +683,13 @@ void JSONIOHandlerImpl::createPath(
 
         jsonVal = &(*jsonVal)[filepos->id];
         ensurePath(jsonVal, path);
-        path = filepos->id.to_string() + "/" + path;
+        path = filepos->id.to_string() + "/" + toPointerString(path);
     }
     else
     {
 
         ensurePath(jsonVal, path);
+        path = toPointerString(path);
     }
 
     m_dirty.emplace(file);
@@ -280,12 +707,6 @@ void JSONIOHandlerImpl::createDataset(
             "[JSON] Creating a dataset in a file opened as read only is not "
             "possible.");
     }
-    if (parameter.joinedDimension.has_value())
-    {
-        error::throwOperationUnsupportedInBackend(
-            "ADIOS1", "Joined Arrays currently only supported in ADIOS2");
-    }
-
     if (!writable->written)
     {
         /* Sanitize name */
@@ -303,7 +724,27 @@ void JSONIOHandlerImpl::createDataset(
         setAndGetFilePosition(writable, name);
         auto &dset = jsonVal[name];
         dset["datatype"] = datatypeToString(parameter.dtype);
+        if (auto codec = parameter.getCodec(); codec.has_value())
+        {
+            if (switchNonVectorType<CodecSupport>(parameter.dtype))
+            {
+                dset["codec"] = codec->toString();
+            }
+            else
+            {
+                std::cerr << "[JSON] The dataset option 'codec' is not "
+                             "supported for datatype "
+                          << parameter.dtype << ", dataset '" << name
+                          << "' will not be encoded." << std::endl;
+            }
+        }
         auto extent = parameter.extent;
+        if (auto jd = parameter.joinedDimension; jd.has_value())
+        {
+            // joined arrays start out empty and grow with each write
+            extent[*jd] = 0;
+            m_joinedDimensions[writable] = *jd;
+        }
         switch (parameter.dtype)
         {
         case Datatype::CFLOAT:
@@ -346,6 +787,30 @@ namespace
             }
         }
     }
+
+    /*
+     * Grow the nested array along the given dimension by `count` copies of
+     * `element`, in place.
+     */
+    void appendAlongDimension(
+        nlohmann::json &array,
+        size_t dimension,
+        size_t count,
+        nlohmann::json const &element)
+    {
+        if (dimension == 0)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                array.push_back(element);
+            }
+            return;
+        }
+        for (auto &subArray : array)
+        {
+            appendAlongDimension(subArray, dimension - 1, count, element);
+        }
+    }
 } // namespace
 
 void JSONIOHandlerImpl::extendDataset(
@@ -599,6 +1064,45 @@ namespace
             stillChanging = innerLoops();
         } while (stillChanging);
     }
+
+    /*
+     * Walk the values of a chunk in the JSON dataset and collect their
+     * statistics. Only to be used for real-valued numeric datasets.
+     */
+    void collectChunkStatistics(
+        nlohmann::json const &j,
+        WrittenChunkInfo const &chunk,
+        size_t currentdim,
+        ChunkStatistics &stats)
+    {
+        auto begin = chunk.offset[currentdim];
+        auto end = begin + chunk.extent[currentdim];
+        if (currentdim + 1 == chunk.offset.size())
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                double value = j[i].get<double>();
+                if (stats.count == 0)
+                {
+                    stats.min = value;
+                    stats.max = value;
+                }
+                else
+                {
+                    stats.min = std::min(stats.min, value);
+                    stats.max = std::max(stats.max, value);
+                }
+                ++stats.count;
+            }
+        }
+        else
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                collectChunkStatistics(j[i], chunk, currentdim + 1, stats);
+            }
+        }
+    }
 } // namespace
 
 void JSONIOHandlerImpl::availableChunks(
@@ -606,9 +1110,70 @@ void JSONIOHandlerImpl::availableChunks(
 {
     refreshFileFromParent(writable);
     auto filePosition = setAndGetFilePosition(writable);
-    auto &j = obtainJsonContents(writable)["data"];
+    auto &dataset = obtainJsonContents(writable);
+    nlohmann::json loaded;
+    nlohmann::json *data = &dataset["data"];
+    if (openPMD::json::DeferredArray::isDeferred(*data))
+    {
+        auto deferred = openPMD::json::DeferredArray::fromJson(*data);
+        if (!deferred.hasNull)
+        {
+            /*
+             * No unwritten elements, so all of it is one chunk.
+             * Statistics would need the whole dataset, so skip them.
+             */
+            parameters.chunks->clear();
+            if (deferred.length > 0)
+            {
+                auto extent = getExtent(dataset);
+                parameters.chunks->emplace_back(
+                    Offset(extent.size(), 0), std::move(extent));
+            }
+            return;
+        }
+        /*
+         * The positions of unwritten elements need the whole dataset,
+         * statistics come at little extra cost then.
+         */
+        loaded = loadDeferredRows(
+            refreshFileFromParent(writable), *data, 0, deferred.length);
+        data = &loaded;
+    }
+    auto &j = *data;
     *parameters.chunks = chunksInJSON(j);
     mergeChunks(*parameters.chunks);
+
+    auto datatype = stringToDatatype(dataset["datatype"].get<std::string>());
+    switch (datatype)
+    {
+    case Datatype::CFLOAT:
+    case Datatype::CDOUBLE:
+    case Datatype::CLONG_DOUBLE:
+        // the last "dimension" is only the two entries for the complex
+        // number, so remove that again
+        for (auto &chunk : *parameters.chunks)
+        {
+            chunk.offset.pop_back();
+            chunk.extent.pop_back();
+        }
+        break;
+    default:
+        break;
+    }
+    if (parameters.withStatistics &&
+        (std::get<0>(isInteger(datatype)) || isFloatingPoint(datatype)))
+    {
+        for (auto &chunk : *parameters.chunks)
+        {
+            if (chunk.offset.empty())
+            {
+                continue;
+            }
+            ChunkStatistics stats;
+            collectChunkStatistics(j, chunk, 0, stats);
+            chunk.statistics = stats;
+        }
+    }
 }
 
 void JSONIOHandlerImpl::openFile(
@@ -629,6 +1194,19 @@ void JSONIOHandlerImpl::openFile(
 
     associateWithFile(writable, file);
 
+#if openPMD_HAVE_MPI
+    /*
+     * Reading the file is collective. With collective metadata parsing,
+     * only rank 0 accesses the file's contents for reading attributes, so
+     * read it while all ranks take part.
+     */
+    if (m_communicator.has_value() &&
+        m_handler->m_metadataCommunicator.has_value())
+    {
+        obtainJsonContents(file);
+    }
+#endif
+
     writable->written = true;
     writable->abstractFilePosition = std::make_shared<JSONFilePosition>();
 }
@@ -639,7 +1217,44 @@ void JSONIOHandlerImpl::closeFile(
     auto fileIterator = m_files.find(writable);
     if (fileIterator != m_files.end())
     {
-        auto it = putJsonContents(fileIterator->second);
+        auto const &file = fileIterator->second;
+        auto it = m_jsonVals.find(file);
+        bool inBackground = m_handler->m_filesInFlight > 0 &&
+            it != m_jsonVals.end() &&
+            !access::readOnly(m_handler->m_backendAccess);
+#if openPMD_HAVE_MPI
+        inBackground = inBackground && !m_communicator.has_value();
+#endif
+        if (inBackground)
+        {
+            (*it->second)["platform_byte_widths"] = platformSpecifics();
+            m_closingFiles.close(
+                *file,
+                [path = fullPath(file),
+                 contents = it->second,
+                 fileFormat = m_fileFormat]() {
+                    std::ios_base::openmode openmode =
+                        std::ios_base::out | std::ios_base::trunc;
+                    if (fileFormat == FileFormat::Toml)
+                    {
+                        openmode |= std::ios_base::binary;
+                    }
+                    std::ofstream fs(path, openmode);
+                    fs << std::setprecision(
+                        std::numeric_limits<double>::digits10 + 1);
+                    writeFileContents(fs, *contents, fileFormat);
+                    if (!fs.good())
+                    {
+                        throw std::runtime_error(
+                            "[JSON] Failed writing data to disk.");
+                    }
+                },
+                m_handler->m_filesInFlight);
+        }
+        else
+        {
+            it = putJsonContents(file);
+        }
         if (it != m_jsonVals.end())
         {
             m_jsonVals.erase(it);
@@ -658,8 +1273,9 @@ void JSONIOHandlerImpl::openPath(
 
     nlohmann::json *j = &obtainJsonContents(writable->parent);
     auto path = removeSlashes(parameters.path);
-    path = path.empty() ? filepositionOf(writable->parent)
-                        : filepositionOf(writable->parent) + "/" + path;
+    path = path.empty()
+        ? filepositionOf(writable->parent)
+        : filepositionOf(writable->parent) + "/" + toPointerString(path);
 
     if (writable->abstractFilePosition)
     {
@@ -682,7 +1298,14 @@ void JSONIOHandlerImpl::openDataset(
 {
     refreshFileFromParent(writable);
     auto name = removeSlashes(parameters.name);
-    auto &datasetJson = obtainJsonContents(writable->parent)[name];
+    // the name may be a path relative to the parent,
+    // index it key by key since record names are no JSON pointer tokens
+    nlohmann::json *datasetJsonp = &obtainJsonContents(writable->parent);
+    for (auto const &segment : auxiliary::split(name, "/"))
+    {
+        datasetJsonp = &(*datasetJsonp)[segment];
+    }
+    auto &datasetJson = *datasetJsonp;
     /*
      * If the dataset has been opened previously, the path needs not be
      * set again.
@@ -724,6 +1347,7 @@ void JSONIOHandlerImpl::deleteFile(
         file.invalidate();
     }
 
+    m_closingFiles.await(filename);
     std::remove(fullPath(filename).c_str());
 
     writable->written = false;
@@ -758,9 +1382,7 @@ void JSONIOHandlerImpl::deletePath(
             throw std::runtime_error("[JSON] Cannot delete the root group");
         }
 
-        auto i = s.rfind('/');
-        path = s;
-        path.replace(0, i + 1, "");
+        path = filepos->id.back();
         // path should now be equal to the name of the current group
         // go up one group
 
@@ -832,9 +1454,7 @@ void JSONIOHandlerImpl::deleteDataset(
             throw std::runtime_error(
                 "[JSON] Invalid position for a dataset in the JSON file.");
         }
-        dataset = s;
-        auto i = dataset.rfind('/');
-        dataset.replace(0, i + 1, "");
+        dataset = filepos->id.back();
 
         parentDir(s);
         parent = &(*obtainJsonContents(file))[nlohmann::json::json_pointer(s)];
@@ -877,6 +1497,64 @@ void JSONIOHandlerImpl::writeDataset(
     auto file = refreshFileFromParent(writable);
     auto &j = obtainJsonContents(writable);
 
+    if (parameters.offset.empty() && !parameters.extent.empty())
+    {
+        /*
+         * Joined array: Append the chunk at the end of the joined dimension.
+         * Each rank writes to its own file, so there is no need to
+         * coordinate offsets with other writers.
+         */
+        auto joined = m_joinedDimensions.find(writable);
+        if (joined == m_joinedDimensions.end())
+        {
+            throw error::WrongAPIUsage(
+                "[JSON] Writing to a joined array is only possible for "
+                "datasets that were created as joined array in the same "
+                "Series.");
+        }
+        size_t const jd = joined->second;
+        if (std::find(
+                parameters.extent.begin(), parameters.extent.end(), 0) !=
+            parameters.extent.end())
+        {
+            // nothing to append
+            return;
+        }
+        VERIFY_ALWAYS(
+            isDataset(j) && jd < parameters.extent.size(),
+            "[JSON] Specified dataset does not exist or is not a dataset.");
+        // do not use getExtent(), it cannot look into empty arrays
+        nlohmann::json const *level = &j["data"];
+        for (size_t i = 0; i < jd && !level->empty(); ++i)
+        {
+            level = &level->at(0);
+        }
+        parameters.offset = Offset(parameters.extent.size(), 0);
+        parameters.offset[jd] = level->size();
+        // append in place, the data written so far stays untouched
+        Extent elementExtent(
+            parameters.extent.begin() + jd + 1, parameters.extent.end());
+        switch (parameters.dtype)
+        {
+        case Datatype::CFLOAT:
+        case Datatype::CDOUBLE:
+        case Datatype::CLONG_DOUBLE: {
+            elementExtent.push_back(2);
+            break;
+        }
+        default:
+            break;
+        }
+        appendAlongDimension(
+            j["data"],
+            jd,
+            parameters.extent[jd],
+            initializeNDArray(
+                elementExtent,
+                m_fileFormat == FileFormat::Json ? std::optional<Datatype>()
+                                                 : parameters.dtype));
+    }
+
     verifyDataset(parameters, j);
 
     switchType<DatasetWriter>(parameters.dtype, j, parameters);
@@ -929,7 +1607,27 @@ void JSONIOHandlerImpl::readDataset(
 
     try
     {
-        switchType<DatasetReader>(parameters.dtype, j["data"], parameters);
+        auto &data = j["data"];
+        if (openPMD::json::DeferredArray::isDeferred(data))
+        {
+            // only parse the rows of the selection
+            if (parameters.extent.at(0) == 0)
+            {
+                return;
+            }
+            auto rows = loadDeferredRows(
+                refreshFileFromParent(writable),
+                data,
+                parameters.offset.at(0),
+                parameters.extent.at(0));
+            auto shifted = parameters;
+            shifted.offset.at(0) = 0;
+            switchType<DatasetReader>(parameters.dtype, rows, shifted);
+        }
+        else
+        {
+            switchType<DatasetReader>(parameters.dtype, data, parameters);
+        }
     }
     catch (json::basic_json::type_error &)
     {
@@ -1038,6 +1736,15 @@ void JSONIOHandlerImpl::deregister(
     Writable *writable, Parameter<Operation::DEREGISTER> const &)
 {
     m_files.erase(writable);
+    forgetPooledBufferViews(writable);
+    m_joinedDimensions.erase(writable);
+}
+
+void JSONIOHandlerImpl::getBufferView(
+    Writable *writable, Parameter<Operation::GET_BUFFER_VIEW> &parameters)
+{
+    // written via writeDataset() at the next flush point
+    getPooledBufferView(writable, parameters);
 }
 
 void JSONIOHandlerImpl::touch(
@@ -1047,12 +1754,74 @@ void JSONIOHandlerImpl::touch(
     m_dirty.emplace(std::move(file));
 }
 
+void JSONIOHandlerImpl::prefetchFile(
+    Writable *, Parameter<Operation::PREFETCH_FILE> const &parameter)
+{
+    /*
+     * Only read-only files can be safely loaded ahead of time.
+     * Parallel reads are collective, so they cannot be moved into the
+     * background of a single rank either.
+     */
+    if (!access::readOnly(m_handler->m_backendAccess))
+    {
+        return;
+    }
+#if openPMD_HAVE_MPI
+    if (m_communicator.has_value())
+    {
+        return;
+    }
+#endif
+    std::string name = parameter.name + m_originalExtension;
+    if (m_prefetchedFiles.find(name) != m_prefetchedFiles.end())
+    {
+        return;
+    }
+    auto [file, _, newlyCreated] = getPossiblyExisting(name);
+    (void)_;
+    if (!newlyCreated && m_jsonVals.find(file) != m_jsonVals.end())
+    {
+        return;
+    }
+    m_prefetchedFiles.emplace(
+        name,
+        std::async(
+            std::launch::async,
+            [path = fullPath(name),
+             fileFormat = m_fileFormat,
+             deferData = deferDatasetContents(),
+             name]() {
+                std::ios_base::openmode openmode = std::ios_base::in;
+                if (fileFormat == FileFormat::Toml || deferData)
+                {
+                    openmode |= std::ios_base::binary;
+                }
+                std::ifstream fs(path, openmode);
+                if (!fs.good())
+                {
+                    throw std::runtime_error(
+                        "[JSON] Failed prefetching file '" + path + "'");
+                }
+                fs >> std::setprecision(
+                          std::numeric_limits<double>::digits10 + 1);
+                auto res =
+                    parseFileContents(fs, fileFormat, name, deferData);
+                if (!fs.good())
+                {
+                    throw std::runtime_error(
+                        "[JSON] Failed prefetching file '" + path + "'");
+                }
+                return res;
+            }));
+}
+
 auto JSONIOHandlerImpl::getFilehandle(File const &fileName, Access access)
     -> std::tuple<std::unique_ptr<FILEHANDLE>, std::istream *, std::ostream *>
 {
     VERIFY_ALWAYS(
         fileName.valid(),
         "[JSON] Tried opening a file that has been overwritten or deleted.")
+    m_closingFiles.await(*fileName);
     auto path = fullPath(fileName);
     auto fs = std::make_unique<FILEHANDLE>();
     std::istream *istream = nullptr;
@@ -1080,7 +1849,8 @@ auto JSONIOHandlerImpl::getFilehandle(File const &fileName, Access access)
     else
     {
         std::ios_base::openmode openmode = std::ios_base::in;
-        if (m_fileFormat == FileFormat::Toml)
+        // byte positions of deferred datasets refer to the raw file
+        if (m_fileFormat == FileFormat::Toml || deferDatasetContents())
         {
             openmode |= std::ios_base::binary;
         }
@@ -1186,6 +1956,10 @@ Extent JSONIOHandlerImpl::getExtent(nlohmann::json &j)
 {
     Extent res;
     nlohmann::json *ptr = &j["data"];
+    if (openPMD::json::DeferredArray::isDeferred(*ptr))
+    {
+        res = openPMD::json::DeferredArray::fromJson(*ptr).shape;
+    }
     while (ptr->is_array())
     {
         res.push_back(ptr->size());
@@ -1270,6 +2044,65 @@ JSONIOHandlerImpl::getPossiblyExisting(std::string const &file)
             std::move(name), it, newlyCreated);
 }
 
+std::shared_ptr<nlohmann::json> JSONIOHandlerImpl::parseFileContents(
+    std::istream &stream,
+    FileFormat fileFormat,
+    std::string const &filename,
+    bool deferData)
+{
+    std::shared_ptr<nlohmann::json> res;
+    switch (fileFormat)
+    {
+    case FileFormat::Json:
+        if (deferData)
+        {
+            res = openPMD::json::parseDeferringData(stream);
+        }
+        else
+        {
+            res = std::make_shared<nlohmann::json>();
+            stream >> *res;
+        }
+        break;
+    case FileFormat::Toml:
+        res = std::make_shared<nlohmann::json>(
+            openPMD::json::tomlToJson(toml::parse(stream, filename)));
+        break;
+    }
+    decodeDatasets(*res);
+    return res;
+}
+
+void JSONIOHandlerImpl::writeFileContents(
+    std::ostream &stream, nlohmann::json &contents, FileFormat fileFormat)
+{
+    auto write = [&stream, fileFormat](nlohmann::json const &value) {
+        switch (fileFormat)
+        {
+        case FileFormat::Json:
+            stream << value << std::endl;
+            break;
+        case FileFormat::Toml:
+            stream << openPMD::json::format_toml(
+                          openPMD::json::jsonToToml(value))
+                   << std::endl;
+            break;
+        }
+    };
+    SwappedOutData swappedOut;
+    try
+    {
+        encodeDatasets(contents, swappedOut);
+        write(contents);
+    }
+    catch (...)
+    {
+        restoreDatasets(swappedOut);
+        throw;
+    }
+    restoreDatasets(swappedOut);
+}
+
 std::shared_ptr<nlohmann::json>
 JSONIOHandlerImpl::obtainJsonContents(File const &file)
 {
@@ -1281,23 +2114,32 @@ JSONIOHandlerImpl::obtainJsonContents(File const &file)
     {
         return it->second;
     }
+    if (auto prefetched = m_prefetchedFiles.find(*file);
+        prefetched != m_prefetchedFiles.end())
+    {
+        auto future = std::move(prefetched->second);
+        m_prefetchedFiles.erase(prefetched);
+        try
+        {
+            auto res = future.get();
+            m_jsonVals.emplace(file, res);
+            return res;
+        }
+        catch (...)
+        {
+            /*
+             * Prefetching is only a hint, errors are reported by reading
+             * the file regularly below.
+             */
+        }
+    }
     // read from file
     auto serialImplementation = [&file, this]() {
         auto [fh, fh_with_precision, _] =
             getFilehandle(file, Access::READ_ONLY);
         (void)_;
-        std::shared_ptr<nlohmann::json> res =
-            std::make_shared<nlohmann::json>();
-        switch (m_fileFormat)
-        {
-        case FileFormat::Json:
-            *fh_with_precision >> *res;
-            break;
-        case FileFormat::Toml:
-            *res = openPMD::json::tomlToJson(
-                toml::parse(*fh_with_precision, *file));
-            break;
-        }
+        auto res = parseFileContents(
+            *fh_with_precision, m_fileFormat, *file, deferDatasetContents());
         VERIFY(fh->good(), "[JSON] Failed reading from a file.");
         return res;
     };
@@ -1324,6 +2166,7 @@ JSONIOHandlerImpl::obtainJsonContents(File const &file)
             *res = openPMD::json::tomlToJson(as_toml);
             break;
         }
+        decodeDatasets(*res);
         return res;
     };
     std::shared_ptr<nlohmann::json> res;
@@ -1344,6 +2187,29 @@ JSONIOHandlerImpl::obtainJsonContents(File const &file)
     return res;
 }
 
+bool JSONIOHandlerImpl::deferDatasetContents() const
+{
+#if openPMD_HAVE_MPI
+    // parallel reads parse the collectively read file contents
+    if (m_communicator.has_value())
+    {
+        return false;
+    }
+#endif
+    return m_fileFormat == FileFormat::Json &&
+        access::readOnly(m_handler->m_backendAccess);
+}
+
+nlohmann::json JSONIOHandlerImpl::loadDeferredRows(
+    File const &file,
+    nlohmann::json const &data,
+    uint64_t first,
+    uint64_t count)
+{
+    return openPMD::json::DeferredArray::fromJson(data).load(
+        fullPath(file), first, count);
+}
+
 nlohmann::json &JSONIOHandlerImpl::obtainJsonContents(Writable *writable)
 {
     auto file = refreshFileFromParent(writable);
@@ -1360,7 +2226,11 @@ auto JSONIOHandlerImpl::putJsonContents(
         filename.valid(),
         "[JSON] File has been overwritten/deleted before writing");
     auto it = m_jsonVals.find(filename);
-    if (it == m_jsonVals.end())
+    /*
+     * Read-only files are never written back, their JSON value may contain
+     * deferred datasets.
+     */
+    if (it == m_jsonVals.end() || access::readOnly(m_handler->m_backendAccess))
     {
         return it;
     }
@@ -1372,17 +2242,7 @@ auto JSONIOHandlerImpl::putJsonContents(
             getFilehandle(File(writeThisFile), Access::CREATE);
         (void)_;
 
-        switch (m_fileFormat)
-        {
-        case FileFormat::Json:
-            *fh_with_precision << *it->second << std::endl;
-            break;
-        case FileFormat::Toml:
-            *fh_with_precision << openPMD::json::format_toml(
-                                      openPMD::json::jsonToToml(*it->second))
-                               << std::endl;
-            break;
-        }
+        writeFileContents(*fh_with_precision, *it->second, m_fileFormat);
 
         VERIFY(fh->good(), "[JSON] Failed writing data to disk.")
     };
@@ -1497,15 +2357,15 @@ std::shared_ptr<JSONFilePosition> JSONIOHandlerImpl::setAndGetFilePosition(
     {
         // do NOT reuse the old pointer, we want to change the file position
         // only for the writable!
-        path = filepositionOf(writable) + "/" + extend;
+        path = filepositionOf(writable) + "/" + toPointerString(extend);
     }
     else if (writable->parent)
     {
-        path = filepositionOf(writable->parent) + "/" + extend;
+        path = filepositionOf(writable->parent) + "/" + toPointerString(extend);
     }
     else
     { // we are root
-        path = extend;
+        path = toPointerString(extend);
         if (!auxiliary::starts_with(path, "/"))
         {
             path = "/" + path;
@@ -1569,7 +2429,9 @@ bool JSONIOHandlerImpl::isDataset(nlohmann::json const &j)
         return false;
     }
     auto i = j.find("data");
-    return i != j.end() && i.value().is_array();
+    return i != j.end() &&
+        (i.value().is_array() ||
+         openPMD::json::DeferredArray::isDeferred(i.value()));
 }
 
 bool JSONIOHandlerImpl::isGroup(nlohmann::json::const_iterator const &it)
@@ -1581,7 +2443,9 @@ bool JSONIOHandlerImpl::isGroup(nlohmann::json::const_iterator const &it)
         return false;
     }
     auto i = j.find("data");
-    return i == j.end() || !i.value().is_array();
+    return i == j.end() ||
+        !(i.value().is_array() ||
+          openPMD::json::DeferredArray::isDeferred(i.value()));
 }
 
 template <typename Param>
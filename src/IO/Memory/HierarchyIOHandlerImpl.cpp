@@ -0,0 +1,582 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/IO/Memory/HierarchyIOHandlerImpl.hpp"
+#include "openPMD/Error.hpp"
+#include "openPMD/IO/AbstractIOHandler.hpp"
+#include "openPMD/IO/Access.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/auxiliary/UniquePtr.hpp"
+#include "openPMD/backend/Writable.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <variant>
+
+namespace openPMD
+{
+namespace
+{
+    void verifyWriteAccess(AbstractIOHandler const *handler, char const *what)
+    {
+        if (!access::write(handler->m_backendAccess))
+        {
+            throw std::runtime_error(
+                "[" + handler->backendName() + "] Cannot " + what +
+                " in read-only mode.");
+        }
+    }
+
+    size_t numberOfBytes(Datatype dtype, Extent const &extent)
+    {
+        size_t res = toBytes(dtype);
+        for (auto e : extent)
+        {
+            res *= e;
+        }
+        return res;
+    }
+
+    /*
+     * Paths for deletion are relative, "." denotes the object itself.
+     */
+    std::string
+    pathForDeletion(std::string const &location, std::string const &path)
+    {
+        auto relative = auxiliary::removeSlashes(path);
+        if (relative == ".")
+        {
+            return location;
+        }
+        if (auxiliary::starts_with(relative, "./"))
+        {
+            relative = auxiliary::replace_first(relative, "./", "");
+        }
+        return memory::joinPath(location, relative);
+    }
+} // namespace
+
+HierarchyIOHandlerImpl::HierarchyIOHandlerImpl(AbstractIOHandler *handler)
+    : AbstractIOHandlerImplCommon(handler)
+{}
+
+HierarchyIOHandlerImpl::~HierarchyIOHandlerImpl() = default;
+
+void HierarchyIOHandlerImpl::createPath(
+    Writable *writable, Parameter<Operation::CREATE_PATH> const &parameters)
+{
+    verifyWriteAccess(m_handler, "create a path");
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ true);
+    auto const &root = rootOf(file);
+    auto location = memory::joinPath(
+        filePositionToString(setAndGetFilePosition(writable)),
+        parameters.path);
+
+    auto position = std::make_shared<memory::FilePosition>(location);
+    position->node = memory::ensureNode(root, location);
+    position->root = root;
+    writable->abstractFilePosition = std::move(position);
+    writable->written = true;
+    recordChange(file, {memory::Change::Type::Path, std::move(location), {}});
+}
+
+void HierarchyIOHandlerImpl::createDataset(
+    Writable *writable, Parameter<Operation::CREATE_DATASET> const &parameters)
+{
+    verifyWriteAccess(m_handler, "create a dataset");
+    if (parameters.joinedDimension.has_value())
+    {
+        error::throwOperationUnsupportedInBackend(
+            m_handler->backendName(), "Joined Arrays are not supported.");
+    }
+    if (writable->written)
+    {
+        return;
+    }
+    auto name = auxiliary::removeSlashes(parameters.name);
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ true);
+    auto const &root = rootOf(file);
+    writable->abstractFilePosition.reset();
+    auto position = setAndGetFilePosition(writable, name);
+
+    auto node = memory::ensureNode(root, position->location);
+    node->dataset = memory::Dataset{parameters.dtype, parameters.extent, {}};
+    position->node = node;
+    position->root = root;
+    writable->written = true;
+    recordChange(file, {memory::Change::Type::Dataset, position->location, {}});
+}
+
+void HierarchyIOHandlerImpl::extendDataset(
+    Writable *writable, Parameter<Operation::EXTEND_DATASET> const &parameters)
+{
+    verifyWriteAccess(m_handler, "extend a dataset");
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto &dataset = resolveDataset(writable);
+    if (dataset.extent.size() != parameters.extent.size())
+    {
+        throw std::runtime_error(
+            "[" + m_handler->backendName() +
+            "] Cannot change dimensionality of a dataset.");
+    }
+    for (size_t i = 0; i < dataset.extent.size(); ++i)
+    {
+        if (parameters.extent[i] < dataset.extent[i])
+        {
+            throw std::runtime_error(
+                "[" + m_handler->backendName() +
+                "] Cannot shrink the extent of a dataset.");
+        }
+    }
+    dataset.extent = parameters.extent;
+    recordChange(
+        file,
+        {memory::Change::Type::Dataset,
+         filePositionToString(setAndGetFilePosition(writable)),
+         {}});
+}
+
+void HierarchyIOHandlerImpl::availableChunks(
+    Writable *writable, Parameter<Operation::AVAILABLE_CHUNKS> &parameters)
+{
+    *parameters.chunks = resolveDataset(writable).chunkTable();
+}
+
+void HierarchyIOHandlerImpl::openPath(
+    Writable *writable, Parameter<Operation::OPEN_PATH> const &parameters)
+{
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ true);
+    auto const &root = rootOf(file);
+    auto location = memory::joinPath(
+        filePositionToString(setAndGetFilePosition(writable->parent)),
+        auxiliary::removeSlashes(parameters.path));
+
+    auto node = access::write(m_handler->m_backendAccess)
+        ? memory::ensureNode(root, location)
+        : memory::findNode(root, location);
+    if (!node || node->dataset.has_value())
+    {
+        throw error::ReadError(
+            error::AffectedObject::Group,
+            error::Reason::NotFound,
+            m_handler->backendName(),
+            location);
+    }
+    auto position = std::make_shared<memory::FilePosition>(location);
+    position->node = node;
+    position->root = root;
+    writable->abstractFilePosition = std::move(position);
+    writable->written = true;
+}
+
+void HierarchyIOHandlerImpl::openDataset(
+    Writable *writable, Parameter<Operation::OPEN_DATASET> &parameters)
+{
+    auto name = auxiliary::removeSlashes(parameters.name);
+    refreshFileFromParent(writable, /* preferParentFile = */ true);
+    writable->abstractFilePosition.reset();
+    setAndGetFilePosition(writable, name);
+    auto const &dataset = resolveDataset(writable);
+    *parameters.dtype = dataset.dtype;
+    *parameters.extent = dataset.extent;
+    writable->written = true;
+}
+
+void HierarchyIOHandlerImpl::deletePath(
+    Writable *writable, Parameter<Operation::DELETE_PATH> const &parameters)
+{
+    verifyWriteAccess(m_handler, "delete paths");
+    if (!writable->written)
+    {
+        return;
+    }
+    if (auxiliary::starts_with(parameters.path, '/'))
+    {
+        throw std::runtime_error(
+            "[" + m_handler->backendName() +
+            "] Paths passed for deletion should be relative, the given path "
+            "is absolute (starts with '/')");
+    }
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto location = pathForDeletion(
+        filePositionToString(setAndGetFilePosition(writable, false)),
+        parameters.path);
+    if (location == "/")
+    {
+        throw std::runtime_error(
+            "[" + m_handler->backendName() + "] Cannot delete the root group");
+    }
+    memory::eraseNode(rootOf(file), location);
+    recordChange(file, {memory::Change::Type::DeletePath, location, {}});
+    if (auxiliary::removeSlashes(parameters.path) == ".")
+    {
+        writable->written = false;
+        writable->abstractFilePosition.reset();
+    }
+}
+
+void HierarchyIOHandlerImpl::deleteDataset(
+    Writable *writable, Parameter<Operation::DELETE_DATASET> const &parameters)
+{
+    verifyWriteAccess(m_handler, "delete datasets");
+    if (!writable->written)
+    {
+        return;
+    }
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto location = pathForDeletion(
+        filePositionToString(setAndGetFilePosition(writable, false)),
+        parameters.name);
+    memory::eraseNode(rootOf(file), location);
+    recordChange(file, {memory::Change::Type::DeletePath, location, {}});
+    writable->written = false;
+    writable->abstractFilePosition.reset();
+}
+
+void HierarchyIOHandlerImpl::deleteAttribute(
+    Writable *writable, Parameter<Operation::DELETE_ATT> const &parameters)
+{
+    verifyWriteAccess(m_handler, "delete attributes");
+    if (!writable->written)
+    {
+        return;
+    }
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto node = resolveNode(
+        writable, /* create = */ true, error::AffectedObject::Group);
+    node->attributes.erase(parameters.name);
+    recordChange(
+        file,
+        {memory::Change::Type::DeleteAttribute,
+         filePositionToString(setAndGetFilePosition(writable)),
+         parameters.name});
+}
+
+void HierarchyIOHandlerImpl::writeDataset(
+    Writable *writable, Parameter<Operation::WRITE_DATASET> &parameters)
+{
+    verifyWriteAccess(m_handler, "write data");
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto &dataset = resolveDataset(writable);
+    dataset.verifySelection(
+        parameters.offset,
+        parameters.extent,
+        parameters.dtype,
+        m_handler->backendName());
+
+    memory::Chunk chunk{parameters.offset, parameters.extent, nullptr};
+    auto bytes = numberOfBytes(dataset.dtype, parameters.extent);
+    auto owned =
+        std::get_if<UniquePtrWithLambda<void>>(&parameters.data.m_buffer);
+    if (owned && adoptsWriteBuffers())
+    {
+        // the frontend does not access the buffer any more, no need to copy
+        chunk.data = std::shared_ptr<void const>(std::move(*owned));
+    }
+    else if (bytes > 0)
+    {
+        auto buffer = allocateChunk(file, bytes);
+        std::memcpy(buffer.get(), parameters.data.get(), bytes);
+        chunk.data = std::move(buffer);
+    }
+    dataset.storeChunk(std::move(chunk));
+    writable->written = true;
+    recordChange(
+        file,
+        {memory::Change::Type::Dataset,
+         filePositionToString(setAndGetFilePosition(writable)),
+         {}});
+}
+
+void HierarchyIOHandlerImpl::writeAttribute(
+    Writable *writable, Parameter<Operation::WRITE_ATT> const &parameters)
+{
+    if (parameters.changesOverSteps ==
+            Parameter<Operation::WRITE_ATT>::ChangesOverSteps::Yes &&
+        !supportsSteps())
+    {
+        // cannot do this
+        return;
+    }
+    verifyWriteAccess(m_handler, "write attributes");
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto node = resolveNode(
+        writable, /* create = */ true, error::AffectedObject::Attribute);
+    node->attributes.insert_or_assign(
+        parameters.name, Attribute(parameters.resource));
+    recordChange(
+        file,
+        {memory::Change::Type::Attribute,
+         filePositionToString(setAndGetFilePosition(writable)),
+         parameters.name});
+}
+
+void HierarchyIOHandlerImpl::getBufferView(
+    Writable *writable, Parameter<Operation::GET_BUFFER_VIEW> &parameters)
+{
+    if (parameters.update)
+    {
+        // chunks do not move in memory, the pointer remains valid
+        return;
+    }
+    parameters.out->backendManagedBuffer = false;
+    if (!access::write(m_handler->m_backendAccess))
+    {
+        return;
+    }
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto &dataset = resolveDataset(writable);
+    dataset.verifySelection(
+        parameters.offset,
+        parameters.extent,
+        parameters.dtype,
+        m_handler->backendName());
+    auto bytes = numberOfBytes(dataset.dtype, parameters.extent);
+    if (bytes == 0)
+    {
+        return;
+    }
+
+    /*
+     * The chunk is registered right away, the user fills it in place.
+     * Its contents are not looked at before the next IO step is completed
+     * or the file is closed.
+     */
+    auto buffer = allocateChunk(file, bytes);
+    parameters.out->ptr = buffer.get();
+    parameters.out->backendManagedBuffer = true;
+    dataset.storeChunk(
+        {parameters.offset, parameters.extent, std::move(buffer)});
+    recordChange(
+        file,
+        {memory::Change::Type::Dataset,
+         filePositionToString(setAndGetFilePosition(writable)),
+         {}});
+}
+
+void HierarchyIOHandlerImpl::readDataset(
+    Writable *writable, Parameter<Operation::READ_DATASET> &parameters)
+{
+    refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto const &dataset = resolveDataset(writable);
+    dataset.verifySelection(
+        parameters.offset,
+        parameters.extent,
+        parameters.dtype,
+        m_handler->backendName());
+    dataset.loadChunk(
+        parameters.offset, parameters.extent, parameters.data.get());
+}
+
+void HierarchyIOHandlerImpl::readDatasetView(
+    Writable *writable, Parameter<Operation::READ_DATASET_VIEW> &parameters)
+{
+    parameters.out->backendManagedBuffer = false;
+    refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto const &dataset = resolveDataset(writable);
+    if (!isSame(dataset.dtype, parameters.dtype))
+    {
+        return;
+    }
+    auto view = dataset.viewChunk(parameters.offset, parameters.extent);
+    if (!view)
+    {
+        return;
+    }
+    parameters.out->ptr = view.get();
+    parameters.out->owner = std::move(view);
+    parameters.out->backendManagedBuffer = true;
+}
+
+void HierarchyIOHandlerImpl::readAttribute(
+    Writable *writable, Parameter<Operation::READ_ATT> &parameters)
+{
+    refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto node = resolveNode(
+        writable, /* create = */ false, error::AffectedObject::Attribute);
+    auto it = node->attributes.find(parameters.name);
+    if (it == node->attributes.end())
+    {
+        throw error::ReadError(
+            error::AffectedObject::Attribute,
+            error::Reason::NotFound,
+            m_handler->backendName(),
+            memory::joinPath(
+                filePositionToString(setAndGetFilePosition(writable)),
+                parameters.name));
+    }
+    *parameters.dtype = it->second.dtype;
+    *parameters.resource = it->second.getResource();
+}
+
+void HierarchyIOHandlerImpl::listPaths(
+    Writable *writable, Parameter<Operation::LIST_PATHS> &parameters)
+{
+    refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto node = resolveNode(
+        writable, /* create = */ false, error::AffectedObject::Group);
+    parameters.paths->clear();
+    for (auto const &[name, child] : node->children)
+    {
+        if (!child->dataset.has_value())
+        {
+            parameters.paths->push_back(name);
+        }
+    }
+}
+
+void HierarchyIOHandlerImpl::listDatasets(
+    Writable *writable, Parameter<Operation::LIST_DATASETS> &parameters)
+{
+    refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto node = resolveNode(
+        writable, /* create = */ false, error::AffectedObject::Group);
+    parameters.datasets->clear();
+    for (auto const &[name, child] : node->children)
+    {
+        if (child->dataset.has_value())
+        {
+            parameters.datasets->push_back(name);
+        }
+    }
+}
+
+void HierarchyIOHandlerImpl::listAttributes(
+    Writable *writable, Parameter<Operation::LIST_ATTS> &parameters)
+{
+    refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto node = resolveNode(
+        writable, /* create = */ false, error::AffectedObject::Group);
+    parameters.attributes->clear();
+    for (auto const &pair : node->attributes)
+    {
+        parameters.attributes->push_back(pair.first);
+    }
+}
+
+void HierarchyIOHandlerImpl::deregister(
+    Writable *writable, Parameter<Operation::DEREGISTER> const &)
+{
+    m_files.erase(writable);
+}
+
+void HierarchyIOHandlerImpl::touch(
+    Writable *writable, Parameter<Operation::TOUCH> const &)
+{
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    m_dirty.emplace(std::move(file));
+}
+
+std::shared_ptr<void>
+HierarchyIOHandlerImpl::allocateChunk(InvalidatableFile const &, size_t bytes)
+{
+    return std::shared_ptr<void>(
+        new char[bytes], [](void *ptr) { delete[] static_cast<char *>(ptr); });
+}
+
+void HierarchyIOHandlerImpl::recordChange(
+    InvalidatableFile const &, memory::Change)
+{}
+
+bool HierarchyIOHandlerImpl::supportsSteps() const
+{
+    return false;
+}
+
+bool HierarchyIOHandlerImpl::adoptsWriteBuffers() const
+{
+    return false;
+}
+
+std::shared_ptr<memory::Node> HierarchyIOHandlerImpl::resolveNode(
+    Writable *writable, bool create, error::AffectedObject affectedObject)
+{
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto const &root = rootOf(file);
+    auto position = setAndGetFilePosition(writable);
+    if (position->root.lock() == root)
+    {
+        if (auto node = position->node.lock(); node)
+        {
+            return node;
+        }
+    }
+    auto node = create ? memory::ensureNode(root, position->location)
+                       : memory::findNode(root, position->location);
+    if (!node)
+    {
+        throw error::ReadError(
+            affectedObject,
+            error::Reason::NotFound,
+            m_handler->backendName(),
+            position->location);
+    }
+    position->node = node;
+    position->root = root;
+    return node;
+}
+
+memory::Dataset &HierarchyIOHandlerImpl::resolveDataset(Writable *writable)
+{
+    auto node = resolveNode(
+        writable, /* create = */ false, error::AffectedObject::Dataset);
+    if (!node->dataset.has_value())
+    {
+        throw error::ReadError(
+            error::AffectedObject::Dataset,
+            error::Reason::UnexpectedContent,
+            m_handler->backendName(),
+            "Not a dataset: " +
+                filePositionToString(setAndGetFilePosition(writable)));
+    }
+    // the node remains owned by the hierarchy
+    return *node->dataset;
+}
+
+std::string HierarchyIOHandlerImpl::filePositionToString(
+    std::shared_ptr<memory::FilePosition> position)
+{
+    return position->location;
+}
+
+std::shared_ptr<memory::FilePosition>
+HierarchyIOHandlerImpl::extendFilePosition(
+    std::shared_ptr<memory::FilePosition> const &oldPos, std::string s)
+{
+    return std::make_shared<memory::FilePosition>(memory::joinPath(
+        oldPos->location, auxiliary::removeSlashes(std::move(s))));
+}
+
+std::shared_ptr<memory::Node> &
+HierarchyIOHandlerImpl::rootOf(InvalidatableFile const &file)
+{
+    auto it = m_roots.find(file);
+    if (it == m_roots.end() || !it->second)
+    {
+        throw error::ReadError(
+            error::AffectedObject::File,
+            error::Reason::NotFound,
+            m_handler->backendName(),
+            "File is not open: " + *file);
+    }
+    return it->second;
+}
+} // namespace openPMD
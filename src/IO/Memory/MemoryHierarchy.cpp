@@ -0,0 +1,398 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/IO/Memory/MemoryHierarchy.hpp"
+#include "openPMD/auxiliary/Memory.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace openPMD::memory
+{
+namespace
+{
+    bool sameRegion(Chunk const &chunk, Offset const &o, Extent const &e)
+    {
+        return chunk.offset == o && chunk.extent == e;
+    }
+
+    /*
+     * Intersection of the chunk with the selection, in coordinates of the
+     * dataset. Returns false if empty.
+     */
+    bool intersect(
+        Chunk const &chunk,
+        Offset const &offset,
+        Extent const &extent,
+        Offset &lower,
+        Offset &upper)
+    {
+        auto dim = extent.size();
+        lower.resize(dim);
+        upper.resize(dim);
+        for (size_t i = 0; i < dim; ++i)
+        {
+            lower[i] = std::max(chunk.offset[i], offset[i]);
+            upper[i] = std::min(
+                chunk.offset[i] + chunk.extent[i], offset[i] + extent[i]);
+            if (lower[i] >= upper[i])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool boxesOverlap(
+        Offset const &lower1,
+        Offset const &upper1,
+        Offset const &lower2,
+        Offset const &upper2)
+    {
+        for (size_t i = 0; i < lower1.size(); ++i)
+        {
+            if (std::max(lower1[i], lower2[i]) >=
+                std::min(upper1[i], upper2[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint64_t volume(Offset const &lower, Offset const &upper)
+    {
+        uint64_t res = 1;
+        for (size_t i = 0; i < lower.size(); ++i)
+        {
+            res *= upper[i] - lower[i];
+        }
+        return res;
+    }
+
+    /*
+     * Copy the block [lower, upper) from a row-major array with origin
+     * srcOffset and shape srcExtent into a row-major array with origin
+     * dstOffset and shape dstExtent. The last dimension is contiguous in both.
+     */
+    void copyBlock(
+        char const *src,
+        Offset const &srcOffset,
+        Extent const &srcExtent,
+        char *dst,
+        Offset const &dstOffset,
+        Extent const &dstExtent,
+        Offset const &lower,
+        Offset const &upper,
+        size_t elementSize)
+    {
+        auto dim = lower.size();
+        if (dim == 0)
+        {
+            std::memcpy(dst, src, elementSize);
+            return;
+        }
+        auto linear = [dim](
+                          Offset const &index,
+                          Offset const &origin,
+                          Extent const &shape) {
+            uint64_t res = 0;
+            for (size_t i = 0; i < dim; ++i)
+            {
+                res = res * shape[i] + (index[i] - origin[i]);
+            }
+            return res;
+        };
+        size_t rowBytes = (upper[dim - 1] - lower[dim - 1]) * elementSize;
+        Offset index = lower;
+        while (true)
+        {
+            std::memcpy(
+                dst + linear(index, dstOffset, dstExtent) * elementSize,
+                src + linear(index, srcOffset, srcExtent) * elementSize,
+                rowBytes);
+            // advance the index in all but the last dimension
+            size_t i = dim - 1;
+            while (i > 0)
+            {
+                --i;
+                if (++index[i] < upper[i])
+                {
+                    break;
+                }
+                index[i] = lower[i];
+                if (i == 0)
+                {
+                    return;
+                }
+            }
+            if (dim == 1)
+            {
+                return;
+            }
+        }
+    }
+} // namespace
+
+void Dataset::storeChunk(Chunk chunk)
+{
+    auto it = std::find_if(chunks.begin(), chunks.end(), [&](Chunk const &c) {
+        return sameRegion(c, chunk.offset, chunk.extent);
+    });
+    if (it != chunks.end())
+    {
+        // keep the order of writing, the new chunk is the latest one
+        chunks.erase(it);
+    }
+    chunks.push_back(std::move(chunk));
+}
+
+void Dataset::loadChunk(
+    Offset const &offset, Extent const &selection, void *into) const
+{
+    auto elementSize = toBytes(dtype);
+    uint64_t total = 1;
+    for (auto e : selection)
+    {
+        total *= e;
+    }
+    if (total == 0)
+    {
+        return;
+    }
+
+    struct Piece
+    {
+        Chunk const *chunk;
+        Offset lower;
+        Offset upper;
+    };
+    std::vector<Piece> pieces;
+    uint64_t covered = 0;
+    for (auto const &chunk : chunks)
+    {
+        Piece piece{&chunk, {}, {}};
+        if (!chunk.data ||
+            !intersect(chunk, offset, selection, piece.lower, piece.upper))
+        {
+            continue;
+        }
+        covered += volume(piece.lower, piece.upper);
+        pieces.push_back(std::move(piece));
+    }
+
+    /*
+     * Zero-fill only if some part of the selection is not written to.
+     * The covered volume counts overlapping regions twice, so a cheap check
+     * on it is only conclusive if no two pieces overlap.
+     */
+    bool exactlyCovered = covered == total;
+    for (size_t i = 0; exactlyCovered && i < pieces.size(); ++i)
+    {
+        for (size_t j = i + 1; exactlyCovered && j < pieces.size(); ++j)
+        {
+            exactlyCovered = !boxesOverlap(
+                pieces[i].lower,
+                pieces[i].upper,
+                pieces[j].lower,
+                pieces[j].upper);
+        }
+    }
+    if (!exactlyCovered)
+    {
+        std::memset(into, 0, total * elementSize);
+    }
+
+    for (auto const &piece : pieces)
+    {
+        copyBlock(
+            static_cast<char const *>(piece.chunk->data.get()),
+            piece.chunk->offset,
+            piece.chunk->extent,
+            static_cast<char *>(into),
+            offset,
+            selection,
+            piece.lower,
+            piece.upper,
+            elementSize);
+    }
+}
+
+std::shared_ptr<void const>
+Dataset::viewChunk(Offset const &offset, Extent const &selection) const
+{
+    for (auto it = chunks.rbegin(); it != chunks.rend(); ++it)
+    {
+        Offset lower, upper;
+        if (!it->data || !intersect(*it, offset, selection, lower, upper))
+        {
+            continue;
+        }
+        // the latest chunk touching the selection must contain all of it
+        Offset relative(offset.size());
+        for (size_t i = 0; i < offset.size(); ++i)
+        {
+            if (offset[i] < it->offset[i])
+            {
+                return nullptr;
+            }
+            relative[i] = offset[i] - it->offset[i];
+        }
+        auto start = auxiliary::contiguousSelectionStart(
+            it->extent, relative, selection);
+        if (!start.has_value())
+        {
+            return nullptr;
+        }
+        return std::shared_ptr<void const>(
+            it->data,
+            static_cast<char const *>(it->data.get()) +
+                *start * toBytes(dtype));
+    }
+    return nullptr;
+}
+
+ChunkTable Dataset::chunkTable() const
+{
+    ChunkTable res;
+    res.reserve(chunks.size());
+    for (auto const &chunk : chunks)
+    {
+        res.emplace_back(chunk.offset, chunk.extent, 0);
+    }
+    return res;
+}
+
+void Dataset::verifySelection(
+    Offset const &offset,
+    Extent const &selection,
+    Datatype requested,
+    std::string const &backendName) const
+{
+    if (offset.size() != extent.size() || selection.size() != extent.size())
+    {
+        throw std::runtime_error(
+            "[" + backendName +
+            "] Dimensionality of the selection does not match the dataset.");
+    }
+    for (size_t i = 0; i < extent.size(); ++i)
+    {
+        if (offset[i] + selection[i] > extent[i])
+        {
+            throw std::runtime_error(
+                "[" + backendName +
+                "] Selection exceeds the extent of the dataset.");
+        }
+    }
+    if (!isSame(requested, dtype))
+    {
+        throw std::runtime_error(
+            "[" + backendName +
+            "] Datatype of the selection does not match the dataset.");
+    }
+}
+
+std::shared_ptr<Node>
+findNode(std::shared_ptr<Node> const &root, std::string const &path)
+{
+    auto node = root;
+    for (auto const &segment : auxiliary::split(path, "/"))
+    {
+        if (!node)
+        {
+            return nullptr;
+        }
+        auto it = node->children.find(segment);
+        if (it == node->children.end())
+        {
+            return nullptr;
+        }
+        node = it->second;
+    }
+    return node;
+}
+
+std::shared_ptr<Node>
+ensureNode(std::shared_ptr<Node> const &root, std::string const &path)
+{
+    auto node = root;
+    for (auto const &segment : auxiliary::split(path, "/"))
+    {
+        auto &child = node->children[segment];
+        if (!child)
+        {
+            child = std::make_shared<Node>();
+        }
+        node = child;
+    }
+    return node;
+}
+
+bool eraseNode(std::shared_ptr<Node> const &root, std::string const &path)
+{
+    auto segments = auxiliary::split(path, "/");
+    if (segments.empty())
+    {
+        // the root itself: clear it
+        bool existed = !root->children.empty() || !root->attributes.empty();
+        *root = Node();
+        return existed;
+    }
+    auto last = std::move(segments.back());
+    segments.pop_back();
+    auto node = root;
+    for (auto const &segment : segments)
+    {
+        auto it = node->children.find(segment);
+        if (it == node->children.end())
+        {
+            return false;
+        }
+        node = it->second;
+    }
+    return node->children.erase(last) > 0;
+}
+
+std::string joinPath(std::string const &location, std::string const &path)
+{
+    std::string res;
+    if (!auxiliary::starts_with(path, '/'))
+    {
+        res = auxiliary::removeSlashes(location);
+    }
+    auto suffix = auxiliary::removeSlashes(path);
+    if (!suffix.empty())
+    {
+        if (!res.empty())
+        {
+            res += '/';
+        }
+        res += suffix;
+    }
+    return "/" + res;
+}
+
+FilePosition::FilePosition(std::string location_in)
+    : location(std::move(location_in))
+{}
+} // namespace openPMD::memory
@@ -0,0 +1,421 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/IO/Memory/MemoryIOHandler.hpp"
+#include "openPMD/Error.hpp"
+#include "openPMD/IO/Access.hpp"
+#include "openPMD/IO/Memory/MemoryIOHandlerImpl.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/backend/Writable.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace openPMD
+{
+namespace
+{
+    /*
+     * Files of all MemoryIOHandlers in this process.
+     * Only the registry itself is synchronized, the hierarchy of a file must
+     * not be modified while another Series accesses it concurrently.
+     */
+    struct Registry
+    {
+        struct File
+        {
+            // null for files that are released once no Series uses them
+            std::shared_ptr<memory::Node> owned;
+            std::weak_ptr<memory::Node> root;
+        };
+        std::mutex mutex;
+        std::map<std::string, File> files;
+
+        // call with the mutex locked
+        std::shared_ptr<memory::Node> find(std::string const &key)
+        {
+            auto it = files.find(key);
+            if (it == files.end())
+            {
+                return nullptr;
+            }
+            auto res = it->second.root.lock();
+            if (!res)
+            {
+                files.erase(it);
+            }
+            return res;
+        }
+
+        // call with the mutex locked
+        void pruneReleased()
+        {
+            for (auto it = files.begin(); it != files.end();)
+            {
+                it = it->second.root.expired() ? files.erase(it) : ++it;
+            }
+        }
+    };
+
+    Registry &registry()
+    {
+        static Registry res;
+        return res;
+    }
+
+    // lexically normalized, since there is no file to resolve the path with
+    std::string normalizePath(std::string const &path)
+    {
+        std::vector<std::string> segments;
+        for (auto &segment : auxiliary::split(path, "/"))
+        {
+            if (segment == ".")
+            {
+                continue;
+            }
+            else if (
+                segment == ".." && !segments.empty() && segments.back() != "..")
+            {
+                segments.pop_back();
+            }
+            else
+            {
+                segments.push_back(std::move(segment));
+            }
+        }
+        std::string res = auxiliary::starts_with(path, '/') ? "/" : "";
+        for (size_t i = 0; i < segments.size(); ++i)
+        {
+            res += (i == 0 ? "" : "/") + segments[i];
+        }
+        return res;
+    }
+
+    std::shared_ptr<memory::FilePosition>
+    rootPosition(std::shared_ptr<memory::Node> const &root)
+    {
+        auto res = std::make_shared<memory::FilePosition>();
+        res->node = root;
+        res->root = root;
+        return res;
+    }
+} // namespace
+
+MemoryIOHandlerImpl::MemoryIOHandlerImpl(
+    AbstractIOHandler *handler,
+    json::TracingJSON config,
+    std::string originalExtension,
+    bool warnUnusedParameters)
+    : HierarchyIOHandlerImpl(handler)
+    , m_originalExtension(std::move(originalExtension))
+{
+    if (!config.json().contains("memory"))
+    {
+        return;
+    }
+    auto memoryConfig = config["memory"];
+    if (memoryConfig.json().contains("persist"))
+    {
+        auto const &value = memoryConfig["persist"].json();
+        if (!value.is_boolean())
+        {
+            throw error::BackendConfigSchema(
+                {"memory", "persist"}, "Must be a boolean value.");
+        }
+        m_persist = value.get<bool>();
+    }
+
+    if (warnUnusedParameters)
+    {
+        auto shadow = memoryConfig.invertShadow();
+        if (shadow.size() > 0)
+        {
+            switch (memoryConfig.originallySpecifiedAs)
+            {
+            case json::SupportedLanguages::JSON:
+                std::cerr << "Warning: parts of the backend configuration for "
+                             "MEMORY remain unused:\n"
+                          << shadow << std::endl;
+                break;
+            case json::SupportedLanguages::TOML: {
+                auto asToml = json::jsonToToml(shadow);
+                std::cerr << "Warning: parts of the backend configuration for "
+                             "MEMORY remain unused:\n"
+                          << json::format_toml(asToml) << std::endl;
+                break;
+            }
+            }
+        }
+    }
+}
+
+MemoryIOHandlerImpl::~MemoryIOHandlerImpl()
+{
+    // release the files that only this handler still used
+    m_roots.clear();
+    auto &reg = registry();
+    std::lock_guard lock(reg.mutex);
+    reg.pruneReleased();
+}
+
+void MemoryIOHandlerImpl::createFile(
+    Writable *writable, Parameter<Operation::CREATE_FILE> const &parameters)
+{
+    if (!access::write(m_handler->m_backendAccess))
+    {
+        throw std::runtime_error(
+            "[MEMORY] Creating a file in read-only mode is not possible.");
+    }
+    if (writable->written)
+    {
+        return;
+    }
+    std::string name = parameters.name + m_originalExtension;
+    auto key = registryKey(name);
+
+    std::shared_ptr<memory::Node> root;
+    {
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        root = reg.find(key);
+        if (root && m_handler->m_backendAccess == Access::READ_WRITE)
+        {
+            throw std::runtime_error(
+                "[MEMORY] Can only overwrite existing file in CREATE mode.");
+        }
+        if (!root || m_handler->m_backendAccess != Access::APPEND)
+        {
+            // Series that have the previous version open keep it alive
+            root = std::make_shared<memory::Node>();
+            reg.files[key] = {m_persist ? root : nullptr, root};
+        }
+    }
+
+    auto file = bindFile(writable, std::move(name));
+    m_roots[file] = root;
+    m_dirty.emplace(file);
+    writable->written = true;
+    writable->abstractFilePosition = rootPosition(root);
+}
+
+void MemoryIOHandlerImpl::checkFile(
+    Writable *, Parameter<Operation::CHECK_FILE> &parameters)
+{
+    std::string name = parameters.name;
+    if (!auxiliary::ends_with(name, m_originalExtension))
+    {
+        name += m_originalExtension;
+    }
+    auto key = registryKey(name);
+    auto &reg = registry();
+    std::lock_guard lock(reg.mutex);
+    using FileExists = Parameter<Operation::CHECK_FILE>::FileExists;
+    *parameters.fileExists =
+        reg.find(key) ? FileExists::Yes : FileExists::No;
+}
+
+void MemoryIOHandlerImpl::openFile(
+    Writable *writable, Parameter<Operation::OPEN_FILE> &parameters)
+{
+    std::string name = parameters.name + m_originalExtension;
+    auto key = registryKey(name);
+
+    std::shared_ptr<memory::Node> root;
+    {
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        root = reg.find(key);
+    }
+    if (!root)
+    {
+        throw error::ReadError(
+            error::AffectedObject::File,
+            error::Reason::NotFound,
+            "MEMORY",
+            "No such file in memory: " + key);
+    }
+
+    auto file = bindFile(writable, std::move(name));
+    m_roots[file] = root;
+    m_dirty.emplace(file);
+    writable->written = true;
+    writable->abstractFilePosition = rootPosition(root);
+}
+
+void MemoryIOHandlerImpl::closeFile(
+    Writable *writable, Parameter<Operation::CLOSE_FILE> const &)
+{
+    auto fileIterator = m_files.find(writable);
+    if (fileIterator == m_files.end())
+    {
+        return;
+    }
+    // persistent hierarchies stay in the registry, nothing to write
+    auto file = fileIterator->second;
+    m_roots.erase(file);
+    m_dirty.erase(file);
+    m_files.erase(fileIterator);
+    auto &reg = registry();
+    std::lock_guard lock(reg.mutex);
+    reg.pruneReleased();
+}
+
+void MemoryIOHandlerImpl::deleteFile(
+    Writable *writable, Parameter<Operation::DELETE_FILE> const &parameters)
+{
+    if (!access::write(m_handler->m_backendAccess))
+    {
+        throw std::runtime_error(
+            "[MEMORY] Cannot delete files in read-only mode.");
+    }
+    if (!writable->written)
+    {
+        return;
+    }
+    auto name = auxiliary::ends_with(parameters.name, m_originalExtension)
+        ? parameters.name
+        : parameters.name + m_originalExtension;
+
+    for (auto &[fileWritable, file] : m_files)
+    {
+        if (*file == name && file.valid())
+        {
+            m_roots.erase(file);
+            m_dirty.erase(file);
+            file.invalidate();
+            break;
+        }
+    }
+    {
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        reg.files.erase(registryKey(name));
+    }
+    writable->written = false;
+}
+
+std::optional<std::vector<std::string>>
+MemoryIOHandlerImpl::listDirectory(std::string const &directory)
+{
+    auto prefix = normalizePath(directory);
+    if (!prefix.empty() && prefix != "/")
+    {
+        prefix += '/';
+    }
+    std::vector<std::string> res;
+    auto &reg = registry();
+    std::lock_guard lock(reg.mutex);
+    reg.pruneReleased();
+    for (auto const &entry : reg.files)
+    {
+        auto const &key = entry.first;
+        if (auxiliary::starts_with(key, prefix) &&
+            key.find('/', prefix.size()) == std::string::npos)
+        {
+            res.push_back(key.substr(prefix.size()));
+        }
+    }
+    // a directory exists in memory as long as it contains files
+    if (res.empty())
+    {
+        return std::nullopt;
+    }
+    return res;
+}
+
+bool MemoryIOHandlerImpl::adoptsWriteBuffers() const
+{
+    // the data is kept as is, copies would only cost time
+    return true;
+}
+
+std::string MemoryIOHandlerImpl::registryKey(std::string const &fileName)
+{
+    return normalizePath(fullPath(fileName));
+}
+
+InvalidatableFile
+MemoryIOHandlerImpl::bindFile(Writable *writable, std::string name)
+{
+    auto it = std::find_if(
+        m_files.begin(), m_files.end(), [&name](auto const &entry) {
+            return *entry.second == name && entry.second.valid();
+        });
+    InvalidatableFile file =
+        it == m_files.end() ? InvalidatableFile(std::move(name)) : it->second;
+    associateWithFile(writable, file);
+    return file;
+}
+
+MemoryIOHandler::MemoryIOHandler(
+    std::string path,
+    Access at,
+    json::TracingJSON config,
+    std::string originalExtension)
+    : AbstractIOHandler(std::move(path), at)
+    , m_impl{new MemoryIOHandlerImpl(
+          this, std::move(config), std::move(originalExtension))}
+{}
+
+#if openPMD_HAVE_MPI
+namespace
+{
+    bool isRankZero(MPI_Comm comm)
+    {
+        int rank = 0;
+        MPI_Comm_rank(comm, &rank);
+        return rank == 0;
+    }
+} // namespace
+
+MemoryIOHandler::MemoryIOHandler(
+    std::string path,
+    Access at,
+    MPI_Comm comm,
+    json::TracingJSON config,
+    std::string originalExtension)
+    : AbstractIOHandler(std::move(path), at, comm)
+    , m_impl{new MemoryIOHandlerImpl(
+          this,
+          std::move(config),
+          std::move(originalExtension),
+          /* warnUnusedParameters = */ isRankZero(comm))}
+{}
+#endif
+
+MemoryIOHandler::~MemoryIOHandler() = default;
+
+std::future<void> MemoryIOHandler::flush(internal::ParsedFlushParams &)
+{
+    return m_impl->flush();
+}
+
+std::optional<std::vector<std::string>>
+MemoryIOHandler::listDirectory(std::string const &dir) const
+{
+    return MemoryIOHandlerImpl::listDirectory(dir);
+}
+} // namespace openPMD
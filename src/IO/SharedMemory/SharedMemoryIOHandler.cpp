@@ -0,0 +1,1110 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/IO/SharedMemory/SharedMemoryIOHandler.hpp"
+#include "openPMD/IO/SharedMemory/SharedMemoryIOHandlerImpl.hpp"
+
+#if openPMD_HAVE_SHM
+#include "openPMD/Error.hpp"
+#include "openPMD/IO/Access.hpp"
+#include "openPMD/ThrowError.hpp"
+#include "openPMD/auxiliary/StringManip.hpp"
+#include "openPMD/auxiliary/TypeTraits.hpp"
+#include "openPMD/backend/Writable.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <unistd.h>
+#endif
+
+namespace openPMD
+{
+#if openPMD_HAVE_SHM
+namespace
+{
+    /*
+     * Layout of the metadata segment of a step, all in native byte order
+     * (both sides run on the same host):
+     *
+     * magic | number of data segments | number of records | records...
+     *
+     * Each record starts with its memory::Change::Type and the path, followed
+     * by the attribute name and value, or by the dataset's datatype, extent
+     * and chunk table. Each chunk refers to its data by data segment index
+     * and byte offset within that segment.
+     */
+    constexpr uint64_t metadataMagic = 0x31304d5344504f00; // "\0OPDSM01"
+    constexpr uint64_t noDataSegment = uint64_t(-1);
+
+    class MetadataWriter
+    {
+    public:
+        template <typename T>
+        void put(T const &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            putBytes(&value, sizeof(T));
+        }
+
+        void putBytes(void const *data, size_t size)
+        {
+            auto begin = static_cast<char const *>(data);
+            m_buffer.insert(m_buffer.end(), begin, begin + size);
+        }
+
+        void putString(std::string const &s)
+        {
+            put<uint64_t>(s.size());
+            putBytes(s.data(), s.size());
+        }
+
+        void putExtent(std::vector<uint64_t> const &extent)
+        {
+            put<uint64_t>(extent.size());
+            putBytes(extent.data(), extent.size() * sizeof(uint64_t));
+        }
+
+        // overwrite a previously written value
+        template <typename T>
+        void patch(size_t position, T const &value)
+        {
+            std::memcpy(m_buffer.data() + position, &value, sizeof(T));
+        }
+
+        std::vector<char> const &buffer() const
+        {
+            return m_buffer;
+        }
+
+    private:
+        std::vector<char> m_buffer;
+    };
+
+    class MetadataReader
+    {
+    public:
+        MetadataReader(void const *data, size_t size)
+            : m_pos(static_cast<char const *>(data)), m_end(m_pos + size)
+        {}
+
+        template <typename T>
+        T get()
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T res;
+            getBytes(&res, sizeof(T));
+            return res;
+        }
+
+        void getBytes(void *into, size_t size)
+        {
+            if (size > size_t(m_end - m_pos))
+            {
+                corrupt();
+            }
+            std::memcpy(into, m_pos, size);
+            m_pos += size;
+        }
+
+        std::string getString()
+        {
+            auto size = getCount(1);
+            std::string res(m_pos, size);
+            m_pos += size;
+            return res;
+        }
+
+        std::vector<uint64_t> getExtent()
+        {
+            std::vector<uint64_t> res(getCount(sizeof(uint64_t)));
+            getBytes(res.data(), res.size() * sizeof(uint64_t));
+            return res;
+        }
+
+        /*
+         * Read the number of following elements, verifying that at least
+         * that many elements of the given size remain.
+         */
+        size_t getCount(size_t elementSize)
+        {
+            auto count = get<uint64_t>();
+            if (elementSize > 0 &&
+                count > uint64_t(m_end - m_pos) / elementSize)
+            {
+                corrupt();
+            }
+            return count;
+        }
+
+        [[noreturn]] static void corrupt()
+        {
+            throw error::ReadError(
+                error::AffectedObject::Other,
+                error::Reason::UnexpectedContent,
+                "SHM",
+                "Corrupted metadata of an IO step.");
+        }
+
+    private:
+        char const *m_pos;
+        char const *m_end;
+    };
+
+    void writeAttributeValue(MetadataWriter &out, Attribute const &attribute)
+    {
+        auto resource = attribute.getResource();
+        out.put<uint32_t>(resource.index());
+        std::visit(
+            [&out](auto const &value) {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, std::string>)
+                {
+                    out.putString(value);
+                }
+                else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+                {
+                    out.put<uint64_t>(value.size());
+                    for (auto const &s : value)
+                    {
+                        out.putString(s);
+                    }
+                }
+                else if constexpr (auxiliary::IsVector_v<T>)
+                {
+                    out.put<uint64_t>(value.size());
+                    out.putBytes(
+                        value.data(),
+                        value.size() * sizeof(typename T::value_type));
+                }
+                else
+                {
+                    // scalars and std::array
+                    out.put(value);
+                }
+            },
+            resource);
+    }
+
+    template <typename T>
+    T readValue(MetadataReader &in)
+    {
+        if constexpr (std::is_same_v<T, std::string>)
+        {
+            return in.getString();
+        }
+        else if constexpr (std::is_same_v<T, std::vector<std::string>>)
+        {
+            T res(in.getCount(sizeof(uint64_t)));
+            for (auto &s : res)
+            {
+                s = in.getString();
+            }
+            return res;
+        }
+        else if constexpr (auxiliary::IsVector_v<T>)
+        {
+            using value_type = typename T::value_type;
+            T res(in.getCount(sizeof(value_type)));
+            in.getBytes(res.data(), res.size() * sizeof(value_type));
+            return res;
+        }
+        else
+        {
+            return in.get<T>();
+        }
+    }
+
+    template <size_t... I>
+    Attribute::resource
+    readAttributeValue(MetadataReader &in, std::index_sequence<I...>)
+    {
+        using resource = Attribute::resource;
+        using decoder = resource (*)(MetadataReader &);
+        static decoder const decoders[] = {[](MetadataReader &r) {
+            return resource(
+                std::in_place_index<I>,
+                readValue<std::variant_alternative_t<I, resource>>(r));
+        }...};
+        auto index = in.get<uint32_t>();
+        if (index >= sizeof...(I))
+        {
+            MetadataReader::corrupt();
+        }
+        return decoders[index](in);
+    }
+
+    Attribute::resource readAttributeValue(MetadataReader &in)
+    {
+        return readAttributeValue(
+            in,
+            std::make_index_sequence<
+                std::variant_size_v<Attribute::resource>>());
+    }
+
+    size_t numberOfBytes(Datatype dtype, Extent const &extent)
+    {
+        size_t res = toBytes(dtype);
+        for (auto e : extent)
+        {
+            res *= e;
+        }
+        return res;
+    }
+
+    std::optional<uint64_t> readUnsigned(
+        json::TracingJSON &config, char const *key, uint64_t minimum = 0)
+    {
+        if (!config.json().contains(key))
+        {
+            return std::nullopt;
+        }
+        auto const &value = config[key].json();
+        if (!value.is_number_integer() || value.get<int64_t>() < 0 ||
+            value.get<uint64_t>() < minimum)
+        {
+            throw error::BackendConfigSchema(
+                {"shm", key},
+                "Must be an integer of at least " + std::to_string(minimum) +
+                    ".");
+        }
+        return value.get<uint64_t>();
+    }
+
+    bool isValidStreamName(std::string const &name)
+    {
+        return !name.empty() && name.size() <= 128 &&
+            std::all_of(name.begin(), name.end(), [](unsigned char c) {
+                   return std::isalnum(c) || c == '.' || c == '-' || c == '_';
+               });
+    }
+
+    // lexically normalized, since the file need not exist
+    std::string absolutePath(std::string const &path)
+    {
+        std::string absolute = path;
+        if (!auxiliary::starts_with(path, '/'))
+        {
+            std::vector<char> cwd(4096);
+            if (getcwd(cwd.data(), cwd.size()))
+            {
+                absolute = std::string(cwd.data()) + "/" + path;
+            }
+        }
+        std::vector<std::string> segments;
+        for (auto &segment : auxiliary::split(absolute, "/"))
+        {
+            if (segment == ".")
+            {
+                continue;
+            }
+            else if (segment == "..")
+            {
+                if (!segments.empty())
+                {
+                    segments.pop_back();
+                }
+            }
+            else
+            {
+                segments.push_back(std::move(segment));
+            }
+        }
+        std::string res;
+        for (auto const &segment : segments)
+        {
+            res += "/" + segment;
+        }
+        return res;
+    }
+
+    std::shared_ptr<memory::FilePosition>
+    rootPosition(std::shared_ptr<memory::Node> const &root)
+    {
+        auto res = std::make_shared<memory::FilePosition>();
+        res->node = root;
+        res->root = root;
+        return res;
+    }
+} // namespace
+
+SharedMemoryIOHandlerImpl::SharedMemoryIOHandlerImpl(
+    AbstractIOHandler *handler,
+    json::TracingJSON config,
+    std::string originalExtension,
+    std::string nameSuffix,
+    bool warnUnusedParameters)
+    : HierarchyIOHandlerImpl(handler)
+    , m_originalExtension(std::move(originalExtension))
+    , m_nameSuffix(std::move(nameSuffix))
+{
+    if (m_handler->m_backendAccess == Access::READ_WRITE)
+    {
+        error::throwOperationUnsupportedInBackend(
+            "SHM",
+            "Streams are either written or read, Access::READ_WRITE is not "
+            "supported.");
+    }
+
+    if (!config.json().contains("shm"))
+    {
+        return;
+    }
+    auto shmConfig = config["shm"];
+    if (auto queueLimit = readUnsigned(shmConfig, "queue_limit"); queueLimit)
+    {
+        m_streamOptions.queueLimit = *queueLimit;
+    }
+    if (auto segmentSize = readUnsigned(shmConfig, "segment_size", 1);
+        segmentSize)
+    {
+        m_segmentSize = *segmentSize;
+    }
+    if (shmConfig.json().contains("open_timeout"))
+    {
+        auto const &value = shmConfig["open_timeout"].json();
+        if (!value.is_number() || value.get<double>() < 0)
+        {
+            throw error::BackendConfigSchema(
+                {"shm", "open_timeout"},
+                "Must be a non-negative number of seconds.");
+        }
+        m_streamOptions.openTimeout = std::chrono::milliseconds(
+            std::llround(value.get<double>() * 1000.));
+    }
+    if (shmConfig.json().contains("name"))
+    {
+        auto const &value = shmConfig["name"].json();
+        if (!value.is_string() ||
+            !isValidStreamName(value.get<std::string>()))
+        {
+            throw error::BackendConfigSchema(
+                {"shm", "name"},
+                "Must be a string of up to 128 letters, digits, '.', '-' or "
+                "'_'.");
+        }
+        m_streamNameOverride = value.get<std::string>();
+    }
+
+    if (warnUnusedParameters)
+    {
+        auto shadow = shmConfig.invertShadow();
+        if (shadow.size() > 0)
+        {
+            switch (shmConfig.originallySpecifiedAs)
+            {
+            case json::SupportedLanguages::JSON:
+                std::cerr << "Warning: parts of the backend configuration for "
+                             "SHM remain unused:\n"
+                          << shadow << std::endl;
+                break;
+            case json::SupportedLanguages::TOML: {
+                auto asToml = json::jsonToToml(shadow);
+                std::cerr << "Warning: parts of the backend configuration for "
+                             "SHM remain unused:\n"
+                          << json::format_toml(asToml) << std::endl;
+                break;
+            }
+            }
+        }
+    }
+}
+
+SharedMemoryIOHandlerImpl::~SharedMemoryIOHandlerImpl()
+{
+    try
+    {
+        detach();
+    }
+    catch (std::exception const &ex)
+    {
+        std::cerr << "[~SharedMemoryIOHandlerImpl] An error occurred while "
+                     "closing the stream: "
+                  << ex.what() << std::endl;
+    }
+}
+
+void SharedMemoryIOHandlerImpl::createFile(
+    Writable *writable, Parameter<Operation::CREATE_FILE> const &parameters)
+{
+    if (!access::write(m_handler->m_backendAccess))
+    {
+        throw std::runtime_error(
+            "[SHM] Creating a stream in read-only mode is not possible.");
+    }
+    if (writable->written)
+    {
+        return;
+    }
+    std::string name = parameters.name + m_originalExtension;
+    auto file = bindFile(writable, name);
+    if (!m_stream)
+    {
+        m_stream = std::make_unique<shm::Stream>(
+            streamName(name), shm::Stream::Role::Writer, m_streamOptions);
+    }
+    auto &root = m_roots[file];
+    if (!root)
+    {
+        root = std::make_shared<memory::Node>();
+    }
+    m_dirty.emplace(file);
+    writable->written = true;
+    writable->abstractFilePosition = rootPosition(root);
+}
+
+void SharedMemoryIOHandlerImpl::checkFile(
+    Writable *, Parameter<Operation::CHECK_FILE> &parameters)
+{
+    // writers always start a new stream
+    using FileExists = Parameter<Operation::CHECK_FILE>::FileExists;
+    *parameters.fileExists = FileExists::No;
+}
+
+void SharedMemoryIOHandlerImpl::openFile(
+    Writable *writable, Parameter<Operation::OPEN_FILE> &parameters)
+{
+    if (access::write(m_handler->m_backendAccess))
+    {
+        error::throwOperationUnsupportedInBackend(
+            "SHM", "Opening an existing stream for writing is not supported.");
+    }
+    std::string name = parameters.name + m_originalExtension;
+    auto file = bindFile(writable, name);
+    // the frontend opens the file again in each step
+    if (!m_stream)
+    {
+        m_stream = std::make_unique<shm::Stream>(
+            streamName(name), shm::Stream::Role::Reader, m_streamOptions);
+        m_roots[file] = std::make_shared<memory::Node>();
+        /*
+         * The frontend parses the Series before beginning the first step,
+         * so its contents must be available already.
+         */
+        if (!acquireStep())
+        {
+            detach();
+            throw error::ReadError(
+                error::AffectedObject::File,
+                error::Reason::NotFound,
+                "SHM",
+                "Stream '" + name + "' ended before sending any step.");
+        }
+        m_readerStatus = ReaderStatus::FirstStepPending;
+    }
+    m_dirty.emplace(file);
+    writable->written = true;
+    writable->abstractFilePosition = rootPosition(m_roots.at(file));
+    *parameters.out_parsePreference =
+        Parameter<Operation::OPEN_FILE>::ParsePreference::PerStep;
+}
+
+void SharedMemoryIOHandlerImpl::closeFile(
+    Writable *writable, Parameter<Operation::CLOSE_FILE> const &)
+{
+    auto fileIterator = m_files.find(writable);
+    if (fileIterator == m_files.end())
+    {
+        return;
+    }
+    auto file = fileIterator->second;
+    detach();
+    m_roots.erase(file);
+    m_dirty.erase(file);
+    m_files.erase(fileIterator);
+}
+
+void SharedMemoryIOHandlerImpl::deleteFile(
+    Writable *, Parameter<Operation::DELETE_FILE> const &)
+{
+    throw std::runtime_error("[SHM] Backend does not support deletion.");
+}
+
+void SharedMemoryIOHandlerImpl::advance(
+    Writable *, Parameter<Operation::ADVANCE> &parameters)
+{
+    if (!m_stream)
+    {
+        throw error::Internal("[SHM] Cannot advance a stream that is closed.");
+    }
+    *parameters.status = AdvanceStatus::OK;
+    if (access::write(m_handler->m_backendAccess))
+    {
+        // steps begin implicitly
+        if (parameters.mode == AdvanceMode::ENDSTEP)
+        {
+            publishStep();
+        }
+        return;
+    }
+    switch (parameters.mode)
+    {
+    case AdvanceMode::BEGINSTEP:
+        switch (m_readerStatus)
+        {
+        case ReaderStatus::NoStep:
+            if (!acquireStep())
+            {
+                *parameters.status = AdvanceStatus::OVER;
+                return;
+            }
+            break;
+        case ReaderStatus::FirstStepPending:
+        case ReaderStatus::InStep:
+            break;
+        }
+        m_readerStatus = ReaderStatus::InStep;
+        break;
+    case AdvanceMode::ENDSTEP:
+        if (m_readerStatus != ReaderStatus::NoStep)
+        {
+            releaseStep();
+            m_readerStatus = ReaderStatus::NoStep;
+        }
+        break;
+    }
+}
+
+void SharedMemoryIOHandlerImpl::closePath(
+    Writable *writable, Parameter<Operation::CLOSE_PATH> const &)
+{
+    if (access::readOnly(m_handler->m_backendAccess) || !writable->written)
+    {
+        return;
+    }
+    /*
+     * The group is done, drop it from the writer's hierarchy and tell the
+     * reader to do the same with the next step.
+     */
+    auto file = refreshFileFromParent(writable, /* preferParentFile = */ false);
+    auto location = filePositionToString(setAndGetFilePosition(writable));
+    if (auto root = m_roots.find(file); root != m_roots.end())
+    {
+        memory::eraseNode(root->second, location);
+    }
+    recordChange(file, {memory::Change::Type::DeletePath, location, {}});
+}
+
+std::shared_ptr<void> SharedMemoryIOHandlerImpl::allocateChunk(
+    InvalidatableFile const &file, size_t bytes)
+{
+    if (!m_stream)
+    {
+        return HierarchyIOHandlerImpl::allocateChunk(file, bytes);
+    }
+    constexpr size_t alignment = 64;
+    if (!m_arena.empty())
+    {
+        auto &current = m_arena.back();
+        size_t start = (current.used + alignment - 1) / alignment * alignment;
+        if (start + bytes <= current.segment->size())
+        {
+            current.used = start + bytes;
+            return std::shared_ptr<void>(
+                current.segment,
+                static_cast<char *>(current.segment->data()) + start);
+        }
+    }
+    auto segment = std::make_shared<shm::Segment>(shm::Segment::create(
+        m_stream->stepSegmentName(m_stream->nextStep(), m_arena.size()),
+        std::max(m_segmentSize, bytes)));
+    m_arena.push_back({segment, bytes});
+    return std::shared_ptr<void>(segment, segment->data());
+}
+
+void SharedMemoryIOHandlerImpl::recordChange(
+    InvalidatableFile const &, memory::Change change)
+{
+    using Type = memory::Change::Type;
+    auto key = [](memory::Change const &c) {
+        return std::make_tuple(c.type, c.path, c.name);
+    };
+    auto purge = [this, &key](auto const &predicate) {
+        for (auto const &c : m_changes)
+        {
+            if (predicate(c))
+            {
+                m_recordedChanges.erase(key(c));
+            }
+        }
+        m_changes.erase(
+            std::remove_if(m_changes.begin(), m_changes.end(), predicate),
+            m_changes.end());
+    };
+
+    // earlier changes that a deletion overrides need not be sent
+    switch (change.type)
+    {
+    case Type::DeletePath: {
+        auto prefix = change.path + "/";
+        purge([&change, &prefix](memory::Change const &c) {
+            return c.path == change.path ||
+                auxiliary::starts_with(c.path, prefix);
+        });
+        break;
+    }
+    case Type::DeleteAttribute:
+        purge([&change](memory::Change const &c) {
+            return c.type == Type::Attribute && c.path == change.path &&
+                c.name == change.name;
+        });
+        break;
+    default:
+        break;
+    }
+    if (m_recordedChanges.insert(key(change)).second)
+    {
+        m_changes.push_back(std::move(change));
+    }
+}
+
+bool SharedMemoryIOHandlerImpl::supportsSteps() const
+{
+    return true;
+}
+
+std::string SharedMemoryIOHandlerImpl::streamName(std::string const &fileName)
+{
+    std::string base;
+    if (m_streamNameOverride.has_value())
+    {
+        base = *m_streamNameOverride;
+    }
+    else
+    {
+        // writer and reader must agree on the name, so use the full path
+        auto path = absolutePath(fullPath(fileName));
+        uint64_t hash = 14695981039346656037ull; // FNV-1a
+        for (unsigned char c : path)
+        {
+            hash = (hash ^ c) * 1099511628211ull;
+        }
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+        auto basename = path.substr(path.rfind('/') + 1, 64);
+        for (auto &c : basename)
+        {
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' &&
+                c != '-')
+            {
+                c = '_';
+            }
+        }
+        base = std::string(hex) + "-" + basename;
+    }
+    return "/openPMD-" + base + m_nameSuffix;
+}
+
+InvalidatableFile
+SharedMemoryIOHandlerImpl::bindFile(Writable *writable, std::string name)
+{
+    if (m_file.has_value() && **m_file != name)
+    {
+        error::throwOperationUnsupportedInBackend(
+            "SHM",
+            "Only one stream can be accessed at a time, file-based iteration "
+            "encoding is not supported (tried opening '" +
+                name + "' while '" + **m_file + "' is open).");
+    }
+    if (!m_file.has_value())
+    {
+        m_file = InvalidatableFile(std::move(name));
+    }
+    associateWithFile(writable, *m_file);
+    return *m_file;
+}
+
+void SharedMemoryIOHandlerImpl::publishStep()
+{
+    using Type = memory::Change::Type;
+    auto const &root = m_roots.at(*m_file);
+    auto step = m_stream->nextStep();
+
+    MetadataWriter out;
+    out.put(metadataMagic);
+    out.put<uint64_t>(m_arena.size());
+    auto recordCountPosition = out.buffer().size();
+    uint64_t recordCount = 0;
+    out.put(recordCount);
+
+    for (auto const &change : m_changes)
+    {
+        auto node = memory::findNode(root, change.path);
+        switch (change.type)
+        {
+        case Type::Path:
+        case Type::DeletePath:
+        case Type::DeleteAttribute:
+            break;
+        case Type::Attribute:
+            if (!node || !node->attributes.count(change.name))
+            {
+                continue;
+            }
+            break;
+        case Type::Dataset:
+            if (!node || !node->dataset.has_value())
+            {
+                continue;
+            }
+            break;
+        }
+        ++recordCount;
+        out.put(static_cast<uint8_t>(change.type));
+        out.putString(change.path);
+        switch (change.type)
+        {
+        case Type::Path:
+        case Type::DeletePath:
+            break;
+        case Type::DeleteAttribute:
+            out.putString(change.name);
+            break;
+        case Type::Attribute:
+            out.putString(change.name);
+            writeAttributeValue(out, node->attributes.at(change.name));
+            break;
+        case Type::Dataset: {
+            auto const &dataset = *node->dataset;
+            out.put<uint32_t>(static_cast<uint32_t>(dataset.dtype));
+            out.putExtent(dataset.extent);
+            out.put<uint64_t>(dataset.chunks.size());
+            for (auto const &chunk : dataset.chunks)
+            {
+                out.putExtent(chunk.offset);
+                out.putExtent(chunk.extent);
+                auto ptr = static_cast<char const *>(chunk.data.get());
+                auto segment = std::find_if(
+                    m_arena.begin(),
+                    m_arena.end(),
+                    [ptr](ArenaSegment const &s) {
+                        auto begin =
+                            static_cast<char const *>(s.segment->data());
+                        return ptr >= begin && ptr < begin + s.segment->size();
+                    });
+                if (!ptr)
+                {
+                    out.put(noDataSegment);
+                    out.put<uint64_t>(0);
+                }
+                else if (segment == m_arena.end())
+                {
+                    throw error::Internal(
+                        "[SHM] Chunk of '" + change.path +
+                        "' is not located in shared memory.");
+                }
+                else
+                {
+                    out.put<uint64_t>(segment - m_arena.begin());
+                    out.put<uint64_t>(
+                        ptr -
+                        static_cast<char const *>(segment->segment->data()));
+                }
+            }
+            break;
+        }
+        }
+    }
+    out.patch(recordCountPosition, recordCount);
+
+    {
+        auto metadata = shm::Segment::create(
+            m_stream->stepSegmentName(step, std::nullopt),
+            out.buffer().size());
+        std::memcpy(metadata.data(), out.buffer().data(), out.buffer().size());
+    }
+    if (!m_stream->publish() && !m_printedDiscardWarning)
+    {
+        std::cerr << "[SHM] Warning: The reader has left the stream, further "
+                     "steps will be discarded."
+                  << std::endl;
+        m_printedDiscardWarning = true;
+    }
+
+    // the data of this step is the reader's now
+    for (auto const &change : m_changes)
+    {
+        if (change.type != Type::Dataset)
+        {
+            continue;
+        }
+        if (auto node = memory::findNode(root, change.path);
+            node && node->dataset.has_value())
+        {
+            node->dataset->chunks.clear();
+        }
+    }
+    m_arena.clear();
+    m_changes.clear();
+    m_recordedChanges.clear();
+}
+
+bool SharedMemoryIOHandlerImpl::acquireStep()
+{
+    using Type = memory::Change::Type;
+    auto step = m_stream->acquire();
+    if (!step.has_value())
+    {
+        return false;
+    }
+    auto metadata = shm::Segment::open(
+        m_stream->stepSegmentName(*step, std::nullopt), /* writable = */ false);
+    // the memory is released as soon as nobody maps it any longer
+    shm::Segment::unlink(metadata.name());
+    MetadataReader in(metadata.data(), metadata.size());
+    if (in.get<uint64_t>() != metadataMagic)
+    {
+        MetadataReader::corrupt();
+    }
+    auto dataSegmentCount = in.get<uint64_t>();
+    auto recordCount = in.get<uint64_t>();
+
+    std::vector<std::shared_ptr<shm::Segment const>> dataSegments;
+    for (uint64_t k = 0; k < dataSegmentCount; ++k)
+    {
+        auto segment = std::make_shared<shm::Segment const>(shm::Segment::open(
+            m_stream->stepSegmentName(*step, k), /* writable = */ false));
+        shm::Segment::unlink(segment->name());
+        dataSegments.push_back(std::move(segment));
+    }
+
+    auto const &root = m_roots.at(*m_file);
+    for (uint64_t r = 0; r < recordCount; ++r)
+    {
+        auto type = in.get<uint8_t>();
+        auto path = in.getString();
+        switch (static_cast<Type>(type))
+        {
+        case Type::Path:
+            memory::ensureNode(root, path);
+            break;
+        case Type::DeletePath:
+            memory::eraseNode(root, path);
+            break;
+        case Type::Attribute: {
+            auto name = in.getString();
+            memory::ensureNode(root, path)->attributes.insert_or_assign(
+                std::move(name), Attribute(readAttributeValue(in)));
+            break;
+        }
+        case Type::DeleteAttribute: {
+            auto name = in.getString();
+            if (auto node = memory::findNode(root, path); node)
+            {
+                node->attributes.erase(name);
+            }
+            break;
+        }
+        case Type::Dataset: {
+            auto dtype = in.get<uint32_t>();
+            if (dtype >= static_cast<uint32_t>(Datatype::UNDEFINED))
+            {
+                MetadataReader::corrupt();
+            }
+            memory::Dataset dataset;
+            dataset.dtype = static_cast<Datatype>(dtype);
+            dataset.extent = in.getExtent();
+            auto chunkCount = in.getCount(4 * sizeof(uint64_t));
+            dataset.chunks.reserve(chunkCount);
+            for (size_t c = 0; c < chunkCount; ++c)
+            {
+                memory::Chunk chunk;
+                chunk.offset = in.getExtent();
+                chunk.extent = in.getExtent();
+                auto segment = in.get<uint64_t>();
+                auto byteOffset = in.get<uint64_t>();
+                if (chunk.offset.size() != dataset.extent.size() ||
+                    chunk.extent.size() != dataset.extent.size())
+                {
+                    MetadataReader::corrupt();
+                }
+                if (segment != noDataSegment)
+                {
+                    auto bytes = numberOfBytes(dataset.dtype, chunk.extent);
+                    if (segment >= dataSegments.size() ||
+                        byteOffset > dataSegments[segment]->size() ||
+                        bytes > dataSegments[segment]->size() - byteOffset)
+                    {
+                        MetadataReader::corrupt();
+                    }
+                    chunk.data = std::shared_ptr<void const>(
+                        dataSegments[segment],
+                        static_cast<char const *>(
+                            dataSegments[segment]->data()) +
+                            byteOffset);
+                }
+                dataset.chunks.push_back(std::move(chunk));
+            }
+            memory::ensureNode(root, path)->dataset = std::move(dataset);
+            m_stepDatasets.push_back(std::move(path));
+            break;
+        }
+        default:
+            MetadataReader::corrupt();
+        }
+    }
+    return true;
+}
+
+void SharedMemoryIOHandlerImpl::releaseStep()
+{
+    /*
+     * Like variables in ADIOS2 streams, datasets only carry data in the
+     * step that they were written in. Dropping the chunks unmaps the data
+     * segments unless the user still holds zero-copy views.
+     */
+    auto const &root = m_roots.at(*m_file);
+    for (auto const &path : m_stepDatasets)
+    {
+        if (auto node = memory::findNode(root, path);
+            node && node->dataset.has_value())
+        {
+            node->dataset->chunks.clear();
+        }
+    }
+    m_stepDatasets.clear();
+    m_stream->release();
+}
+
+void SharedMemoryIOHandlerImpl::detach()
+{
+    if (!m_stream)
+    {
+        return;
+    }
+    if (access::write(m_handler->m_backendAccess))
+    {
+        // data written outside of IO steps, deletions need not be sent
+        if (std::any_of(
+                m_changes.begin(),
+                m_changes.end(),
+                [](memory::Change const &c) {
+                    return c.type != memory::Change::Type::DeletePath &&
+                        c.type != memory::Change::Type::DeleteAttribute;
+                }))
+        {
+            publishStep();
+        }
+    }
+    else if (m_readerStatus != ReaderStatus::NoStep)
+    {
+        releaseStep();
+    }
+    m_stream->close();
+    m_stream.reset();
+    m_arena.clear();
+    m_changes.clear();
+    m_recordedChanges.clear();
+    m_stepDatasets.clear();
+    m_readerStatus = ReaderStatus::NoStep;
+    m_file.reset();
+}
+
+SharedMemoryIOHandler::SharedMemoryIOHandler(
+    std::string path,
+    Access at,
+    json::TracingJSON config,
+    std::string originalExtension)
+    : AbstractIOHandler(std::move(path), at)
+    , m_impl{new SharedMemoryIOHandlerImpl(
+          this, std::move(config), std::move(originalExtension))}
+{}
+
+#if openPMD_HAVE_MPI
+namespace
+{
+    // ranks are paired 1:1 between writer and reader
+    std::string rankSuffix(MPI_Comm comm)
+    {
+        int rank = 0;
+        int size = 1;
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_size(comm, &size);
+        return size > 1 ? "-r" + std::to_string(rank) : std::string();
+    }
+} // namespace
+
+SharedMemoryIOHandler::SharedMemoryIOHandler(
+    std::string path,
+    Access at,
+    MPI_Comm comm,
+    json::TracingJSON config,
+    std::string originalExtension)
+    : AbstractIOHandler(std::move(path), at, comm)
+    , m_impl{new SharedMemoryIOHandlerImpl(
+          this,
+          std::move(config),
+          std::move(originalExtension),
+          rankSuffix(comm),
+          /* warnUnusedParameters = */ rankSuffix(comm) != "-r0")}
+{}
+#endif
+
+SharedMemoryIOHandler::~SharedMemoryIOHandler() = default;
+
+std::future<void> SharedMemoryIOHandler::flush(internal::ParsedFlushParams &)
+{
+    return m_impl->flush();
+}
+#else
+
+SharedMemoryIOHandler::SharedMemoryIOHandler(
+    std::string path,
+    Access at,
+    // NOLINTNEXTLINE(performance-unnecessary-value-param)
+    [[maybe_unused]] json::TracingJSON config,
+    // NOLINTNEXTLINE(performance-unnecessary-value-param)
+    [[maybe_unused]] std::string originalExtension)
+    : AbstractIOHandler(std::move(path), at)
+{
+    throw std::runtime_error("openPMD-api built without SHM support");
+}
+
+#if openPMD_HAVE_MPI
+SharedMemoryIOHandler::SharedMemoryIOHandler(
+    std::string path,
+    Access at,
+    MPI_Comm comm,
+    // NOLINTNEXTLINE(performance-unnecessary-value-param)
+    [[maybe_unused]] json::TracingJSON config,
+    // NOLINTNEXTLINE(performance-unnecessary-value-param)
+    [[maybe_unused]] std::string originalExtension)
+    : AbstractIOHandler(std::move(path), at, comm)
+{
+    throw std::runtime_error("openPMD-api built without SHM support");
+}
+#endif
+
+SharedMemoryIOHandler::~SharedMemoryIOHandler() = default;
+
+std::future<void> SharedMemoryIOHandler::flush(internal::ParsedFlushParams &)
+{
+    return std::future<void>();
+}
+#endif
+} // namespace openPMD
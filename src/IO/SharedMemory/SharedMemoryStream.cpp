@@ -0,0 +1,590 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/IO/SharedMemory/SharedMemoryStream.hpp"
+
+#if openPMD_HAVE_SHM
+#include "openPMD/Error.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace openPMD::shm
+{
+namespace
+{
+    constexpr uint32_t controlBlockVersion = 1;
+    // granularity for re-checking the liveness of the other side
+    constexpr std::chrono::milliseconds pollInterval{100};
+
+    [[noreturn]] void throwSystemError(std::string const &what, int error)
+    {
+        throw std::runtime_error(
+            "[SHM] " + what + ": " + std::strerror(error));
+    }
+
+    bool processAlive(pid_t pid)
+    {
+        if (pid <= 0)
+        {
+            return false;
+        }
+        return pid == getpid() || kill(pid, 0) == 0 || errno == EPERM;
+    }
+} // namespace
+
+/*
+ * Lives at the start of the control segment, shared by writer and reader.
+ * The first process to map it initializes the process-shared mutex and
+ * condition variable.
+ */
+struct ControlBlock
+{
+    // 0: uninitialized, 1: being initialized, 2: ready
+    std::atomic<uint32_t> state;
+    uint32_t version;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    // incremented by each writer that attaches, part of all segment names
+    uint64_t session;
+    uint64_t published;
+    uint64_t consumed;
+    uint64_t queueLimit;
+    pid_t writerPid;
+    pid_t readerPid;
+    bool writerClosed;
+    bool readerClosed;
+};
+static_assert(
+    std::atomic<uint32_t>::is_always_lock_free,
+    "Need address-free atomics for process-shared memory.");
+
+namespace
+{
+    /*
+     * Lock on the control block. Recovers the mutex if its previous owner
+     * died while holding it.
+     */
+    class Lock
+    {
+    public:
+        explicit Lock(ControlBlock *control) : m_control(control)
+        {
+            int res = pthread_mutex_lock(&m_control->mutex);
+            if (res == EOWNERDEAD)
+            {
+                pthread_mutex_consistent(&m_control->mutex);
+            }
+            else if (res != 0)
+            {
+                throwSystemError("Cannot lock the stream", res);
+            }
+        }
+        ~Lock()
+        {
+            pthread_mutex_unlock(&m_control->mutex);
+        }
+        Lock(Lock const &) = delete;
+        Lock &operator=(Lock const &) = delete;
+
+        // Wait for a notification, at most for the given duration.
+        void wait(std::chrono::milliseconds duration)
+        {
+            timespec deadline{};
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            auto nanoseconds =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+                    .count();
+            deadline.tv_sec += nanoseconds / 1000000000;
+            deadline.tv_nsec += nanoseconds % 1000000000;
+            if (deadline.tv_nsec >= 1000000000)
+            {
+                deadline.tv_sec += 1;
+                deadline.tv_nsec -= 1000000000;
+            }
+            int res = pthread_cond_timedwait(
+                &m_control->cond, &m_control->mutex, &deadline);
+            if (res == EOWNERDEAD)
+            {
+                pthread_mutex_consistent(&m_control->mutex);
+            }
+        }
+
+        void notify()
+        {
+            pthread_cond_broadcast(&m_control->cond);
+        }
+
+    private:
+        ControlBlock *m_control;
+    };
+} // namespace
+
+Segment::Segment(std::string name, void *data, size_t size)
+    : m_name(std::move(name)), m_data(data), m_size(size)
+{}
+
+Segment::Segment(Segment &&other) noexcept
+    : m_name(std::move(other.m_name))
+    , m_data(std::exchange(other.m_data, nullptr))
+    , m_size(std::exchange(other.m_size, 0))
+{}
+
+Segment &Segment::operator=(Segment &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_data)
+        {
+            munmap(m_data, m_size);
+        }
+        m_name = std::move(other.m_name);
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+Segment::~Segment()
+{
+    if (m_data)
+    {
+        munmap(m_data, m_size);
+    }
+}
+
+Segment Segment::create(std::string name, size_t size)
+{
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 && errno == EEXIST)
+    {
+        // left behind by a process that did not exit cleanly
+        shm_unlink(name.c_str());
+        fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    }
+    if (fd < 0)
+    {
+        throwSystemError("Cannot create shared memory '" + name + "'", errno);
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        int error = errno;
+        close(fd);
+        shm_unlink(name.c_str());
+        throwSystemError("Cannot resize shared memory '" + name + "'", error);
+    }
+    void *data =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int error = errno;
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        shm_unlink(name.c_str());
+        throwSystemError("Cannot map shared memory '" + name + "'", error);
+    }
+    return Segment(std::move(name), data, size);
+}
+
+Segment Segment::open(std::string name, bool writable)
+{
+    int fd = shm_open(name.c_str(), writable ? O_RDWR : O_RDONLY, 0);
+    if (fd < 0)
+    {
+        throw error::ReadError(
+            error::AffectedObject::File,
+            error::Reason::NotFound,
+            "SHM",
+            "Shared memory '" + name + "': " + std::strerror(errno));
+    }
+    struct stat status
+    {};
+    if (fstat(fd, &status) != 0 || status.st_size <= 0)
+    {
+        close(fd);
+        throw error::ReadError(
+            error::AffectedObject::File,
+            error::Reason::CannotRead,
+            "SHM",
+            "Shared memory '" + name + "' is empty or inaccessible.");
+    }
+    auto size = static_cast<size_t>(status.st_size);
+    void *data = mmap(
+        nullptr,
+        size,
+        writable ? PROT_READ | PROT_WRITE : PROT_READ,
+        MAP_SHARED,
+        fd,
+        0);
+    int error = errno;
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throwSystemError("Cannot map shared memory '" + name + "'", error);
+    }
+    return Segment(std::move(name), data, size);
+}
+
+Segment Segment::openOrCreate(std::string name, size_t size)
+{
+    int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        throwSystemError("Cannot open shared memory '" + name + "'", errno);
+    }
+    struct stat status
+    {};
+    // concurrent resizing to the same size does not touch the contents
+    if (fstat(fd, &status) != 0 ||
+        (static_cast<size_t>(status.st_size) < size &&
+         ftruncate(fd, static_cast<off_t>(size)) != 0))
+    {
+        int error = errno;
+        close(fd);
+        throwSystemError("Cannot resize shared memory '" + name + "'", error);
+    }
+    void *data =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int error = errno;
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throwSystemError("Cannot map shared memory '" + name + "'", error);
+    }
+    return Segment(std::move(name), data, size);
+}
+
+bool Segment::unlink(std::string const &name)
+{
+    return shm_unlink(name.c_str()) == 0;
+}
+
+Stream::Stream(std::string name, Role role, Options options)
+    : m_name(std::move(name)), m_role(role), m_options(options)
+{
+    m_controlSegment = Segment::openOrCreate(m_name, sizeof(ControlBlock));
+    m_control = static_cast<ControlBlock *>(m_controlSegment->data());
+
+    uint32_t expected = 0;
+    if (m_control->state.compare_exchange_strong(expected, 1))
+    {
+        pthread_mutexattr_t mutexAttributes;
+        pthread_mutexattr_init(&mutexAttributes);
+        pthread_mutexattr_setpshared(&mutexAttributes, PTHREAD_PROCESS_SHARED);
+        pthread_mutexattr_setrobust(&mutexAttributes, PTHREAD_MUTEX_ROBUST);
+        pthread_mutex_init(&m_control->mutex, &mutexAttributes);
+        pthread_mutexattr_destroy(&mutexAttributes);
+
+        pthread_condattr_t condAttributes;
+        pthread_condattr_init(&condAttributes);
+        pthread_condattr_setpshared(&condAttributes, PTHREAD_PROCESS_SHARED);
+        pthread_condattr_setclock(&condAttributes, CLOCK_MONOTONIC);
+        pthread_cond_init(&m_control->cond, &condAttributes);
+        pthread_condattr_destroy(&condAttributes);
+
+        m_control->version = controlBlockVersion;
+        m_control->state.store(2);
+    }
+    else
+    {
+        auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (m_control->state.load() != 2)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                throw error::ReadError(
+                    error::AffectedObject::File,
+                    error::Reason::Inaccessible,
+                    "SHM",
+                    "Stream '" + m_name +
+                        "' was never initialized. If a previous process "
+                        "crashed, remove it from /dev/shm.");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if (m_control->version != controlBlockVersion)
+    {
+        throw error::ReadError(
+            error::AffectedObject::File,
+            error::Reason::UnexpectedContent,
+            "SHM",
+            "Stream '" + m_name +
+                "' was created by an incompatible version of openPMD-api.");
+    }
+
+    Lock lock(m_control);
+    auto &c = *m_control;
+    switch (m_role)
+    {
+    case Role::Writer: {
+        if (c.writerPid != 0 && !c.writerClosed && processAlive(c.writerPid))
+        {
+            throw error::WrongAPIUsage(
+                "[SHM] Another writer is attached to stream '" + m_name +
+                "'.");
+        }
+        bool readerAttached = c.readerPid != 0 && !c.readerClosed &&
+            processAlive(c.readerPid);
+        if (readerAttached && c.consumed < c.published)
+        {
+            throw error::WrongAPIUsage(
+                "[SHM] A reader is still consuming the previous run of "
+                "stream '" +
+                m_name + "'.");
+        }
+        if (!readerAttached)
+        {
+            // clean up after a previous run that nobody read to the end
+            for (auto step = c.consumed; step < c.published; ++step)
+            {
+                discardStep(c.session, step);
+            }
+            c.readerPid = 0;
+            c.readerClosed = false;
+        }
+        m_session = ++c.session;
+        c.published = 0;
+        c.consumed = 0;
+        c.queueLimit = m_options.queueLimit;
+        c.writerPid = getpid();
+        c.writerClosed = false;
+        lock.notify();
+        break;
+    }
+    case Role::Reader: {
+        if (c.readerPid != 0 && !c.readerClosed && processAlive(c.readerPid))
+        {
+            throw error::WrongAPIUsage(
+                "[SHM] Another reader is attached to stream '" + m_name +
+                "'.");
+        }
+        c.readerPid = getpid();
+        c.readerClosed = false;
+        lock.notify();
+        auto deadline =
+            std::chrono::steady_clock::now() + m_options.openTimeout;
+        while (true)
+        {
+            bool writerAttached = c.writerPid != 0 && !c.writerClosed &&
+                processAlive(c.writerPid);
+            bool stepsLeft = c.writerPid != 0 && c.consumed < c.published;
+            if (writerAttached || stepsLeft)
+            {
+                m_session = c.session;
+                break;
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline)
+            {
+                c.readerPid = 0;
+                Segment::unlink(m_name);
+                throw error::ReadError(
+                    error::AffectedObject::File,
+                    error::Reason::NotFound,
+                    "SHM",
+                    "No writer showed up on stream '" + m_name + "'.");
+            }
+            lock.wait(std::min(
+                pollInterval,
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - now) +
+                    std::chrono::milliseconds(1)));
+        }
+        break;
+    }
+    }
+}
+
+Stream::~Stream()
+{
+    try
+    {
+        close();
+    }
+    catch (std::exception const &ex)
+    {
+        std::cerr << "[~Stream] An error occurred while closing stream '"
+                  << m_name << "': " << ex.what() << std::endl;
+    }
+}
+
+std::string Stream::stepSegmentName(
+    uint64_t step, std::optional<uint64_t> dataSegment) const
+{
+    return segmentName(m_session, step, dataSegment);
+}
+
+std::string Stream::segmentName(
+    uint64_t session, uint64_t step, std::optional<uint64_t> dataSegment) const
+{
+    auto res = m_name + "-" + std::to_string(session) + "-" +
+        std::to_string(step);
+    if (dataSegment.has_value())
+    {
+        res += "-d" + std::to_string(*dataSegment);
+    }
+    return res;
+}
+
+uint64_t Stream::nextStep() const
+{
+    // only the writer modifies this counter
+    return m_control->published;
+}
+
+bool Stream::publish()
+{
+    Lock lock(m_control);
+    auto &c = *m_control;
+    auto readerGone = [this, &c]() {
+        return c.readerClosed ||
+            (c.readerPid == 0 ? m_attachTimedOut
+                              : !processAlive(c.readerPid));
+    };
+    auto deadline = std::chrono::steady_clock::now() + m_options.openTimeout;
+    while (c.queueLimit != 0 && c.published - c.consumed >= c.queueLimit &&
+           !readerGone())
+    {
+        // a reader that never attaches would block the writer forever
+        if (c.readerPid == 0 && std::chrono::steady_clock::now() >= deadline)
+        {
+            m_attachTimedOut = true;
+            break;
+        }
+        lock.wait(pollInterval);
+    }
+    if (readerGone())
+    {
+        discardStep(m_session, c.published);
+        return false;
+    }
+    ++c.published;
+    lock.notify();
+    return true;
+}
+
+std::optional<uint64_t> Stream::acquire()
+{
+    Lock lock(m_control);
+    auto &c = *m_control;
+    while (true)
+    {
+        if (c.session != m_session)
+        {
+            // a new writer has taken over, our run is over
+            return std::nullopt;
+        }
+        if (c.consumed < c.published)
+        {
+            return c.consumed;
+        }
+        if (c.writerClosed || !processAlive(c.writerPid))
+        {
+            return std::nullopt;
+        }
+        lock.wait(pollInterval);
+    }
+}
+
+void Stream::release()
+{
+    Lock lock(m_control);
+    ++m_control->consumed;
+    lock.notify();
+}
+
+void Stream::close()
+{
+    if (!m_control)
+    {
+        return;
+    }
+    {
+        Lock lock(m_control);
+        auto &c = *m_control;
+        bool last = false;
+        switch (m_role)
+        {
+        case Role::Writer: {
+            c.writerClosed = true;
+            bool readerAttached = c.readerPid != 0 && !c.readerClosed &&
+                processAlive(c.readerPid);
+            bool stepsLeft = c.consumed < c.published;
+            /*
+             * Without any reader so far, leave published steps for a reader
+             * that attaches later on.
+             */
+            last = !readerAttached && (c.readerPid != 0 || !stepsLeft);
+            if (last)
+            {
+                for (auto step = c.consumed; step < c.published; ++step)
+                {
+                    discardStep(m_session, step);
+                }
+            }
+            break;
+        }
+        case Role::Reader:
+            c.readerClosed = true;
+            if (c.session == m_session)
+            {
+                for (auto step = c.consumed; step < c.published; ++step)
+                {
+                    discardStep(m_session, step);
+                }
+                c.consumed = c.published;
+            }
+            last = c.writerClosed || !processAlive(c.writerPid);
+            break;
+        }
+        lock.notify();
+        if (last)
+        {
+            Segment::unlink(m_name);
+        }
+    }
+    m_control = nullptr;
+    m_controlSegment.reset();
+}
+
+void Stream::discardStep(uint64_t session, uint64_t step) const
+{
+    Segment::unlink(segmentName(session, step, std::nullopt));
+    for (uint64_t k = 0; Segment::unlink(segmentName(session, step, k)); ++k)
+    {
+    }
+}
+} // namespace openPMD::shm
+#endif
@@ -191,6 +191,8 @@ SeriesIterator::SeriesIterator(
             {
                 data.iterationsInCurrentStep.push_back(pair.first);
             }
+            data.currentIteration = it->first;
+            prefetchUpcomingIterations();
             break;
         case IterationEncoding::groupBased:
         case IterationEncoding::variableBased: {
@@ -319,6 +321,7 @@ std::optional<SeriesIterator *> SeriesIterator::nextIterationInStep()
                       << err.what() << std::endl;
             return nextIterationInStep();
         }
+        prefetchUpcomingIterations();
 
         return {this};
     }
@@ -547,6 +550,52 @@ void SeriesIterator::deactivateDeadIteration(iteration_index_t index)
     data.series->iterations.container().erase(index);
 }
 
+void SeriesIterator::prefetchUpcomingIterations()
+{
+    auto &data = get();
+    auto &series = data.series.value();
+    auto depth = series.get().m_prefetchIterations;
+    if (depth == 0 ||
+        series.iterationEncoding() != IterationEncoding::fileBased)
+    {
+        return;
+    }
+    auto it = series.iterations.find(data.currentIteration);
+    auto end = series.iterations.end();
+    if (it == end)
+    {
+        return;
+    }
+    ++it;
+    bool enqueued = false;
+    for (unsigned int i = 0; i < depth && it != end; ++i, ++it)
+    {
+        if (data.lastPrefetchedIteration.has_value() &&
+            it->first <= *data.lastPrefetchedIteration)
+        {
+            continue;
+        }
+        data.lastPrefetchedIteration = it->first;
+        /*
+         * Iterations that have already been parsed do not need their files
+         * to be loaded again.
+         */
+        if (it->second.get().m_closed !=
+            internal::CloseStatus::ParseAccessDeferred)
+        {
+            continue;
+        }
+        Parameter<Operation::PREFETCH_FILE> prefetch;
+        prefetch.name = series.iterationFilename(it->first);
+        series.IOHandler()->enqueue(IOTask(&series, std::move(prefetch)));
+        enqueued = true;
+    }
+    if (enqueued)
+    {
+        series.IOHandler()->flush(internal::defaultFlushParams);
+    }
+}
+
 SeriesIterator &SeriesIterator::operator++()
 {
     auto &data = get();
@@ -24,19 +24,241 @@
 #include "openPMD/Error.hpp"
 #include "openPMD/IO/Format.hpp"
 #include "openPMD/Series.hpp"
+#include "openPMD/auxiliary/Environment.hpp"
+#include "openPMD/auxiliary/JSON_internal.hpp"
 #include "openPMD/auxiliary/Memory.hpp"
 #include "openPMD/backend/Attributable.hpp"
 #include "openPMD/backend/BaseRecord.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
 #include <complex>
+#include <deque>
+#include <functional>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
+#include <variant>
 
 namespace openPMD
 {
+namespace
+{
+    /*
+     * Selections of the chunks that are queued for writing, to be passed to
+     * CREATE_DATASET as a hint for the decomposition among writers.
+     */
+    std::vector<ChunkInfo> queuedWriteChunks(std::deque<IOTask> const &chunks)
+    {
+        std::vector<ChunkInfo> res;
+        for (auto const &task : chunks)
+        {
+            if (task.operation != Operation::WRITE_DATASET)
+            {
+                continue;
+            }
+            auto const &parameter =
+                static_cast<Parameter<Operation::WRITE_DATASET> const &>(
+                    *task.parameter);
+            res.emplace_back(parameter.offset, parameter.extent);
+        }
+        return res;
+    }
+
+    /*
+     * Count the payload of a chunk as pending until the last reference that
+     * openPMD holds to its buffer is released,
+     * see AbstractIOHandler::m_pendingWriteBytes.
+     */
+    auxiliary::WriteBuffer trackPendingWrite(
+        auxiliary::WriteBuffer buffer,
+        std::shared_ptr<std::atomic<std::size_t>> counter,
+        std::size_t bytes)
+    {
+        if (bytes == 0 || !buffer.get())
+        {
+            return buffer;
+        }
+        *counter += bytes;
+        auto release = [counter = std::move(counter), bytes]() {
+            *counter -= bytes;
+        };
+        return std::visit(
+            [&release](auto &ptr) -> auxiliary::WriteBuffer {
+                using ptr_t = std::remove_reference_t<decltype(ptr)>;
+                if constexpr (std::is_same_v<
+                                  ptr_t,
+                                  std::shared_ptr<void const>>)
+                {
+                    void const *raw = ptr.get();
+                    return auxiliary::WriteBuffer{std::shared_ptr<void const>(
+                        raw,
+                        [owner = std::move(ptr),
+                         release = std::move(release)](void const *) mutable {
+                            owner.reset();
+                            release();
+                        })};
+                }
+                else
+                {
+                    std::function<void(void *)> deleter =
+                        std::move(ptr.get_deleter());
+                    void *raw = ptr.release();
+                    return auxiliary::WriteBuffer{UniquePtrWithLambda<void>(
+                        raw,
+                        [deleter = std::move(deleter),
+                         release = std::move(release)](void *p) {
+                            deleter(p);
+                            release();
+                        })};
+                }
+            },
+            buffer.m_buffer);
+    }
+
+    /*
+     * Size of the numeric components that the codec advisor samples,
+     * zero for datatypes that it does not handle.
+     */
+    std::size_t codecComponentSize(Datatype dtype)
+    {
+        if (dtype == Datatype::LONG_DOUBLE || dtype == Datatype::CLONG_DOUBLE)
+        {
+            return 0;
+        }
+        if (isComplexFloatingPoint(dtype))
+        {
+            return toBytes(dtype) / 2;
+        }
+        if (isFloatingPoint(dtype) || std::get<0>(isInteger(dtype)))
+        {
+            return toBytes(dtype);
+        }
+        return 0;
+    }
+
+    /*
+     * Path of a record component below its iteration, e.g. "meshes/E/x",
+     * so that the decisions of the codec advisor carry over to later
+     * iterations.
+     */
+    std::string codecDecisionKey(std::vector<std::string> const &group)
+    {
+        auto begin = group.begin();
+        if (group.size() > 2 && group.front() == "iterations")
+        {
+            begin += 2;
+        }
+        std::string res;
+        for (auto it = begin; it != group.end(); ++it)
+        {
+            if (!res.empty())
+            {
+                res += '/';
+            }
+            res += *it;
+        }
+        return res;
+    }
+
+    /*
+     * Resolve the dataset option "codec": "auto", or fill in a codec for
+     * datasets without one if the Series option codec_advisor is set.
+     * The advisor samples the first chunk queued for writing, its decision
+     * is remembered for the same record component in later iterations.
+     */
+    void adviseCodec(
+        Parameter<Operation::CREATE_DATASET> &dCreate,
+        std::deque<IOTask> const &chunks,
+        internal::SeriesData &series,
+        std::string const &key)
+    {
+        auto parsed = dCreate.getParsedOptions();
+        auto it = parsed->config.find("codec");
+        bool requested = false;
+        if (it != parsed->config.end())
+        {
+            auto codecName = json::asLowerCaseStringDynamic(*it);
+            if (!codecName.has_value() || *codecName != "auto")
+            {
+                return;
+            }
+            requested = true;
+        }
+        else if (!series.m_codecAdvisor.has_value())
+        {
+            return;
+        }
+
+        std::string decision = "none";
+        if (auto known = series.m_codecDecisions.find(key);
+            known != series.m_codecDecisions.end())
+        {
+            decision = known->second;
+        }
+        else
+        {
+            void const *data = nullptr;
+            std::size_t numBytes = 0;
+            for (auto const &task : chunks)
+            {
+                if (task.operation != Operation::WRITE_DATASET)
+                {
+                    continue;
+                }
+                auto const &parameter =
+                    static_cast<Parameter<Operation::WRITE_DATASET> const &>(
+                        *task.parameter);
+                if (parameter.dtype != dCreate.dtype ||
+                    parameter.data.get() == nullptr)
+                {
+                    continue;
+                }
+                data = parameter.data.get();
+                numBytes = toBytes(parameter.dtype);
+                for (auto ext : parameter.extent)
+                {
+                    numBytes *= ext;
+                }
+                break;
+            }
+            auto componentSize = codecComponentSize(dCreate.dtype);
+            if (componentSize == 0 || data == nullptr)
+            {
+                // Nothing to judge by, try again in the next iteration.
+                if (!requested)
+                {
+                    return;
+                }
+            }
+            else
+            {
+                auto decided =
+                    series.m_codecAdvisor.value_or(auxiliary::CodecAdvisor{})
+                        .advise(data, numBytes / componentSize, componentSize);
+                if (decided.codec.has_value())
+                {
+                    decision = decided.codec->toString();
+                }
+                series.m_codecDecisions.emplace(key, decision);
+                if (auxiliary::getEnvNum("OPENPMD_VERBOSE", 0) != 0)
+                {
+                    std::cerr << "[codec advisor] " << key << ": "
+                              << decided.toString() << std::endl;
+                }
+            }
+        }
+
+        json::ParsedConfig advised = *parsed;
+        advised.config["codec"] = decision;
+        dCreate.options = advised.config.dump();
+        dCreate.parsedOptions =
+            std::make_shared<json::ParsedConfig const>(std::move(advised));
+    }
+} // namespace
+
 namespace internal
 {
     RecordComponentData::RecordComponentData() = default;
@@ -53,7 +275,7 @@ namespace internal
         }
 #endif
         a.setDirtyRecursive(true);
-        m_chunks.push(std::move(task));
+        m_chunks.push_back(std::move(task));
     }
 } // namespace internal
 
@@ -245,7 +467,7 @@ void RecordComponent::flush(
         while (!rc.m_chunks.empty())
         {
             IOHandler()->enqueue(rc.m_chunks.front());
-            rc.m_chunks.pop();
+            rc.m_chunks.pop_front();
         }
     }
     else
@@ -313,6 +535,14 @@ void RecordComponent::flush(
                 dCreate.dtype = getDatatype();
                 dCreate.options = rc.m_dataset.value().options;
                 dCreate.joinedDimension = joinedDimension();
+                dCreate.parsedOptions =
+                    json::parseOptionsCached(dCreate.options);
+                dCreate.initialChunks = queuedWriteChunks(rc.m_chunks);
+                adviseCodec(
+                    dCreate,
+                    rc.m_chunks,
+                    retrieveSeries().get(),
+                    codecDecisionKey(myPath().group));
                 IOHandler()->enqueue(IOTask(this, dCreate));
             }
         }
@@ -347,7 +577,7 @@ void RecordComponent::flush(
         while (!rc.m_chunks.empty())
         {
             IOHandler()->enqueue(rc.m_chunks.front());
-            rc.m_chunks.pop();
+            rc.m_chunks.pop_front();
         }
 
         flushAttributes(flushParams);
@@ -464,14 +694,34 @@ void RecordComponent::storeChunk(
 {
     verifyChunk(dtype, o, e);
 
+    auto &handler = *IOHandler();
+    // buffers released since the last flush lower the baseline as well
+    handler.m_pendingWriteBytesAfterFlush = std::min(
+        handler.m_pendingWriteBytesAfterFlush,
+        handler.m_pendingWriteBytes->load());
+    std::size_t bytes = toBytes(dtype);
+    for (auto ext : e)
+    {
+        bytes *= ext;
+    }
+
     Parameter<Operation::WRITE_DATASET> dWrite;
     dWrite.offset = std::move(o);
     dWrite.extent = std::move(e);
     dWrite.dtype = dtype;
     /* std::static_pointer_cast correctly reference-counts the pointer */
-    dWrite.data = std::move(buffer);
+    dWrite.data = trackPendingWrite(
+        std::move(buffer), handler.m_pendingWriteBytes, bytes);
     auto &rc = get();
     rc.push_chunk(IOTask(this, std::move(dWrite)));
+
+    if (handler.m_writeBufferBudget != 0 && !handler.m_spansSinceFlush &&
+        handler.m_pendingWriteBytes->load() >
+            handler.m_pendingWriteBytesAfterFlush +
+                handler.m_writeBufferBudget)
+    {
+        seriesFlush();
+    }
 }
 
 void RecordComponent::verifyChunk(
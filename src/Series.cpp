@@ -118,6 +118,18 @@ namespace
         int padding,
         std::string const &postfix,
         std::optional<std::string> const &extension);
+
+    /*
+     * After the IO handler has been flushed, the write buffer budget starts
+     * over from the bytes that are still pending, and spans handed out by
+     * storeChunk() are no longer valid.
+     */
+    void restartWriteBufferBudget(AbstractIOHandler &handler)
+    {
+        handler.m_pendingWriteBytesAfterFlush =
+            handler.m_pendingWriteBytes->load();
+        handler.m_spansSinceFlush = false;
+    }
 } // namespace
 
 struct Series::ParsedInput
@@ -688,6 +700,11 @@ std::string Series::backend()
     return IOHandler()->backendName();
 }
 
+std::size_t Series::pendingWriteBytes() const
+{
+    return IOHandler()->m_pendingWriteBytes->load();
+}
+
 void Series::flush(std::string backendConfig)
 {
     auto &series = get();
@@ -807,13 +824,13 @@ namespace
     template <typename MappingFunction>
     int autoDetectPadding(
         std::function<Match(std::string const &)> const &isPartOfSeries,
-        std::string const &directory,
+        std::optional<std::vector<std::string>> const &directoryEntries,
         MappingFunction &&mappingFunction)
     {
         std::set<int> paddings;
-        if (auxiliary::directory_exists(directory))
+        if (directoryEntries.has_value())
         {
-            for (auto const &entry : auxiliary::list_directory(directory))
+            for (auto const &entry : *directoryEntries)
             {
                 Match match = isPartOfSeries(entry);
                 if (match.isContained)
@@ -833,9 +850,10 @@ namespace
 
     int autoDetectPadding(
         std::function<Match(std::string const &)> const &isPartOfSeries,
-        std::string const &directory)
+        std::optional<std::vector<std::string>> const &directoryEntries)
     {
-        return autoDetectPadding(isPartOfSeries, directory, [](auto &&...) {});
+        return autoDetectPadding(
+            isPartOfSeries, directoryEntries, [](auto &&...) {});
     }
 } // namespace
 
@@ -981,7 +999,9 @@ auto Series::initIOHandler(
         std::set<std::string> additional_extensions;
         autoDetectPadding(
             isPartOfSeries,
-            input->path,
+            auxiliary::directory_exists(input->path)
+                ? std::make_optional(auxiliary::list_directory(input->path))
+                : std::nullopt,
             [&extension,
              &additional_extensions](std::string const &, Match const &match) {
                 auto const &ext = match.extension.value();
@@ -1094,6 +1114,56 @@ void Series::initSeries(
     series.iterations.writable().ownKeyWithinParent = "iterations";
     series.m_rankTable.m_attributable.linkHierarchy(writable);
 
+    /*
+     * Closing files in the background needs closing to be a local
+     * operation, which rules out backends with collective operations or
+     * engine-internal threading.
+     */
+    {
+        auto &handler = *writable.IOHandler->value();
+        auto backend = handler.backendName();
+        bool supportsBackgroundClose = backend == "HDF5" || backend == "JSON";
+#if openPMD_HAVE_MPI
+        supportsBackgroundClose =
+            supportsBackgroundClose && !series.m_communicator.has_value();
+#endif
+        handler.m_filesInFlight =
+            supportsBackgroundClose ? series.m_filesInFlight : 0;
+#if openPMD_HAVE_MPI
+        /*
+         * Collective metadata parsing needs all ranks to read the same
+         * metadata in lockstep, so it is restricted to read-only access.
+         */
+        if (series.m_collectiveMetadata && series.m_communicator.has_value() &&
+            access::readOnly(handler.m_frontendAccess) &&
+            (backend == "HDF5" || backend == "JSON"))
+        {
+            handler.m_metadataCommunicator = *series.m_communicator;
+        }
+#endif
+    }
+
+    writable.IOHandler->value()->m_writeBufferBudget =
+        series.m_writeBufferBudget;
+#if openPMD_HAVE_MPI
+    /*
+     * The budget triggers flushes on each rank independently, which would
+     * deadlock backends whose flushes are collective (e.g. parallel HDF5).
+     */
+    if (series.m_writeBufferBudget != 0 && series.m_communicator.has_value())
+    {
+        writable.IOHandler->value()->m_writeBufferBudget = 0;
+        int rank = 0;
+        MPI_Comm_rank(*series.m_communicator, &rank);
+        if (rank == 0)
+        {
+            std::cerr << "[Series] Ignoring the option write_buffer_budget in "
+                         "an MPI-parallel Series, flush explicitly instead."
+                      << std::endl;
+        }
+    }
+#endif
+
     series.m_name = input->name;
 
     series.m_format = input->format;
@@ -1184,7 +1254,7 @@ Given file pattern: ')END"
                  * In that case, this will just not find anything.
                  */
                 series.m_filenameExtension),
-            IOHandler()->directory);
+            IOHandler()->listDirectory(IOHandler()->directory));
         switch (padding)
         {
         case -2:
@@ -1264,8 +1334,11 @@ std::future<void> Series::flush_impl(
         }
         if (flushIOHandler)
         {
-            IOHandler()->m_lastFlushSuccessful = true;
-            return IOHandler()->flush(flushParams);
+            auto handler = IOHandler();
+            handler->m_lastFlushSuccessful = true;
+            auto res = handler->flush(flushParams);
+            restartWriteBufferBudget(*handler);
+            return res;
         }
         else
         {
@@ -1563,7 +1636,8 @@ void Series::readFileBased()
     // set after reading the iteration encoding attribute from the opened file.
     IOHandler()->setIterationEncoding(IterationEncoding::fileBased);
 
-    if (!auxiliary::directory_exists(IOHandler()->directory))
+    auto directoryEntries = IOHandler()->listDirectory(IOHandler()->directory);
+    if (!directoryEntries.has_value())
         throw error::ReadError(
             error::AffectedObject::File,
             error::Reason::Inaccessible,
@@ -1578,7 +1652,7 @@ void Series::readFileBased()
 
     int padding = autoDetectPadding(
         isPartOfSeries,
-        IOHandler()->directory,
+        directoryEntries,
         // foreach found file with `filename` and `index`:
         [&series](std::string const &filename, Match const &match) {
             auto index = match.iteration;
@@ -2457,6 +2531,7 @@ AdvanceStatus Series::advance(
     // from calling flush(Group|File)based, but has not been emptied yet
     // Do that manually
     IOHandler()->flush(flushParams);
+    restartWriteBufferBudget(*IOHandler());
 
     return *param.status;
 }
@@ -2523,6 +2598,7 @@ AdvanceStatus Series::advance(AdvanceMode mode)
     // from calling flush(Group|File)based, but has not been emptied yet
     // Do that manually
     IOHandler()->flush(flushParams);
+    restartWriteBufferBudget(*IOHandler());
 
     return *param.status;
 }
@@ -2734,6 +2810,79 @@ namespace
             return false;
         }
     }
+
+    /*
+     * Series option codec_advisor: either a boolean or an object with the
+     * optional keys objective, sample_size, min_ratio and candidates.
+     */
+    std::optional<auxiliary::CodecAdvisor>
+    parseCodecAdvisor(json::TracingJSON config)
+    {
+        auto const &value = config.json();
+        if (value.is_boolean())
+        {
+            return value.get<bool>() ? std::make_optional<
+                                           auxiliary::CodecAdvisor>()
+                                     : std::nullopt;
+        }
+        if (!value.is_object())
+        {
+            throw error::BackendConfigSchema(
+                {"codec_advisor"}, "Must be a boolean or an object.");
+        }
+        auxiliary::CodecAdvisor res;
+        std::string objective;
+        if (getJsonOptionLowerCase(config, "objective", objective))
+        {
+            if (objective == "balanced")
+            {
+                res.objective = auxiliary::CodecAdvisor::Objective::Balanced;
+            }
+            else if (objective == "ratio")
+            {
+                res.objective = auxiliary::CodecAdvisor::Objective::Ratio;
+            }
+            else
+            {
+                throw error::BackendConfigSchema(
+                    {"codec_advisor", "objective"},
+                    R"(Must be "balanced" or "ratio".)");
+            }
+        }
+        getJsonOption<std::size_t>(config, "sample_size", res.sampleBytes);
+        getJsonOption<double>(config, "min_ratio", res.minRatio);
+        if (value.contains("candidates"))
+        {
+            auto const &candidates = config["candidates"].json();
+            if (!candidates.is_array())
+            {
+                throw error::BackendConfigSchema(
+                    {"codec_advisor", "candidates"},
+                    "Must be an array of codec names.");
+            }
+            res.candidates.clear();
+            for (auto const &candidate : candidates)
+            {
+                std::optional<auxiliary::Codec> codec;
+                if (auto codecName = json::asLowerCaseStringDynamic(candidate);
+                    codecName.has_value())
+                {
+                    codec = auxiliary::Codec::fromString(*codecName);
+                }
+                if (!codec.has_value())
+                {
+                    throw error::BackendConfigSchema(
+                        {"codec_advisor", "candidates"},
+                        "Unknown codec: '" + candidate.dump() + "'.");
+                }
+                if (!codec->isIdentity())
+                {
+                    res.candidates.push_back(*codec);
+                }
+            }
+        }
+        return res;
+    }
 } // namespace
 
 template <typename TracingJSON>
@@ -2742,6 +2891,18 @@ void Series::parseJsonOptions(TracingJSON &options, ParsedInput &input)
     auto &series = get();
     getJsonOption<bool>(
         options, "defer_iteration_parsing", series.m_parseLazily);
+    getJsonOption<unsigned int>(
+        options, "prefetch_iterations", series.m_prefetchIterations);
+    getJsonOption<bool>(
+        options, "collective_metadata", series.m_collectiveMetadata);
+    getJsonOption<std::size_t>(
+        options, "write_buffer_budget", series.m_writeBufferBudget);
+    getJsonOption<unsigned int>(
+        options, "files_in_flight", series.m_filesInFlight);
+    if (options.json().contains("codec_advisor"))
+    {
+        series.m_codecAdvisor = parseCodecAdvisor(options["codec_advisor"]);
+    }
     internal::SeriesData::SourceSpecifiedViaJSON rankTableSource;
     if (getJsonOptionLowerCase(options, "rank_table", rankTableSource.value))
     {
@@ -2753,7 +2914,9 @@ void Series::parseJsonOptions(TracingJSON &options, ParsedInput &input)
             {"hdf5", Format::HDF5},
             {"adios2", Format::ADIOS2_BP},
             {"json", Format::JSON},
-            {"toml", Format::TOML}};
+            {"toml", Format::TOML},
+            {"shm", Format::SHM},
+            {"memory", Format::MEMORY}};
         std::string backend;
         getJsonOptionLowerCase(options, "backend", backend);
         if (!backend.empty())
@@ -2933,6 +3096,225 @@ void Series::parseBase()
     readIterations();
 }
 
+std::vector<RecordComponent> Series::timeSeriesComponents(
+    std::string const &recordComponent,
+    std::vector<IterationIndex_t> &iterationIndices)
+{
+    if (IOHandler()->m_frontendAccess != Access::READ_RANDOM_ACCESS)
+    {
+        throw error::WrongAPIUsage(
+            "[Series::loadTimeSeries] Only available in access mode "
+            "READ_RANDOM_ACCESS.");
+    }
+    auto const path = auxiliary::split(recordComponent, "/");
+    bool const isMesh = !path.empty() && path[0] == "meshes";
+    bool const isParticles = !path.empty() && path[0] == "particles";
+    if (!(isMesh && (path.size() == 2 || path.size() == 3)) &&
+        !(isParticles && (path.size() == 3 || path.size() == 4)))
+    {
+        throw error::WrongAPIUsage(
+            "[Series::loadTimeSeries] Expected a path of the form "
+            "'meshes/<mesh>[/<component>]' or "
+            "'particles/<species>/<record>[/<component>]', got '" +
+            recordComponent + "'.");
+    }
+    // mesh/species, record, component
+    size_t const numRecordLevels = isMesh ? 1 : 2;
+
+    if (iterationIndices.empty())
+    {
+        for (auto const &pair : iterations)
+        {
+            iterationIndices.push_back(pair.first);
+        }
+    }
+
+    auto notFound = [&recordComponent](IterationIndex_t index) {
+        return error::ReadError(
+            error::AffectedObject::Dataset,
+            error::Reason::NotFound,
+            {},
+            "[Series::loadTimeSeries] No record component '" +
+                recordComponent + "' in iteration " + std::to_string(index) +
+                ".");
+    };
+    auto componentOf = [&](auto &record, IterationIndex_t index) {
+        auto const &key = path.size() > numRecordLevels + 1
+            ? path.back()
+            : RecordComponent::SCALAR;
+        if (!record.contains(key))
+        {
+            throw notFound(index);
+        }
+        return RecordComponent(record.at(key));
+    };
+
+    /*
+     * Record components of iterations whose parsing is deferred are opened
+     * by their path, relative to the /data group. This bypasses the
+     * frontend hierarchy, so the rest of the iteration need not be parsed.
+     * The opens of all iterations are batched into two flushes.
+     */
+    struct OpenByPath
+    {
+        std::string groupPath;
+        Attributable group;
+        Parameter<Operation::LIST_DATASETS> dList;
+        RecordComponent rc;
+        Parameter<Operation::OPEN_DATASET> dOpen;
+        bool isDataset = false;
+    };
+    std::vector<OpenByPath> openedByPath;
+    // per requested iteration, the component or its index in openedByPath
+    std::vector<std::variant<RecordComponent, size_t>> components;
+    components.reserve(iterationIndices.size());
+    for (auto index : iterationIndices)
+    {
+        if (!iterations.contains(index))
+        {
+            throw error::WrongAPIUsage(
+                "[Series::loadTimeSeries] No iteration " +
+                std::to_string(index) + " in Series.");
+        }
+        Iteration &iteration = iterations.at(index);
+        auto &iterationData = iteration.get();
+        bool const deferred = iterationData.m_closed ==
+            internal::CloseStatus::ParseAccessDeferred;
+        if (deferred && iterationData.m_deferredParseAccess.has_value() &&
+            !iterationData.m_deferredParseAccess->fileBased &&
+            iterationEncoding() == IterationEncoding::groupBased)
+        {
+            OpenByPath toOpen;
+            toOpen.groupPath = iterationData.m_deferredParseAccess->path;
+            for (auto const &segment : auxiliary::split(
+                     isMesh ? meshesPath() : particlesPath(), "/"))
+            {
+                toOpen.groupPath += '/' + segment;
+            }
+            for (size_t i = 1; i + 1 < path.size(); ++i)
+            {
+                toOpen.groupPath += '/' + path[i];
+            }
+            components.emplace_back(openedByPath.size());
+            openedByPath.push_back(std::move(toOpen));
+            continue;
+        }
+
+        if (deferred || iteration.closed())
+        {
+            iteration.open();
+        }
+        if (isMesh)
+        {
+            if (!iteration.meshes.contains(path[1]))
+            {
+                throw notFound(index);
+            }
+            components.emplace_back(
+                componentOf(iteration.meshes.at(path[1]), index));
+        }
+        else
+        {
+            if (!iteration.particles.contains(path[1]) ||
+                !iteration.particles.at(path[1]).contains(path[2]))
+            {
+                throw notFound(index);
+            }
+            components.emplace_back(componentOf(
+                iteration.particles.at(path[1]).at(path[2]), index));
+        }
+    }
+
+    if (!openedByPath.empty())
+    {
+        internal::withRWAccess(IOHandler()->m_seriesStatus, [&]() {
+            for (auto &toOpen : openedByPath)
+            {
+                toOpen.group.linkHierarchy(iterations.writable());
+                Parameter<Operation::OPEN_PATH> pOpen;
+                pOpen.path = toOpen.groupPath;
+                IOHandler()->enqueue(IOTask(&toOpen.group, pOpen));
+                IOHandler()->enqueue(IOTask(&toOpen.group, toOpen.dList));
+            }
+            IOHandler()->flush(internal::defaultFlushParams);
+
+            for (auto &toOpen : openedByPath)
+            {
+                std::string const componentPath =
+                    toOpen.groupPath + '/' + path.back();
+                toOpen.rc.linkHierarchy(iterations.writable());
+                auto const &datasets = *toOpen.dList.datasets;
+                toOpen.isDataset =
+                    std::find(datasets.begin(), datasets.end(), path.back()) !=
+                    datasets.end();
+                if (toOpen.isDataset)
+                {
+                    toOpen.dOpen.name = componentPath;
+                    IOHandler()->enqueue(IOTask(&toOpen.rc, toOpen.dOpen));
+                }
+                else
+                {
+                    // constant record components are groups with attributes
+                    Parameter<Operation::OPEN_PATH> pOpen;
+                    pOpen.path = componentPath;
+                    IOHandler()->enqueue(IOTask(&toOpen.rc, pOpen));
+                }
+            }
+            IOHandler()->flush(internal::defaultFlushParams);
+
+            for (auto &toOpen : openedByPath)
+            {
+                auto &rc = toOpen.rc;
+                if (toOpen.isDataset)
+                {
+                    rc.setWritten(
+                        false, Attributable::EnqueueAsynchronously::No);
+                    rc.resetDataset(
+                        Dataset(*toOpen.dOpen.dtype, *toOpen.dOpen.extent));
+                    rc.setWritten(true, Attributable::EnqueueAsynchronously::No);
+                }
+                else
+                {
+                    rc.get().m_isConstant = true;
+                    rc.readBase(/* require_unit_si = */ false);
+                }
+            }
+        });
+    }
+
+    std::vector<RecordComponent> res;
+    res.reserve(components.size());
+    for (auto &component : components)
+    {
+        if (auto index = std::get_if<size_t>(&component); index)
+        {
+            res.push_back(openedByPath[*index].rc);
+        }
+        else
+        {
+            res.push_back(std::get<RecordComponent>(std::move(component)));
+        }
+    }
+    return res;
+}
+
+void Series::flushTimeSeriesComponents(std::vector<RecordComponent> &components)
+{
+    /*
+     * Components opened by path are linked directly to the /data group and
+     * are not part of the frontend hierarchy, so the Series flush does not
+     * see them. Enqueue their chunks manually before.
+     */
+    for (auto &rc : components)
+    {
+        if (rc.writable().parent == &iterations.writable())
+        {
+            rc.flush("", internal::defaultFlushParams);
+        }
+    }
+    flush();
+}
+
 WriteIterations Series::writeIterations()
 {
     auto &series = get();
@@ -0,0 +1,103 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/auxiliary/BufferPool.hpp"
+
+#include <utility>
+
+namespace openPMD::auxiliary
+{
+namespace
+{
+    // smallest size class: 64 bytes
+    constexpr unsigned minSizeClass = 6;
+
+    unsigned sizeClass(size_t bytes)
+    {
+        unsigned res = minSizeClass;
+        while ((size_t(1) << res) < bytes)
+        {
+            ++res;
+        }
+        return res;
+    }
+} // namespace
+
+BufferPool::BufferPool() : m_state(std::make_shared<State>())
+{}
+
+UniquePtrWithLambda<void> BufferPool::acquire(size_t bytes)
+{
+    unsigned cls = sizeClass(bytes);
+    std::unique_ptr<char[]> buffer;
+    auto &freeBuffers = m_state->freeBuffers[cls];
+    if (freeBuffers.empty())
+    {
+        ++m_state->misses;
+        buffer.reset(new char[size_t(1) << cls]);
+    }
+    else
+    {
+        ++m_state->hits;
+        buffer = std::move(freeBuffers.back());
+        freeBuffers.pop_back();
+    }
+    std::weak_ptr<State> weakState = m_state;
+    return UniquePtrWithLambda<void>(
+        buffer.release(), [weakState, cls](void *ptr) {
+            std::unique_ptr<char[]> released(static_cast<char *>(ptr));
+            auto state = weakState.lock();
+            if (!state)
+            {
+                return;
+            }
+            auto &buffers = state->freeBuffers[cls];
+            if (buffers.size() < maxFreeBuffersPerSizeClass)
+            {
+                buffers.push_back(std::move(released));
+            }
+        });
+}
+
+size_t BufferPool::hits() const
+{
+    return m_state->hits;
+}
+
+size_t BufferPool::misses() const
+{
+    return m_state->misses;
+}
+
+size_t BufferPool::freeBytes() const
+{
+    size_t res = 0;
+    for (auto const &[cls, buffers] : m_state->freeBuffers)
+    {
+        res += buffers.size() * (size_t(1) << cls);
+    }
+    return res;
+}
+
+void BufferPool::clear()
+{
+    m_state->freeBuffers.clear();
+}
+} // namespace openPMD::auxiliary
@@ -0,0 +1,727 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/auxiliary/Codec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace openPMD::auxiliary
+{
+namespace
+{
+    using byte = unsigned char;
+
+    /*
+     * Fixed type sizes let the compiler unroll the inner loop and vectorize
+     * the outer one.
+     */
+    template <size_t typeSize>
+    void byteShuffleFixed(byte const *in, byte *out, size_t numElements)
+    {
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            for (size_t b = 0; b < typeSize; ++b)
+            {
+                out[b * numElements + i] = in[i * typeSize + b];
+            }
+        }
+    }
+
+    template <size_t typeSize>
+    void byteUnshuffleFixed(byte const *in, byte *out, size_t numElements)
+    {
+        for (size_t i = 0; i < numElements; ++i)
+        {
+            for (size_t b = 0; b < typeSize; ++b)
+            {
+                out[i * typeSize + b] = in[b * numElements + i];
+            }
+        }
+    }
+
+    uint64_t load64(byte const *in, size_t stride)
+    {
+        uint64_t res = 0;
+        for (unsigned i = 0; i < 8; ++i)
+        {
+            res |= uint64_t(in[i * stride]) << (8 * i);
+        }
+        return res;
+    }
+
+    void store64(uint64_t val, byte *out, size_t stride)
+    {
+        for (unsigned i = 0; i < 8; ++i)
+        {
+            out[i * stride] = byte(val >> (8 * i));
+        }
+    }
+
+    /*
+     * Transpose the 8x8 bit matrix whose rows are the bytes of x,
+     * see Hacker's Delight, section 7-3.
+     */
+    uint64_t transposeBits(uint64_t x)
+    {
+        uint64_t t;
+        t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAull;
+        x = x ^ t ^ (t << 7);
+        t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCull;
+        x = x ^ t ^ (t << 14);
+        t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ull;
+        x = x ^ t ^ (t << 28);
+        return x;
+    }
+
+    constexpr char magic[4] = {'o', 'P', 'M', 'Z'};
+    constexpr byte formatVersion = 1;
+
+    enum class Method : byte
+    {
+        Stored = 0,
+        LZ = 1
+    };
+
+    [[noreturn]] void corrupt(std::string const &what)
+    {
+        throw std::runtime_error("[Codec] Corrupt payload: " + what);
+    }
+
+    /*
+     * LZ4 block format: a sequence is a token (high nibble literal length,
+     * low nibble match length - minMatch), extended lengths, the literals
+     * and a two-byte little-endian offset. The last sequence only carries
+     * literals.
+     */
+    constexpr size_t minMatch = 4;
+    // the last match must start this many bytes before the end
+    constexpr size_t matchStartMargin = 12;
+    // the last bytes are always literals
+    constexpr size_t lastLiterals = 5;
+    constexpr size_t maxOffset = 65535;
+    constexpr unsigned hashLog = 16;
+
+    uint32_t read32(byte const *p)
+    {
+        uint32_t res;
+        std::memcpy(&res, p, sizeof(res));
+        return res;
+    }
+
+    uint32_t hash(uint32_t sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - hashLog);
+    }
+
+    byte *writeLength(byte *op, size_t length)
+    {
+        while (length >= 255)
+        {
+            *op++ = 255;
+            length -= 255;
+        }
+        *op++ = byte(length);
+        return op;
+    }
+
+    byte *writeSequence(
+        byte *op,
+        byte const *literals,
+        size_t numLiterals,
+        size_t offset,
+        size_t matchLength)
+    {
+        byte *token = op++;
+        byte high = byte(std::min<size_t>(numLiterals, 15));
+        if (numLiterals >= 15)
+        {
+            op = writeLength(op, numLiterals - 15);
+        }
+        std::memcpy(op, literals, numLiterals);
+        op += numLiterals;
+        if (matchLength == 0)
+        {
+            *token = byte(high << 4);
+            return op;
+        }
+        *op++ = byte(offset);
+        *op++ = byte(offset >> 8);
+        size_t extra = matchLength - minMatch;
+        *token = byte(high << 4 | std::min<size_t>(extra, 15));
+        if (extra >= 15)
+        {
+            op = writeLength(op, extra - 15);
+        }
+        return op;
+    }
+
+    size_t readLength(byte const *&ip, byte const *end)
+    {
+        size_t res = 0;
+        byte next;
+        do
+        {
+            if (ip == end)
+            {
+                corrupt("truncated length.");
+            }
+            next = *ip++;
+            res += next;
+        } while (next == 255);
+        return res;
+    }
+} // namespace
+
+void byteShuffle(
+    void const *in_, void *out_, size_t numElements, size_t typeSize)
+{
+    auto in = static_cast<byte const *>(in_);
+    auto out = static_cast<byte *>(out_);
+    switch (typeSize)
+    {
+    case 2:
+        byteShuffleFixed<2>(in, out, numElements);
+        return;
+    case 4:
+        byteShuffleFixed<4>(in, out, numElements);
+        return;
+    case 8:
+        byteShuffleFixed<8>(in, out, numElements);
+        return;
+    case 16:
+        byteShuffleFixed<16>(in, out, numElements);
+        return;
+    default:
+        for (size_t b = 0; b < typeSize; ++b)
+        {
+            for (size_t i = 0; i < numElements; ++i)
+            {
+                out[b * numElements + i] = in[i * typeSize + b];
+            }
+        }
+    }
+}
+
+void byteUnshuffle(
+    void const *in_, void *out_, size_t numElements, size_t typeSize)
+{
+    auto in = static_cast<byte const *>(in_);
+    auto out = static_cast<byte *>(out_);
+    switch (typeSize)
+    {
+    case 2:
+        byteUnshuffleFixed<2>(in, out, numElements);
+        return;
+    case 4:
+        byteUnshuffleFixed<4>(in, out, numElements);
+        return;
+    case 8:
+        byteUnshuffleFixed<8>(in, out, numElements);
+        return;
+    case 16:
+        byteUnshuffleFixed<16>(in, out, numElements);
+        return;
+    default:
+        for (size_t b = 0; b < typeSize; ++b)
+        {
+            for (size_t i = 0; i < numElements; ++i)
+            {
+                out[i * typeSize + b] = in[b * numElements + i];
+            }
+        }
+    }
+}
+
+/*
+ * The bits are shuffled in two steps: shuffling the bytes yields one plane
+ * per byte significance, then each plane is split into its eight bit planes
+ * by transposing 8x8 bit blocks. Elements beyond a multiple of eight are
+ * appended unshuffled.
+ */
+void bitShuffle(
+    void const *in_, void *out_, size_t numElements, size_t typeSize)
+{
+    auto in = static_cast<byte const *>(in_);
+    auto out = static_cast<byte *>(out_);
+    size_t shuffled = numElements - numElements % 8;
+    size_t groups = shuffled / 8;
+    std::vector<byte> planes(shuffled * typeSize);
+    byteShuffle(in, planes.data(), shuffled, typeSize);
+    for (size_t p = 0; p < typeSize; ++p)
+    {
+        byte const *src = planes.data() + p * shuffled;
+        byte *dst = out + p * shuffled;
+        for (size_t j = 0; j < groups; ++j)
+        {
+            store64(transposeBits(load64(src + 8 * j, 1)), dst + j, groups);
+        }
+    }
+    std::memcpy(
+        out + shuffled * typeSize,
+        in + shuffled * typeSize,
+        (numElements - shuffled) * typeSize);
+}
+
+void bitUnshuffle(
+    void const *in_, void *out_, size_t numElements, size_t typeSize)
+{
+    auto in = static_cast<byte const *>(in_);
+    auto out = static_cast<byte *>(out_);
+    size_t shuffled = numElements - numElements % 8;
+    size_t groups = shuffled / 8;
+    std::vector<byte> planes(shuffled * typeSize);
+    for (size_t p = 0; p < typeSize; ++p)
+    {
+        byte const *src = in + p * shuffled;
+        byte *dst = planes.data() + p * shuffled;
+        for (size_t j = 0; j < groups; ++j)
+        {
+            store64(transposeBits(load64(src + j, groups)), dst + 8 * j, 1);
+        }
+    }
+    byteUnshuffle(planes.data(), out, shuffled, typeSize);
+    std::memcpy(
+        out + shuffled * typeSize,
+        in + shuffled * typeSize,
+        (numElements - shuffled) * typeSize);
+}
+
+size_t lzCompressBound(size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+size_t lzCompress(void const *in_, size_t size, void *out_)
+{
+    auto in = static_cast<byte const *>(in_);
+    auto out = static_cast<byte *>(out_);
+    byte *op = out;
+    size_t anchor = 0;
+    if (size > matchStartMargin)
+    {
+        constexpr size_t empty = std::numeric_limits<size_t>::max();
+        std::vector<size_t> table(size_t(1) << hashLog, empty);
+        size_t const matchStartLimit = size - matchStartMargin;
+        size_t const matchEndLimit = size - lastLiterals;
+        size_t ip = 0;
+        while (ip < matchStartLimit)
+        {
+            uint32_t sequence = read32(in + ip);
+            size_t &entry = table[hash(sequence)];
+            size_t candidate = entry;
+            entry = ip;
+            if (candidate == empty || ip - candidate > maxOffset ||
+                read32(in + candidate) != sequence)
+            {
+                // skip faster through incompressible data
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+            size_t length = minMatch;
+            while (ip + length < matchEndLimit &&
+                   in[candidate + length] == in[ip + length])
+            {
+                ++length;
+            }
+            op = writeSequence(
+                op, in + anchor, ip - anchor, ip - candidate, length);
+            ip += length;
+            anchor = ip;
+        }
+    }
+    op = writeSequence(op, in + anchor, size - anchor, 0, 0);
+    return size_t(op - out);
+}
+
+void lzDecompress(void const *in_, size_t size, void *out_, size_t rawSize)
+{
+    auto ip = static_cast<byte const *>(in_);
+    auto const end = ip + size;
+    auto out = static_cast<byte *>(out_);
+    size_t op = 0;
+    while (true)
+    {
+        if (ip == end)
+        {
+            corrupt("missing final sequence.");
+        }
+        byte token = *ip++;
+        size_t numLiterals = token >> 4;
+        if (numLiterals == 15)
+        {
+            numLiterals += readLength(ip, end);
+        }
+        if (numLiterals > size_t(end - ip) || numLiterals > rawSize - op)
+        {
+            corrupt("literals out of bounds.");
+        }
+        std::memcpy(out + op, ip, numLiterals);
+        ip += numLiterals;
+        op += numLiterals;
+        if (ip == end)
+        {
+            break;
+        }
+        if (end - ip < 2)
+        {
+            corrupt("truncated offset.");
+        }
+        size_t offset = size_t(ip[0]) | size_t(ip[1]) << 8;
+        ip += 2;
+        size_t length = (token & 15) + minMatch;
+        if ((token & 15) == 15)
+        {
+            length += readLength(ip, end);
+        }
+        if (offset == 0 || offset > op || length > rawSize - op)
+        {
+            corrupt("match out of bounds.");
+        }
+        byte *dst = out + op;
+        byte const *src = dst - offset;
+        if (offset >= length)
+        {
+            std::memcpy(dst, src, length);
+        }
+        else
+        {
+            // overlapping match, repeats the last offset bytes
+            for (size_t i = 0; i < length; ++i)
+            {
+                dst[i] = src[i];
+            }
+        }
+        op += length;
+    }
+    if (op != rawSize)
+    {
+        corrupt("decompressed size does not match.");
+    }
+}
+
+std::optional<Codec> Codec::fromString(std::string const &name)
+{
+    for (auto shuffle : {Shuffle::None, Shuffle::Byte, Shuffle::Bit})
+    {
+        for (bool compress : {false, true})
+        {
+            Codec codec{shuffle, compress};
+            if (codec.toString() == name)
+            {
+                return codec;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+std::string Codec::toString() const
+{
+    std::string res;
+    switch (shuffle)
+    {
+    case Shuffle::None:
+        break;
+    case Shuffle::Byte:
+        res = "shuffle";
+        break;
+    case Shuffle::Bit:
+        res = "bitshuffle";
+        break;
+    }
+    if (compress)
+    {
+        res += res.empty() ? "lz" : "_lz";
+    }
+    return res.empty() ? "none" : res;
+}
+
+bool Codec::isIdentity() const
+{
+    return shuffle == Shuffle::None && !compress;
+}
+
+std::vector<char>
+Codec::encode(void const *data, size_t numElements, size_t typeSize) const
+{
+    size_t rawSize = numElements * typeSize;
+    // the header stores the type size in one byte
+    Shuffle shuffleUsed = shuffle;
+    if (typeSize == 0 || typeSize > 255 ||
+        (typeSize == 1 && shuffle == Shuffle::Byte))
+    {
+        shuffleUsed = Shuffle::None;
+    }
+
+    std::vector<byte> shuffledData;
+    auto raw = static_cast<byte const *>(data);
+    switch (shuffleUsed)
+    {
+    case Shuffle::None:
+        break;
+    case Shuffle::Byte:
+        shuffledData.resize(rawSize);
+        byteShuffle(data, shuffledData.data(), numElements, typeSize);
+        raw = shuffledData.data();
+        break;
+    case Shuffle::Bit:
+        shuffledData.resize(rawSize);
+        bitShuffle(data, shuffledData.data(), numElements, typeSize);
+        raw = shuffledData.data();
+        break;
+    }
+
+    std::vector<char> res;
+    Method method = Method::Stored;
+    if (compress)
+    {
+        res.resize(headerSize + lzCompressBound(rawSize));
+        size_t compressed = lzCompress(raw, rawSize, res.data() + headerSize);
+        if (compressed < rawSize)
+        {
+            method = Method::LZ;
+            res.resize(headerSize + compressed);
+        }
+    }
+    if (method == Method::Stored)
+    {
+        res.resize(headerSize + rawSize);
+        std::memcpy(res.data() + headerSize, raw, rawSize);
+    }
+
+    std::memcpy(res.data(), magic, sizeof(magic));
+    res[4] = char(formatVersion);
+    res[5] = char(shuffleUsed);
+    res[6] = char(method);
+    res[7] = char(shuffleUsed == Shuffle::None ? 1 : typeSize);
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        res[8 + i] = char(byte(uint64_t(rawSize) >> (8 * i)));
+    }
+    return res;
+}
+
+std::vector<char> Codec::decode(void const *payload_, size_t size)
+{
+    auto payload = static_cast<byte const *>(payload_);
+    if (size < headerSize || std::memcmp(payload, magic, sizeof(magic)) != 0)
+    {
+        corrupt("missing header.");
+    }
+    if (payload[4] != formatVersion)
+    {
+        corrupt("unknown format version " + std::to_string(payload[4]) + ".");
+    }
+    auto shuffle = Shuffle(payload[5]);
+    auto method = Method(payload[6]);
+    size_t typeSize = payload[7];
+    uint64_t rawSize = 0;
+    for (unsigned i = 0; i < 8; ++i)
+    {
+        rawSize |= uint64_t(payload[8 + i]) << (8 * i);
+    }
+    if (typeSize == 0 || rawSize % typeSize != 0)
+    {
+        corrupt("size is no multiple of the type size.");
+    }
+    payload += headerSize;
+    size -= headerSize;
+
+    std::vector<char> unpacked(rawSize);
+    switch (method)
+    {
+    case Method::Stored:
+        if (size != rawSize)
+        {
+            corrupt("stored size does not match.");
+        }
+        std::memcpy(unpacked.data(), payload, size);
+        break;
+    case Method::LZ:
+        lzDecompress(payload, size, unpacked.data(), rawSize);
+        break;
+    default:
+        corrupt("unknown compression method.");
+    }
+
+    size_t numElements = rawSize / typeSize;
+    switch (shuffle)
+    {
+    case Shuffle::None:
+        return unpacked;
+    case Shuffle::Byte: {
+        std::vector<char> res(rawSize);
+        byteUnshuffle(unpacked.data(), res.data(), numElements, typeSize);
+        return res;
+    }
+    case Shuffle::Bit: {
+        std::vector<char> res(rawSize);
+        bitUnshuffle(unpacked.data(), res.data(), numElements, typeSize);
+        return res;
+    }
+    }
+    corrupt("unknown shuffle.");
+}
+
+namespace
+{
+    /*
+     * Blocks that the sample is assembled from. Taking them from different
+     * parts of the data avoids judging by a region that happens to be
+     * unrepresentative, e.g. a constant border.
+     */
+    constexpr size_t sampleBlocks = 4;
+    // Each trial is repeated and the fastest run counts, to reduce noise.
+    constexpr unsigned trialRepetitions = 3;
+
+    std::vector<char> takeSample(
+        char const *data,
+        size_t numElements,
+        size_t typeSize,
+        size_t sampleBytes)
+    {
+        size_t totalBytes = numElements * typeSize;
+        if (totalBytes <= sampleBytes)
+        {
+            return std::vector<char>(data, data + totalBytes);
+        }
+        size_t blockElements =
+            std::max<size_t>(1, sampleBytes / typeSize / sampleBlocks);
+        size_t stride = numElements / sampleBlocks;
+        std::vector<char> res;
+        res.reserve(sampleBlocks * blockElements * typeSize);
+        for (size_t block = 0; block < sampleBlocks; ++block)
+        {
+            size_t first =
+                std::min(block * stride, numElements - blockElements);
+            char const *begin = data + first * typeSize;
+            res.insert(res.end(), begin, begin + blockElements * typeSize);
+        }
+        return res;
+    }
+
+    CodecAdvisor::Trial runTrial(
+        Codec codec, std::vector<char> const &sample, size_t typeSize)
+    {
+        using clock = std::chrono::steady_clock;
+        CodecAdvisor::Trial res;
+        res.codec = codec;
+        size_t numElements = sample.size() / typeSize;
+        double seconds = std::numeric_limits<double>::max();
+        size_t encodedSize = 0;
+        for (unsigned i = 0; i < trialRepetitions; ++i)
+        {
+            auto start = clock::now();
+            encodedSize = codec.encode(sample.data(), numElements, typeSize)
+                              .size();
+            std::chrono::duration<double> elapsed = clock::now() - start;
+            seconds = std::min(seconds, elapsed.count());
+        }
+        res.ratio = static_cast<double>(sample.size()) /
+            static_cast<double>(encodedSize);
+        // guard against timer resolution on tiny samples
+        res.throughput =
+            static_cast<double>(sample.size()) / std::max(seconds, 1e-9);
+        return res;
+    }
+} // namespace
+
+std::string CodecAdvisor::Decision::toString() const
+{
+    std::stringstream res;
+    res << std::fixed << std::setprecision(2)
+        << (codec.has_value() ? codec->toString() : std::string("none"))
+        << " (sampled " << sampledBytes << " bytes;";
+    char const *separator = " ";
+    for (auto const &trial : trials)
+    {
+        res << separator << trial.codec.toString() << ": ratio "
+            << trial.ratio << ", " << trial.throughput / 1e6 << " MB/s";
+        separator = "; ";
+    }
+    res << ")";
+    return res.str();
+}
+
+auto CodecAdvisor::advise(
+    void const *data, size_t numElements, size_t typeSize) const -> Decision
+{
+    Decision res;
+    if (data == nullptr || numElements == 0 || typeSize == 0)
+    {
+        return res;
+    }
+    auto sample = takeSample(
+        static_cast<char const *>(data), numElements, typeSize, sampleBytes);
+    res.sampledBytes = sample.size();
+
+    std::vector<std::future<Trial>> pending;
+    pending.reserve(candidates.size());
+    for (auto const &candidate : candidates)
+    {
+        pending.push_back(std::async(
+            std::launch::async, runTrial, candidate, std::cref(sample),
+            typeSize));
+    }
+    res.trials.reserve(pending.size());
+    for (auto &future : pending)
+    {
+        res.trials.push_back(future.get());
+    }
+
+    auto score = [this](Trial const &trial) {
+        switch (objective)
+        {
+        case Objective::Ratio:
+            return trial.ratio;
+        case Objective::Balanced:
+            break;
+        }
+        return trial.ratio * trial.throughput;
+    };
+    Trial const *best = nullptr;
+    for (auto const &trial : res.trials)
+    {
+        if (trial.ratio < minRatio)
+        {
+            continue;
+        }
+        if (best == nullptr || score(trial) > score(*best) ||
+            (score(trial) == score(*best) &&
+             trial.throughput > best->throughput))
+        {
+            best = &trial;
+        }
+    }
+    if (best != nullptr)
+    {
+        res.codec = best->codec;
+    }
+    return res;
+}
+} // namespace openPMD::auxiliary
@@ -36,8 +36,10 @@
 #include <fstream>
 #include <iostream> // std::cerr
 #include <map>
+#include <mutex>
 #include <optional>
 #include <sstream>
+#include <unordered_map>
 #include <utility> // std::forward
 #include <vector>
 
@@ -389,6 +391,42 @@ ParsedConfig parseOptions(std::string const &options, bool considerFiles)
     return parseInlineOptions(options);
 }
 
+std::shared_ptr<ParsedConfig const>
+parseOptionsCached(std::string const &options)
+{
+    static auto const emptyConfig =
+        std::make_shared<ParsedConfig const>(parseInlineOptions("{}"));
+    if (options == "{}")
+    {
+        return emptyConfig;
+    }
+
+    /*
+     * Applications typically use a handful of distinct option strings, bound
+     * the cache anyway in case they are generated dynamically.
+     */
+    constexpr size_t maxCachedOptions = 1024;
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<ParsedConfig const>>
+        cache;
+    {
+        std::lock_guard lock(mutex);
+        if (auto it = cache.find(options); it != cache.end())
+        {
+            return it->second;
+        }
+    }
+    // parse outside the lock, errors will not be cached
+    auto parsed =
+        std::make_shared<ParsedConfig const>(parseInlineOptions(options));
+    std::lock_guard lock(mutex);
+    if (cache.size() >= maxCachedOptions)
+    {
+        cache.clear();
+    }
+    return cache.emplace(options, std::move(parsed)).first->second;
+}
+
 #if openPMD_HAVE_MPI
 ParsedConfig
 parseOptions(std::string const &options, MPI_Comm comm, bool considerFiles)
@@ -549,7 +587,7 @@ std::optional<std::string> asLowerCaseStringDynamic(nlohmann::json const &value)
 
 std::vector<std::string> backendKeys()
 {
-    return {"adios2", "json", "toml", "hdf5"};
+    return {"adios2", "json", "toml", "hdf5", "shm"};
 }
 
 void warnGlobalUnusedOptions(TracingJSON const &config)
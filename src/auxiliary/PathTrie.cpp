@@ -0,0 +1,142 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "openPMD/auxiliary/PathTrie.hpp"
+
+#include <utility>
+
+namespace openPMD::auxiliary
+{
+namespace
+{
+    /*
+     * Calls f for each slash-separated component of name, including empty
+     * ones. Returns early if f returns false.
+     */
+    template <typename F>
+    void forEachComponent(std::string const &name, F &&f)
+    {
+        size_t begin = 0;
+        while (true)
+        {
+            auto end = name.find('/', begin);
+            if (end == std::string::npos)
+            {
+                f(name.substr(begin));
+                return;
+            }
+            if (!f(name.substr(begin, end - begin)))
+            {
+                return;
+            }
+            begin = end + 1;
+        }
+    }
+} // namespace
+
+void PathTrie::insert(std::string const &name)
+{
+    Node *node = &m_root;
+    forEachComponent(name, [&node](std::string component) {
+        auto &child = node->children[std::move(component)];
+        if (!child)
+        {
+            child = std::make_unique<Node>();
+        }
+        node = child.get();
+        return true;
+    });
+    node->isEntry = true;
+}
+
+void PathTrie::clear()
+{
+    m_root.children.clear();
+    m_root.isEntry = false;
+}
+
+bool PathTrie::empty() const
+{
+    return m_root.children.empty();
+}
+
+auto PathTrie::find(std::string const &prefix) const -> Node const *
+{
+    std::string normalized = prefix;
+    if (!normalized.empty() && normalized.back() == '/')
+    {
+        normalized.pop_back();
+    }
+    Node const *node = &m_root;
+    forEachComponent(normalized, [&node](std::string const &component) {
+        auto it = node->children.find(component);
+        node = it == node->children.end() ? nullptr : it->second.get();
+        return node != nullptr;
+    });
+    return node;
+}
+
+auto PathTrie::children(std::string const &prefix) const -> std::vector<Child>
+{
+    std::vector<Child> res;
+    Node const *node = find(prefix);
+    if (!node)
+    {
+        return res;
+    }
+    res.reserve(node->children.size());
+    for (auto const &[name, child] : node->children)
+    {
+        res.push_back({name, child->isEntry, !child->children.empty()});
+    }
+    return res;
+}
+
+std::vector<std::string> PathTrie::descendants(std::string const &prefix) const
+{
+    std::vector<std::string> res;
+    Node const *node = find(prefix);
+    if (!node)
+    {
+        return res;
+    }
+    std::string path;
+    auto visit = [&res, &path](
+                     Node const &current, bool isTop, auto &recurse) -> void {
+        for (auto const &[name, child] : current.children)
+        {
+            auto previousLength = path.size();
+            if (!isTop)
+            {
+                path += '/';
+            }
+            path += name;
+            if (child->isEntry)
+            {
+                res.push_back(path);
+            }
+            recurse(*child, false, recurse);
+            path.resize(previousLength);
+        }
+    };
+    visit(*node, true, visit);
+    return res;
+}
+} // namespace openPMD::auxiliary
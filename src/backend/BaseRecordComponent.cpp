@@ -80,6 +80,11 @@ std::optional<size_t> BaseRecordComponent::joinedDimension() const
 }
 
 ChunkTable BaseRecordComponent::availableChunks()
+{
+    return availableChunks_impl(/* withStatistics = */ false);
+}
+
+ChunkTable BaseRecordComponent::availableChunks_impl(bool withStatistics)
 {
     auto &rc = get();
     if (rc.m_isConstant)
@@ -103,6 +108,7 @@ ChunkTable BaseRecordComponent::availableChunks()
             "retrieved.");
     }
     Parameter<Operation::AVAILABLE_CHUNKS> param;
+    param.withStatistics = withStatistics;
     IOTask task(this, param);
     IOHandler()->enqueue(task);
     IOHandler()->flush(internal::defaultFlushParams);
@@ -0,0 +1,215 @@
+/* Copyright 2024 openPMD contributors
+ *
+ * This file is part of openPMD-api.
+ *
+ * openPMD-api is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * openPMD-api is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with openPMD-api.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "openPMD/benchmark/BenchmarkResult.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace openPMD::benchmark
+{
+Statistics Statistics::fromSamples(std::vector<double> samples)
+{
+    Statistics res;
+    if (samples.empty())
+    {
+        return res;
+    }
+    std::sort(samples.begin(), samples.end());
+    res.samples = samples.size();
+    res.min = samples.front();
+    res.max = samples.back();
+    res.mean = std::accumulate(samples.begin(), samples.end(), 0.) /
+        double(samples.size());
+    res.median = percentile(samples, 50);
+    res.p90 = percentile(samples, 90);
+    res.p99 = percentile(samples, 99);
+    return res;
+}
+
+double Statistics::percentile(std::vector<double> const &sorted, double p)
+{
+    if (sorted.empty())
+    {
+        throw std::runtime_error(
+            "[benchmark::Statistics] Cannot compute percentile of zero "
+            "samples.");
+    }
+    double position = p / 100. * double(sorted.size() - 1);
+    auto lower = std::size_t(std::floor(position));
+    auto upper = std::min(lower + 1, sorted.size() - 1);
+    double weight = position - double(lower);
+    return sorted[lower] + weight * (sorted[upper] - sorted[lower]);
+}
+
+namespace
+{
+    nlohmann::json statisticsToJson(Statistics const &stats)
+    {
+        nlohmann::json res;
+        res["samples"] = stats.samples;
+        res["min"] = stats.min;
+        res["max"] = stats.max;
+        res["mean"] = stats.mean;
+        res["median"] = stats.median;
+        res["p90"] = stats.p90;
+        res["p99"] = stats.p99;
+        return res;
+    }
+
+    double throughput(Result const &result)
+    {
+        return result.seconds.median > 0
+            ? double(result.bytes) / result.seconds.median
+            : 0.;
+    }
+
+    std::string csvEscape(std::string const &s)
+    {
+        if (s.find_first_of(",\"\n") == std::string::npos)
+        {
+            return s;
+        }
+        std::string res = "\"";
+        for (char c : s)
+        {
+            if (c == '"')
+            {
+                res += '"';
+            }
+            res += c;
+        }
+        res += '"';
+        return res;
+    }
+} // namespace
+
+void writeJSON(std::ostream &out, std::vector<Result> const &results)
+{
+    nlohmann::json res = nlohmann::json::array();
+    for (auto const &result : results)
+    {
+        nlohmann::json entry;
+        entry["name"] = result.name;
+        entry["parameters"] = result.parameters;
+        entry["seconds"] = statisticsToJson(result.seconds);
+        entry["bytes"] = result.bytes;
+        entry["bytes_per_second"] = throughput(result);
+        if (result.peakRSS.has_value())
+        {
+            entry["peak_rss"] = *result.peakRSS;
+        }
+        else
+        {
+            entry["peak_rss"] = nullptr;
+        }
+        res.push_back(std::move(entry));
+    }
+    out << res.dump(2) << '\n';
+}
+
+void writeCSV(std::ostream &out, std::vector<Result> const &results)
+{
+    std::set<std::string> parameterKeys;
+    for (auto const &result : results)
+    {
+        for (auto const &pair : result.parameters)
+        {
+            parameterKeys.insert(pair.first);
+        }
+    }
+
+    out << "name";
+    for (auto const &key : parameterKeys)
+    {
+        out << ',' << csvEscape(key);
+    }
+    out << ",samples,min,max,mean,median,p90,p99,bytes,bytes_per_second,"
+           "peak_rss\n";
+
+    for (auto const &result : results)
+    {
+        out << csvEscape(result.name);
+        for (auto const &key : parameterKeys)
+        {
+            out << ',';
+            auto it = result.parameters.find(key);
+            if (it != result.parameters.end())
+            {
+                out << csvEscape(it->second);
+            }
+        }
+        auto const &s = result.seconds;
+        out << ',' << s.samples << ',' << s.min << ',' << s.max << ','
+            << s.mean << ',' << s.median << ',' << s.p90 << ',' << s.p99
+            << ',' << result.bytes << ',' << throughput(result) << ',';
+        if (result.peakRSS.has_value())
+        {
+            out << *result.peakRSS;
+        }
+        out << '\n';
+    }
+}
+
+std::optional<std::uint64_t> peakResidentSetSize()
+{
+#if defined(__linux)
+    std::ifstream input("/proc/self/status");
+    for (std::string line; std::getline(input, line);)
+    {
+        if (line.find("VmHWM:") == 0)
+        {
+            std::istringstream fields(line.substr(6));
+            std::uint64_t kiloBytes = 0;
+            if (fields >> kiloBytes)
+            {
+                return kiloBytes * 1024;
+            }
+        }
+    }
+#endif
+    return std::nullopt;
+}
+
+bool resetPeakResidentSetSize()
+{
+#if defined(__linux)
+    // see proc(5), writing "5" to clear_refs resets VmHWM
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (!clearRefs.is_open())
+    {
+        return false;
+    }
+    clearRefs << "5";
+    clearRefs.flush();
+    return clearRefs.good();
+#else
+    return false;
+#endif
+}
+} // namespace openPMD::benchmark
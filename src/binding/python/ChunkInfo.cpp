@@ -38,6 +38,28 @@ void init_Chunk(py::module &m)
             })
         .def_readwrite("offset", &ChunkInfo::offset)
         .def_readwrite("extent", &ChunkInfo::extent);
+    py::class_<ChunkStatistics>(m, "ChunkStatistics")
+        .def(
+            py::init<double, double, uint64_t>(),
+            py::arg("min"),
+            py::arg("max"),
+            py::arg("count"))
+        .def(
+            "__repr__",
+            [](const ChunkStatistics &s) {
+                return "<openPMD.ChunkStatistics of " +
+                    std::to_string(s.count) + " values in [" +
+                    std::to_string(s.min) + ", " + std::to_string(s.max) +
+                    "]'>";
+            })
+        .def_readwrite("min", &ChunkStatistics::min)
+        .def_readwrite("max", &ChunkStatistics::max)
+        .def_readwrite("count", &ChunkStatistics::count)
+        .def(
+            "may_contain",
+            &ChunkStatistics::mayContain,
+            py::arg("lower"),
+            py::arg("upper"));
     py::class_<WrittenChunkInfo, ChunkInfo>(m, "WrittenChunkInfo")
         .def(py::init<Offset, Extent>(), py::arg("offset"), py::arg("extent"))
         .def(
@@ -54,6 +76,7 @@ void init_Chunk(py::module &m)
         .def_readwrite("offset", &WrittenChunkInfo::offset)
         .def_readwrite("extent", &WrittenChunkInfo::extent)
         .def_readwrite("source_id", &WrittenChunkInfo::sourceID)
+        .def_readwrite("statistics", &WrittenChunkInfo::statistics)
 
         .def(py::pickle(
             // __getstate__
@@ -75,6 +98,97 @@ void init_Chunk(py::module &m)
                 return WrittenChunkInfo(offset, extent, sourceID);
             }));
 
+    using namespace chunk_assignment;
+
+    py::class_<PartialAssignment>(m, "PartialAssignment")
+        .def(py::init<>())
+        .def(py::init<ChunkTable>(), py::arg("not_assigned"))
+        .def(
+            py::init<ChunkTable, Assignment>(),
+            py::arg("not_assigned"),
+            py::arg("assigned"))
+        .def_readwrite("not_assigned", &PartialAssignment::notAssigned)
+        .def_readwrite("assigned", &PartialAssignment::assigned);
+
+    py::class_<Strategy>(m, "Strategy")
+        .def(
+            "assign",
+            py::overload_cast<ChunkTable, RankMeta const &, RankMeta const &>(
+                &Strategy::assign),
+            py::arg("chunk_table"),
+            py::arg("rank_meta_in") = RankMeta(),
+            py::arg("rank_meta_out") = RankMeta())
+        .def(
+            "assign",
+            py::overload_cast<
+                PartialAssignment,
+                RankMeta const &,
+                RankMeta const &>(&Strategy::assign),
+            py::arg("partial_assignment"),
+            py::arg("rank_meta_in") = RankMeta(),
+            py::arg("rank_meta_out") = RankMeta());
+
+    py::class_<PartialStrategy>(m, "PartialStrategy")
+        .def(
+            "assign",
+            py::overload_cast<ChunkTable, RankMeta const &, RankMeta const &>(
+                &PartialStrategy::assign),
+            py::arg("chunk_table"),
+            py::arg("rank_meta_in") = RankMeta(),
+            py::arg("rank_meta_out") = RankMeta())
+        .def(
+            "assign",
+            py::overload_cast<
+                PartialAssignment,
+                RankMeta const &,
+                RankMeta const &>(&PartialStrategy::assign),
+            py::arg("partial_assignment"),
+            py::arg("rank_meta_in") = RankMeta(),
+            py::arg("rank_meta_out") = RankMeta());
+
+    py::class_<FromPartialStrategy, Strategy>(m, "FromPartialStrategy")
+        .def(
+            py::init([](PartialStrategy const &firstPass,
+                        Strategy const &secondPass) {
+                return std::make_unique<FromPartialStrategy>(
+                    firstPass.clone(), secondPass.clone());
+            }),
+            py::arg("first_pass"),
+            py::arg("second_pass"));
+
+    py::class_<RoundRobin, Strategy>(m, "RoundRobin").def(py::init<>());
+
+    py::class_<BinPacking, Strategy>(m, "BinPacking")
+        .def(py::init<>())
+        .def(py::init<size_t>(), py::arg("split_along_dimension"));
+
+    py::class_<ByHostname, PartialStrategy>(m, "ByHostname")
+        .def(
+            py::init([](Strategy const &withinNode) {
+                return std::make_unique<ByHostname>(withinNode.clone());
+            }),
+            py::arg("strategy_within_node"));
+
+    py::class_<BlockSlicer>(m, "BlockSlicer")
+        .def(
+            "slice_block",
+            &BlockSlicer::sliceBlock,
+            py::arg("total_extent"),
+            py::arg("size"),
+            py::arg("rank"));
+
+    py::class_<OneDimensionalBlockSlicer, BlockSlicer>(
+        m, "OneDimensionalBlockSlicer")
+        .def(py::init<>())
+        .def(py::init<size_t>(), py::arg("dim"));
+
+    py::class_<ByCuboidSlice, Strategy>(m, "ByCuboidSlice")
+        .def(
+            py::init([](BlockSlicer const &blockSlicer) {
+                return std::make_unique<ByCuboidSlice>(blockSlicer.clone());
+            }),
+            py::arg("block_slicer"));
+
     py::enum_<host_info::Method>(m, "HostInfo")
         .value("POSIX_HOSTNAME", host_info::Method::POSIX_HOSTNAME)
         .value("MPI_PROCESSOR_NAME", host_info::Method::MPI_PROCESSOR_NAME)
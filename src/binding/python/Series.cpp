@@ -325,6 +325,8 @@ this method.
 
         .def_property_readonly(
             "backend", static_cast<std::string (Series::*)()>(&Series::backend))
+        .def_property_readonly(
+            "pending_write_bytes", &Series::pendingWriteBytes)
 
         // TODO remove in future versions (deprecated)
         .def("set_openPMD", &Series::setOpenPMD)
@@ -39,8 +39,16 @@ are fulfilled:
    By default, the openPMD-api will be initialized without an MPI communicator
    if the MPI size is 1. This is to simplify the use of the JSON backend
    which is only available in serial openPMD.
-With parallelization enabled, each dataset will be equally sliced along
-the dimension with the largest extent.
+With parallelization enabled, each dataset will by default be equally sliced
+along the dimension with the largest extent.
+Alternatively, the chunks written by the data source can be distributed
+among the ranks via --distribution:
+* slice:       (default) slice each dataset along its largest dimension
+* roundrobin:  assign the written chunks to ranks in a round-robin manner
+* binpacking:  balance the amount of data per rank, splitting large chunks
+* hostname:    assign chunks to ranks on the same host as their writer
+               (requires a rank table in the data source, see the
+               rank_table JSON option), fall back to binpacking otherwise
 
 Examples:
     {0} --infile simData.h5 --outfile simData_%T.bp
@@ -60,6 +68,12 @@ Examples:
                         type=str,
                         default='{}',
                         help='JSON config for the out file')
+    parser.add_argument(
+        '--distribution',
+        type=str,
+        default='slice',
+        choices=['slice', 'roundrobin', 'binpacking', 'hostname'],
+        help='Strategy for distributing datasets among MPI ranks')
     # MPI, default: Import mpi4py if available and openPMD is parallel,
     # but don't use if MPI size is 1 (this makes it easier to interact with
     # JSON, since that backend is unavailable in parallel)
@@ -158,6 +172,22 @@ class Chunk:
         return Chunk(offset, extent)
 
 
+def chunk_distribution_strategy(name):
+    """
+    Return the chunk distribution strategy for the --distribution argument,
+    or None for the default slicing behavior.
+    """
+    if name == 'roundrobin':
+        return io.RoundRobin()
+    elif name == 'binpacking':
+        return io.BinPacking()
+    elif name == 'hostname':
+        return io.FromPartialStrategy(io.ByHostname(io.BinPacking()),
+                                      io.BinPacking())
+    else:
+        return None
+
+
 class deferred_load:
     def __init__(self, source, dynamicView, offset, extent):
         self.source = source
@@ -177,6 +207,9 @@ class pipe:
         self.outconfig = outconfig
         self.loads = []
         self.comm = comm
+        self.strategy = chunk_distribution_strategy(args.distribution)
+        self.rank_meta_in = None
+        self.rank_meta_out = None
 
     def run(self):
         if not HAVE_MPI or (args.mpi is None and self.comm.size == 1):
@@ -204,8 +237,23 @@ class pipe:
         # In Linear read mode, global attributes are only present after calling
         # this method to access the first iteration
         inseries.parse_base()
+        if self.strategy is not None:
+            self.__init_rank_meta(inseries)
         self.__copy(inseries, outseries)
 
+    def __init_rank_meta(self, inseries):
+        """
+        Gather the writer rank table from the data source and the hostnames
+        of all reading ranks, as input for chunk distribution strategies.
+        """
+        if HAVE_MPI and self.comm.size > 1:
+            self.rank_meta_in = inseries.get_rank_table(collective=True)
+            self.rank_meta_out = \
+                io.HostInfo.MPI_PROCESSOR_NAME.get_collective(self.comm)
+        else:
+            self.rank_meta_in = inseries.get_rank_table(collective=False)
+            self.rank_meta_out = {0: io.HostInfo.POSIX_HOSTNAME.get()}
+
     def __copy(self, src, dest, current_path="/data/"):
         """
         Worker method.
@@ -293,6 +341,18 @@ class pipe:
                 pass
             elif src.constant:
                 dest.make_constant(src.get_attribute("value"))
+            elif self.strategy is not None:
+                assignment = self.strategy.assign(src.available_chunks(),
+                                                  self.rank_meta_in,
+                                                  self.rank_meta_out)
+                for chunk in assignment.get(self.comm.rank, []):
+                    if debug:
+                        print("{}\t{}/{}:\t{} -- {}".format(
+                            current_path, self.comm.rank, self.comm.size,
+                            chunk.offset, chunk.extent))
+                    span = dest.store_chunk(chunk.offset, chunk.extent)
+                    self.loads.append(
+                        deferred_load(src, span, chunk.offset, chunk.extent))
             else:
                 chunk = Chunk(offset, shape)
                 local_chunk = chunk.slice1D(self.comm.rank, self.comm.size)
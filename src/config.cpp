@@ -42,7 +42,9 @@ std::map<std::string, bool> openPMD::getVariants()
 #endif
         {"hdf5", bool(openPMD_HAVE_HDF5)},
         {"adios1", false},
-        {"adios2", bool(openPMD_HAVE_ADIOS2)}};
+        {"adios2", bool(openPMD_HAVE_ADIOS2)},
+        {"shm", bool(openPMD_HAVE_SHM)},
+        {"memory", true}};
     // clang-format on
 }
 
@@ -73,5 +75,9 @@ std::vector<std::string> openPMD::getFileExtensions()
 #if openPMD_HAVE_HDF5
     fext.emplace_back("h5");
 #endif
+#if openPMD_HAVE_SHM
+    fext.emplace_back("shm");
+#endif
+    fext.emplace_back("mem");
     return fext;
 }
@@ -6,8 +6,10 @@
 #include "openPMD/Dataset.hpp"
 #include "openPMD/IO/AbstractIOHandler.hpp"
 #include "openPMD/IO/AbstractIOHandlerHelper.hpp"
+#include "openPMD/auxiliary/Codec.hpp"
 #include "openPMD/auxiliary/DerefDynamicCast.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
+#include "openPMD/auxiliary/PathTrie.hpp"
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/auxiliary/Variant.hpp"
 #include "openPMD/backend/Attributable.hpp"
@@ -17,7 +19,11 @@
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <iostream>
@@ -508,3 +514,195 @@ TEST_CASE("filesystem_test", "[auxiliary]")
     REQUIRE(!remove_file("./nonexistent_file_in_cmake_bin_directory"));
 #endif
 }
+
+TEST_CASE("path_trie_test", "[auxiliary]")
+{
+    auxiliary::PathTrie trie;
+    REQUIRE(trie.empty());
+    for (auto name :
+         {"/data/0/meshes/E/x",
+          "/data/0/meshes/E/y",
+          "/data/0/meshes/rho",
+          "/data/0/meshes/rho/unitSI",
+          "/data/1/meshes/rho",
+          "__openPMD_internal/useSteps"})
+    {
+        trie.insert(name);
+    }
+    REQUIRE(!trie.empty());
+
+    auto names = [](std::vector<auxiliary::PathTrie::Child> const &children) {
+        std::vector<std::string> res;
+        for (auto const &child : children)
+        {
+            res.push_back(
+                child.name + (child.isEntry ? "!" : "") +
+                (child.hasChildren ? "/" : ""));
+        }
+        return res;
+    };
+    // the empty prefix and "/" both denote the root group
+    REQUIRE(names(trie.children("")) == std::vector<std::string>{"data/"});
+    REQUIRE(names(trie.children("/")) == std::vector<std::string>{"data/"});
+    REQUIRE(
+        names(trie.children("/data/0/meshes/")) ==
+        std::vector<std::string>{"E/", "rho!/"});
+    REQUIRE(
+        names(trie.children("/data/0/meshes/rho")) ==
+        std::vector<std::string>{"unitSI!"});
+    REQUIRE(
+        names(trie.children("__openPMD_internal")) ==
+        std::vector<std::string>{"useSteps!"});
+    REQUIRE(trie.children("/data/2").empty());
+    REQUIRE(trie.children("/data/0/meshes/E/x").empty());
+
+    REQUIRE(
+        trie.descendants("/data/0/meshes") ==
+        std::vector<std::string>{"E/x", "E/y", "rho", "rho/unitSI"});
+    REQUIRE(
+        trie.descendants("/data/") ==
+        std::vector<std::string>{
+            "0/meshes/E/x",
+            "0/meshes/E/y",
+            "0/meshes/rho",
+            "0/meshes/rho/unitSI",
+            "1/meshes/rho"});
+    REQUIRE(trie.descendants("/data/0/mesh").empty());
+
+    trie.clear();
+    REQUIRE(trie.empty());
+    REQUIRE(trie.children("/").empty());
+}
+
+TEST_CASE("codec_test", "[auxiliary]")
+{
+    using auxiliary::Codec;
+
+    // bit planes hold one bit of eight consecutive elements each
+    std::vector<uint8_t> bytes{1, 0, 0, 0, 0, 0, 0, 2, 3};
+    std::vector<uint8_t> planes(bytes.size());
+    auxiliary::bitShuffle(bytes.data(), planes.data(), bytes.size(), 1);
+    REQUIRE(
+        planes ==
+        std::vector<uint8_t>{0x01, 0x80, 0, 0, 0, 0, 0, 0, /* tail */ 3});
+
+    std::vector<uint16_t> shorts{0x0102, 0x0304};
+    std::vector<uint16_t> shuffled(2);
+    auxiliary::byteShuffle(shorts.data(), shuffled.data(), 2, 2);
+    auto shuffledBytes = reinterpret_cast<uint8_t const *>(shuffled.data());
+    REQUIRE(shuffledBytes[0] == reinterpret_cast<uint8_t *>(&shorts[0])[0]);
+    REQUIRE(shuffledBytes[1] == reinterpret_cast<uint8_t *>(&shorts[1])[0]);
+
+    REQUIRE(!Codec::fromString("zstd").has_value());
+    for (auto name :
+         {"none", "lz", "shuffle", "shuffle_lz", "bitshuffle", "bitshuffle_lz"})
+    {
+        REQUIRE(Codec::fromString(name).value().toString() == name);
+    }
+    REQUIRE(Codec::fromString("none")->isIdentity());
+
+    // shuffled smooth data compresses well, noise is stored as is
+    std::vector<double> smooth(10007);
+    for (size_t i = 0; i < smooth.size(); ++i)
+    {
+        smooth[i] = std::sin(double(i) / 1000.);
+    }
+    std::vector<uint32_t> noise(1000);
+    uint32_t state = 42;
+    for (auto &val : noise)
+    {
+        state = state * 1664525u + 1013904223u;
+        val = state;
+    }
+    for (auto name :
+         {"none", "lz", "shuffle", "shuffle_lz", "bitshuffle", "bitshuffle_lz"})
+    {
+        auto codec = Codec::fromString(name).value();
+        auto encoded = codec.encode(smooth.data(), smooth.size(), 8);
+        // without shuffling, the mantissas hide the redundancy
+        if (codec.compress && codec.shuffle != Codec::Shuffle::None)
+        {
+            REQUIRE(encoded.size() < smooth.size() * 8);
+        }
+        auto decoded = Codec::decode(encoded.data(), encoded.size());
+        REQUIRE(decoded.size() == smooth.size() * 8);
+        REQUIRE(
+            std::memcmp(decoded.data(), smooth.data(), decoded.size()) == 0);
+
+        encoded = codec.encode(noise.data(), noise.size(), 4);
+        REQUIRE(encoded.size() <= noise.size() * 4 + Codec::headerSize);
+        decoded = Codec::decode(encoded.data(), encoded.size());
+        REQUIRE(std::memcmp(decoded.data(), noise.data(), decoded.size()) == 0);
+
+        encoded = codec.encode(nullptr, 0, 4);
+        REQUIRE(Codec::decode(encoded.data(), encoded.size()).empty());
+    }
+
+    // long runs need extended lengths
+    std::string runs(100000, 'a');
+    runs += "some literals in between" + std::string(70000, 'b');
+    auto encoded = Codec{Codec::Shuffle::None, true}.encode(
+        runs.data(), runs.size(), 1);
+    REQUIRE(encoded.size() < 2000);
+    auto decoded = Codec::decode(encoded.data(), encoded.size());
+    REQUIRE(std::string(decoded.begin(), decoded.end()) == runs);
+
+    encoded.resize(encoded.size() - 1);
+    REQUIRE_THROWS_AS(
+        Codec::decode(encoded.data(), encoded.size()), std::runtime_error);
+    REQUIRE_THROWS_AS(Codec::decode("oPMZ", 4), std::runtime_error);
+}
+
+TEST_CASE("codec_advisor_test", "[auxiliary]")
+{
+    using auxiliary::Codec;
+    using auxiliary::CodecAdvisor;
+
+    // larger than the default sample
+    std::vector<double> smooth(20011);
+    for (size_t i = 0; i < smooth.size(); ++i)
+    {
+        smooth[i] = std::sin(double(i) / 1000.);
+    }
+    // splitmix64, whose low bits are as random as its high bits
+    std::vector<uint64_t> noise(1000);
+    uint64_t state = 42;
+    for (auto &val : noise)
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        val = z ^ (z >> 31);
+    }
+
+    CodecAdvisor advisor;
+    advisor.objective = CodecAdvisor::Objective::Ratio;
+    auto decision = advisor.advise(smooth.data(), smooth.size(), 8);
+    REQUIRE(decision.sampledBytes <= advisor.sampleBytes);
+    REQUIRE(decision.sampledBytes % 8 == 0);
+    REQUIRE(decision.trials.size() == advisor.candidates.size());
+    REQUIRE(decision.codec.has_value());
+    REQUIRE(decision.codec->shuffle != Codec::Shuffle::None);
+    auto chosen = std::find_if(
+        decision.trials.begin(), decision.trials.end(), [&](auto const &t) {
+            return t.codec.toString() == decision.codec->toString();
+        });
+    REQUIRE(chosen != decision.trials.end());
+    for (auto const &trial : decision.trials)
+    {
+        REQUIRE(trial.throughput > 0);
+        REQUIRE(trial.ratio <= chosen->ratio);
+    }
+
+    // nothing to gain from compressing noise
+    advisor.objective = CodecAdvisor::Objective::Balanced;
+    decision = advisor.advise(noise.data(), noise.size(), 8);
+    REQUIRE(!decision.codec.has_value());
+    REQUIRE(decision.sampledBytes == noise.size() * 8);
+    REQUIRE(decision.toString().find("none") == 0);
+
+    advisor.minRatio = 1e6;
+    REQUIRE(!advisor.advise(smooth.data(), smooth.size(), 8)
+                 .codec.has_value());
+    REQUIRE(advisor.advise(nullptr, 0, 8).trials.empty());
+}
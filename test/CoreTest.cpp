@@ -8,9 +8,11 @@
 #include "openPMD/openPMD.hpp"
 
 #include "openPMD/IO/ADIOS/macros.hpp"
+#include "openPMD/auxiliary/BufferPool.hpp"
 #include "openPMD/auxiliary/Filesystem.hpp"
 #include "openPMD/auxiliary/JSON.hpp"
 #include "openPMD/auxiliary/UniquePtr.hpp"
+#include "openPMD/benchmark/BenchmarkResult.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -1524,3 +1526,170 @@ TEST_CASE("scalar_and_vector", "[core]")
         REQUIRE(!E.contains("x"));
     }
 }
+
+TEST_CASE("chunk_assignment", "[core]")
+{
+    using namespace chunk_assignment;
+    // writers 0 and 1 on host "a", writer 2 on host "b"
+    RankMeta writers{{0, "a"}, {1, "a"}, {2, "b"}};
+    // readers 0 and 1 on host "a", reader 2 on host "c"
+    RankMeta readers{{0, "a"}, {1, "a"}, {2, "c"}};
+    ChunkTable table{
+        WrittenChunkInfo({0, 0}, {10, 4}, 0),
+        WrittenChunkInfo({10, 0}, {10, 4}, 1),
+        WrittenChunkInfo({20, 0}, {40, 4}, 2)};
+
+    auto countElements = [](ChunkTable const &chunks) {
+        uint64_t res = 0;
+        for (auto const &chunk : chunks)
+        {
+            res += chunk.extent[0] * chunk.extent[1];
+        }
+        return res;
+    };
+    auto totalElements = [&countElements](Assignment const &assignment) {
+        uint64_t res = 0;
+        for (auto const &pair : assignment)
+        {
+            res += countElements(pair.second);
+        }
+        return res;
+    };
+
+    {
+        auto assignment = RoundRobin().assign(table, writers, readers);
+        REQUIRE(assignment.size() == 3);
+        for (auto const &pair : assignment)
+        {
+            REQUIRE(pair.second.size() == 1);
+            REQUIRE(bool(pair.second[0] == table[pair.first]));
+        }
+    }
+
+    {
+        auto assignment = BinPacking().assign(table, writers, readers);
+        REQUIRE(totalElements(assignment) == 240);
+        for (auto const &pair : assignment)
+        {
+            REQUIRE(countElements(pair.second) == 80);
+        }
+    }
+
+    {
+        FromPartialStrategy strategy(
+            std::make_unique<ByHostname>(std::make_unique<RoundRobin>()),
+            std::make_unique<BinPacking>());
+        auto assignment = strategy.assign(table, writers, readers);
+        REQUIRE(totalElements(assignment) == 240);
+        // the chunks written on host "a" stay on host "a"
+        REQUIRE(bool(assignment.at(0).front() == table[0]));
+        REQUIRE(bool(assignment.at(1).front() == table[1]));
+
+        auto partial = ByHostname(std::make_unique<RoundRobin>())
+                           .assign(table, writers, readers);
+        REQUIRE(partial.notAssigned.size() == 1);
+        REQUIRE(bool(partial.notAssigned[0] == table[2]));
+    }
+
+    {
+        ByCuboidSlice strategy(std::make_unique<OneDimensionalBlockSlicer>(0));
+        auto assignment = strategy.assign(table, writers, readers);
+        REQUIRE(totalElements(assignment) == 240);
+        REQUIRE(assignment.at(0).size() == 2);
+        REQUIRE(bool(
+            assignment.at(0)[0] == WrittenChunkInfo({0, 0}, {10, 4}, 0)));
+        REQUIRE(bool(
+            assignment.at(0)[1] == WrittenChunkInfo({10, 0}, {10, 4}, 1)));
+        REQUIRE(assignment.at(1).size() == 1);
+        REQUIRE(bool(
+            assignment.at(1)[0] == WrittenChunkInfo({20, 0}, {20, 4}, 2)));
+        REQUIRE(assignment.at(2).size() == 1);
+        REQUIRE(bool(
+            assignment.at(2)[0] == WrittenChunkInfo({40, 0}, {20, 4}, 2)));
+    }
+
+    REQUIRE_THROWS_AS(
+        RoundRobin().assign(table, writers, RankMeta{}), std::runtime_error);
+}
+
+TEST_CASE("benchmark_statistics", "[core]")
+{
+    using namespace openPMD::benchmark;
+    auto stats = Statistics::fromSamples({4., 1., 3., 2., 5.});
+    REQUIRE(stats.samples == 5);
+    REQUIRE(stats.min == 1.);
+    REQUIRE(stats.max == 5.);
+    REQUIRE(stats.mean == 3.);
+    REQUIRE(stats.median == 3.);
+    REQUIRE(stats.p90 == Approx(4.6));
+    REQUIRE(Statistics::fromSamples({}).samples == 0);
+
+    Result first;
+    first.name = "write";
+    first.parameters = {{"backend", "json"}, {"ranks", "1"}};
+    first.seconds = Statistics::fromSamples({2.});
+    first.bytes = 100;
+    Result second;
+    second.name = "read:block";
+    second.parameters = {{"backend", "json"}, {"comment", "a,b"}};
+    second.peakRSS = 4096;
+
+    std::stringstream csv;
+    writeCSV(csv, {first, second});
+    std::string line;
+    std::getline(csv, line);
+    REQUIRE(
+        line ==
+        "name,backend,comment,ranks,samples,min,max,mean,median,p90,p99,"
+        "bytes,bytes_per_second,peak_rss");
+    std::getline(csv, line);
+    REQUIRE(line == "write,json,,1,1,2,2,2,2,2,2,100,50,");
+    std::getline(csv, line);
+    REQUIRE(line == "read:block,json,\"a,b\",,0,0,0,0,0,0,0,0,0,4096");
+
+    std::stringstream jsonStream;
+    writeJSON(jsonStream, {first, second});
+    auto json = jsonStream.str();
+    REQUIRE(json.find("\"bytes_per_second\": 50.0") != std::string::npos);
+    REQUIRE(json.find("\"peak_rss\": 4096") != std::string::npos);
+    REQUIRE(json.find("\"peak_rss\": null") != std::string::npos);
+}
+
+TEST_CASE("buffer_pool", "[core]")
+{
+    using auxiliary::BufferPool;
+    BufferPool pool;
+    void *first = nullptr;
+    {
+        auto buffer = pool.acquire(100);
+        first = buffer.get();
+        REQUIRE(first != nullptr);
+    }
+    REQUIRE(pool.misses() == 1);
+    REQUIRE(pool.hits() == 0);
+    // released into the size class of 128 bytes
+    REQUIRE(pool.freeBytes() == 128);
+    {
+        // same size class, so the buffer is recycled
+        auto buffer = pool.acquire(128);
+        REQUIRE(buffer.get() == first);
+        REQUIRE(pool.freeBytes() == 0);
+        // another size class needs a new allocation
+        auto other = pool.acquire(1000);
+        REQUIRE(other.get() != first);
+    }
+    REQUIRE(pool.hits() == 1);
+    REQUIRE(pool.misses() == 2);
+    REQUIRE(pool.freeBytes() == 128 + 1024);
+
+    // buffers may outlive their pool
+    UniquePtrWithLambda<void> survivor;
+    {
+        BufferPool shortLived;
+        survivor = shortLived.acquire(10);
+    }
+    survivor.reset();
+
+    pool.clear();
+    REQUIRE(pool.freeBytes() == 0);
+}
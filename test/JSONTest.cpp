@@ -222,6 +222,30 @@ right = "val"
 }
 #endif
 
+TEST_CASE("json_parsing_cached", "[auxiliary]")
+{
+    std::string options = R"({"ADIOS2": {"engine": {"type": "bp4"}}})";
+    auto first = json::parseOptionsCached(options);
+    REQUIRE(
+        first->config.dump() ==
+        json::parseOptions(options, false).config.dump());
+    // identical strings are parsed only once and share their result
+    REQUIRE(json::parseOptionsCached(std::string(options)) == first);
+    REQUIRE(json::parseOptionsCached(R"({"adios2": {}})") != first);
+
+    auto toml = json::parseOptionsCached("[adios2.engine]\ntype = \"bp4\"");
+    REQUIRE(toml->originallySpecifiedAs == json::SupportedLanguages::TOML);
+    REQUIRE(toml->config.dump() == first->config.dump());
+
+    // tracing works on a copy, the cached value remains untouched
+    json::TracingJSON traced{*first};
+    traced["adios2"]["engine"]["type"];
+    REQUIRE(traced.invertShadow().dump() == "{}");
+    REQUIRE(json::TracingJSON{*first}.invertShadow().size() == 1);
+
+    REQUIRE_THROWS(json::parseOptionsCached("{ not json"));
+}
+
 /*
  * This tests two things about the /data/snapshot attribute:
  *
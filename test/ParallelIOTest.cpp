@@ -53,10 +53,10 @@ std::vector<std::string> testedFileExtensions()
     auto allExtensions = getFileExtensions();
     auto newEnd = std::remove_if(
         allExtensions.begin(), allExtensions.end(), [](std::string const &ext) {
-            // sst and ssc need a receiver for testing
+            // sst, ssc and shm need a receiver for testing
             // bp4 is already tested via bp
-            return ext == "sst" || ext == "ssc" || ext == "bp4" ||
-                ext == "toml" || ext == "json";
+            return ext == "sst" || ext == "ssc" || ext == "shm" ||
+                ext == "bp4" || ext == "toml" || ext == "json";
         });
     return {allExtensions.begin(), newEnd};
 }
@@ -1153,6 +1153,88 @@ TEST_CASE("hipace_like_write", "[parallel]")
         hipace_like_write(t);
     }
 }
+
+void collective_metadata(std::string const &file_ending)
+{
+    int mpi_rank{-1};
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    std::string name = "../samples/collective_metadata_%T." + file_ending;
+
+    if (mpi_rank == 0)
+    {
+        Series series(name, Access::CREATE);
+        series.setAttribute("comments", std::vector<std::string>{"a", "b"});
+        for (uint64_t step : {100, 200})
+        {
+            auto it = series.iterations[step];
+            it.setAttribute("flag", true);
+            auto E = it.meshes["E"];
+            E.setAxisLabels({"z", "x"});
+            E.setGridSpacing<double>({1.0, 2.0});
+            E.setGridGlobalOffset({0.0, 0.0});
+            for (auto const &dim : {"x", "y"})
+            {
+                E[dim].setPosition<double>({0.5, 0.0});
+                E[dim].resetDataset({Datatype::INT, {2, 3}});
+                E[dim].storeChunk(
+                    std::shared_ptr<int[]>(
+                        new int[6]{int(step), 1, 2, 3, 4, 5}),
+                    {0, 0},
+                    {2, 3});
+            }
+            auto position = it.particles["e"]["position"]["x"];
+            position.setAttribute("weights", std::vector<double>{0.5, 1.5});
+            position.makeConstant(1.5f);
+            position.resetDataset({Datatype::FLOAT, {10}});
+        }
+        series.close();
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    for (char const *config :
+         {R"({"collective_metadata": true})",
+          R"({"collective_metadata": true, "defer_iteration_parsing": true})"})
+    {
+        Series series(name, Access::READ_ONLY, MPI_COMM_WORLD, config);
+        REQUIRE(
+            series.getAttribute("comments").get<std::vector<std::string>>() ==
+            std::vector<std::string>{"a", "b"});
+        REQUIRE(series.iterations.size() == 2);
+        for (auto &[step, it] : series.iterations)
+        {
+            it.open(); // collective
+            REQUIRE(it.getAttribute("flag").get<bool>());
+            auto E = it.meshes["E"];
+            REQUIRE(E.axisLabels() == std::vector<std::string>{"z", "x"});
+            REQUIRE(E.gridSpacing<double>() == std::vector<double>{1.0, 2.0});
+            REQUIRE(E.size() == 2);
+            REQUIRE(E["y"].getDatatype() == Datatype::INT);
+            REQUIRE(E["y"].getExtent() == Extent{2, 3});
+            REQUIRE(
+                E["y"].position<double>() == std::vector<double>{0.5, 0.0});
+            auto position = it.particles["e"]["position"]["x"];
+            REQUIRE(
+                position.getAttribute("weights").get<std::vector<double>>() ==
+                std::vector<double>{0.5, 1.5});
+            REQUIRE(position.constant());
+            auto data = E["y"].loadChunk<int>();
+            auto constant = position.loadChunk<float>();
+            it.close();
+            REQUIRE(data.get()[0] == int(step));
+            REQUIRE(data.get()[5] == 5);
+            REQUIRE(constant.get()[9] == 1.5f);
+        }
+    }
+}
+
+TEST_CASE("collective_metadata", "[parallel]")
+{
+    for (auto const &t : getBackends())
+    {
+        collective_metadata(t);
+    }
+    collective_metadata("json");
+}
 #endif
 
 #if openPMD_HAVE_ADIOS2 && openPMD_HAS_ADIOS_2_9 && openPMD_HAVE_MPI
@@ -2068,10 +2150,11 @@ TEST_CASE("joined_dim", "[parallel]")
 #if 100000000 * ADIOS2_VERSION_MAJOR + 1000000 * ADIOS2_VERSION_MINOR +        \
         10000 * ADIOS2_VERSION_PATCH + 100 * ADIOS2_VERSION_TWEAK >=           \
     209000000
-    constexpr char const *supportsJoinedDims[] = {"bp", "bp4", "bp5"};
+    constexpr char const *supportsJoinedDims[] = {
+        "bp", "bp4", "bp5", "h5"};
 #else
-    // no zero-size arrays
-    std::vector<char const *> supportsJoinedDims;
+    // ADIOS2 < v2.9: no zero-size arrays
+    constexpr char const *supportsJoinedDims[] = {"h5"};
 #endif
     for (auto const &t : testedFileExtensions())
     {
@@ -13,6 +13,10 @@
 #include "openPMD/auxiliary/StringManip.hpp"
 #include "openPMD/openPMD.hpp"
 
+#if openPMD_HAVE_HDF5
+#include <hdf5.h>
+#endif
+
 #include <catch2/catch.hpp>
 
 #include <algorithm>
@@ -26,6 +30,7 @@
 #include <list>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -89,19 +94,19 @@ std::vector<std::string> testedFileExtensions()
         allExtensions.end(),
         []([[maybe_unused]] std::string const &ext) {
 #if openPMD_HAS_ADIOS_2_9
-            // sst and ssc need a receiver for testing
+            // sst, ssc and shm need a receiver for testing
             // bp5 is already tested via bp
             // toml parsing is very slow and its implementation is equivalent to
             // the json backend, so it is only activated for selected tests
-            return ext == "sst" || ext == "ssc" || ext == "bp5" ||
-                ext == "toml";
+            return ext == "sst" || ext == "ssc" || ext == "shm" ||
+                ext == "bp5" || ext == "toml";
 #else
             // toml parsing is very slow and its implementation is equivalent to
             // the json backend, so it is only activated for selected tests
-            // sst and ssc need a receiver for testing
+            // sst, ssc and shm need a receiver for testing
             // bp4 is already tested via bp
-            return ext == "sst" || ext == "ssc" || ext == "bp4" ||
-                ext == "toml";
+            return ext == "sst" || ext == "ssc" || ext == "shm" ||
+                ext == "bp4" || ext == "toml";
 #endif
         });
     return {allExtensions.begin(), newEnd};
@@ -360,6 +365,133 @@ TEST_CASE("available_chunks_test_json", "[serial][json]")
     }
 }
 
+TEST_CASE("chunk_statistics_test_json", "[serial][json]")
+{
+    std::string name = "../samples/chunk_statistics.json";
+    {
+        Series write(name, Access::CREATE);
+        Iteration it0 = write.iterations[0];
+        auto E_x = it0.meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {10}});
+        std::vector<double> low{1., 2., 3., 4.};
+        std::vector<double> high{100., 200., 300.};
+        E_x.storeChunk(low, {0}, {4});
+        E_x.storeChunk(high, {6}, {3});
+        it0.close();
+    }
+
+    {
+        Series read(name, Access::READ_ONLY);
+        Iteration it0 = read.iterations[0];
+        auto E_x = it0.meshes["E"]["x"];
+        ChunkTable table = E_x.availableChunks();
+        REQUIRE(table.size() == 2);
+        // only computed for loadChunksInRange()
+        for (auto const &chunk : table)
+        {
+            REQUIRE(!chunk.statistics.has_value());
+        }
+        REQUIRE(bool(table[0] == WrittenChunkInfo({0}, {4})));
+        REQUIRE(bool(table[1] == WrittenChunkInfo({6}, {3})));
+
+        auto hot = E_x.loadChunksInRange<double>(150., 1000.);
+        REQUIRE(hot.size() == 1);
+        auto none = E_x.loadChunksInRange<double>(5., 99.);
+        REQUIRE(none.empty());
+        // restricted to the selection
+        auto partial = E_x.loadChunksInRange<double>(0., 1000., {2}, {3});
+        REQUIRE(partial.size() == 1);
+        read.flush();
+        REQUIRE(bool(hot[0].chunk == ChunkInfo({6}, {3})));
+        REQUIRE(hot[0].data.get()[0] == 100.);
+        REQUIRE(hot[0].data.get()[2] == 300.);
+        REQUIRE(bool(partial[0].chunk == ChunkInfo({2}, {2})));
+        REQUIRE(partial[0].data.get()[0] == 3.);
+        REQUIRE(partial[0].data.get()[1] == 4.);
+    }
+}
+
+TEST_CASE("deferred_read_test_json", "[serial][json]")
+{
+    /*
+     * In read-only mode, the JSON backend does not parse the "data" arrays
+     * upon opening a file, but only the rows that a loadChunk() call hits.
+     * The large dataset spans multiple blocks, so rows are parsed in
+     * parallel where possible.
+     */
+    constexpr uint64_t height = 100000, width = 10;
+    std::string name = "../samples/deferred_read.json";
+
+    std::vector<double> large(height * width);
+    std::iota(large.begin(), large.end(), 0.);
+    std::vector<std::complex<double>> cplx{{1., -1.}, {2., -2.}, {3., -3.}};
+    {
+        Series write(name, Access::CREATE);
+        Iteration it0 = write.iterations[0];
+        it0.setAttribute("data", "an attribute named like a dataset");
+        auto E_x = it0.meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {height, width}});
+        E_x.storeChunk(large, {0, 0}, {height, width});
+        auto E_y = it0.meshes["E"]["y"];
+        E_y.resetDataset({Datatype::CDOUBLE, {3}});
+        E_y.storeChunk(cplx, {0}, {3});
+        auto E_z = it0.meshes["E"]["z"];
+        E_z.resetDataset({Datatype::INT, {0}});
+        auto B_x = it0.meshes["B"]["x"];
+        B_x.resetDataset({Datatype::CDOUBLE, {5}});
+        B_x.storeChunk(cplx, {1}, {3});
+        it0.close();
+    }
+
+    {
+        Series read(name, Access::READ_ONLY);
+        Iteration it0 = read.iterations[0];
+        REQUIRE(
+            it0.getAttribute("data").get<std::string>() ==
+            "an attribute named like a dataset");
+        auto E_x = it0.meshes["E"]["x"];
+        REQUIRE(E_x.getExtent() == Extent{height, width});
+        ChunkTable table = E_x.availableChunks();
+        REQUIRE(table.size() == 1);
+        REQUIRE(bool(table[0] == WrittenChunkInfo({0, 0}, {height, width})));
+
+        auto rows = E_x.loadChunk<double>({50000, 3}, {2, 4});
+        auto all = E_x.loadChunk<double>();
+        auto E_y = it0.meshes["E"]["y"];
+        REQUIRE(E_y.getExtent() == Extent{3});
+        table = E_y.availableChunks();
+        REQUIRE(table.size() == 1);
+        REQUIRE(bool(table[0] == WrittenChunkInfo({0}, {3})));
+        auto B_x = it0.meshes["B"]["x"];
+        REQUIRE(B_x.getExtent() == Extent{5});
+        table = B_x.availableChunks();
+        REQUIRE(table.size() == 1);
+        REQUIRE(bool(table[0] == WrittenChunkInfo({1}, {3})));
+        auto complexValues = E_y.loadChunk<std::complex<double>>({1}, {2});
+        REQUIRE(it0.meshes["E"]["z"].getExtent() == Extent{0});
+        read.flush();
+
+        std::vector<double> expected{
+            500003., 500004., 500005., 500006., 500013., 500014., 500015., 500016.};
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            REQUIRE(rows.get()[i] == expected[i]);
+        }
+        REQUIRE(std::equal(large.begin(), large.end(), all.get()));
+        REQUIRE(complexValues.get()[0] == cplx[1]);
+        REQUIRE(complexValues.get()[1] == cplx[2]);
+    }
+
+    // the file is left untouched by read-only access
+    {
+        Series read(name, Access::READ_ONLY);
+        auto E_x = read.iterations[0].meshes["E"]["x"];
+        auto last = E_x.loadChunk<double>({height - 1, width - 1}, {1, 1});
+        read.flush();
+        REQUIRE(*last == double(height * width - 1));
+    }
+}
+
 TEST_CASE("multiple_series_handles_test", "[serial]")
 {
     /*
@@ -1844,6 +1976,13 @@ inline void fileBased_write_test(const std::string &backend)
 #endif
     if (auxiliary::directory_exists("../samples/subdir"))
         auxiliary::remove_directory("../samples/subdir");
+    // the MEMORY backend writes nothing to disk
+    auto written = [&backend](std::string const &iteration) {
+        auto file = "../samples/subdir/serial_fileBased_write" + iteration +
+            "." + backend;
+        return backend == "mem" || auxiliary::file_exists(file) ||
+            auxiliary::directory_exists(file);
+    };
 
     {
         Series o = Series(
@@ -1949,21 +2088,9 @@ inline void fileBased_write_test(const std::string &backend)
         o.flush();
         o.iterations[5].setTime(static_cast<double>(5));
     }
-    REQUIRE(
-        (auxiliary::file_exists(
-             "../samples/subdir/serial_fileBased_write001." + backend) ||
-         auxiliary::directory_exists(
-             "../samples/subdir/serial_fileBased_write001." + backend)));
-    REQUIRE(
-        (auxiliary::file_exists(
-             "../samples/subdir/serial_fileBased_write002." + backend) ||
-         auxiliary::directory_exists(
-             "../samples/subdir/serial_fileBased_write002." + backend)));
-    REQUIRE(
-        (auxiliary::file_exists(
-             "../samples/subdir/serial_fileBased_write003." + backend) ||
-         auxiliary::directory_exists(
-             "../samples/subdir/serial_fileBased_write003." + backend)));
+    REQUIRE(written("001"));
+    REQUIRE(written("002"));
+    REQUIRE(written("003"));
 
     {
         Series o = Series(
@@ -2074,16 +2201,8 @@ inline void fileBased_write_test(const std::string &backend)
         o.flush();
         REQUIRE(o.iterations.size() == 7);
     }
-    REQUIRE(
-        (auxiliary::file_exists(
-             "../samples/subdir/serial_fileBased_write004." + backend) ||
-         auxiliary::directory_exists(
-             "../samples/subdir/serial_fileBased_write004." + backend)));
-    REQUIRE(
-        (auxiliary::file_exists(
-             "../samples/subdir/serial_fileBased_write123456." + backend) ||
-         auxiliary::directory_exists(
-             "../samples/subdir/serial_fileBased_write123456." + backend)));
+    REQUIRE(written("004"));
+    REQUIRE(written("123456"));
 
     // additional iteration with shorter iteration padding but similar content
     {
@@ -2112,11 +2231,7 @@ inline void fileBased_write_test(const std::string &backend)
 
         REQUIRE(o.iterations.size() == 2);
     }
-    REQUIRE(
-        (auxiliary::file_exists(
-             "../samples/subdir/serial_fileBased_write10." + backend) ||
-         auxiliary::directory_exists(
-             "../samples/subdir/serial_fileBased_write10." + backend)));
+    REQUIRE(written("10"));
 
     // read back with auto-detection and non-fixed padding
     {
@@ -2700,6 +2815,374 @@ TEST_CASE("available_chunks_test_hdf5", "[serial][json]")
     }
 }
 
+TEST_CASE("hdf5_decomposition_chunking", "[serial][hdf5]")
+{
+    std::string name = "../samples/decomposition_chunking.h5";
+    constexpr unsigned height = 12;
+    constexpr unsigned width = 30;
+
+    std::vector<double> block(4 * width);
+    std::iota(block.begin(), block.end(), 0.);
+    {
+        Series write(name, Access::CREATE);
+        Iteration it0 = write.iterations[0];
+
+        // decomposition inferred from the chunks stored before first flush
+        auto E_x = it0.meshes["E"]["x"];
+        Dataset ds{Datatype::DOUBLE, {height, width}};
+        ds.options = R"(
+        {
+          "hdf5": {
+            "dataset": {
+              "chunks": "decomposition",
+              "decomposition": {
+                "chunk_size_window": [64, 512]
+              }
+            }
+          }
+        })";
+        E_x.resetDataset(ds);
+        for (unsigned row = 0; row < height; row += 4)
+        {
+            E_x.storeChunk(block, {row, 0}, {4, width});
+        }
+
+        // decomposition given explicitly
+        auto E_y = it0.meshes["E"]["y"];
+        ds.options = R"(
+        {
+          "hdf5": {
+            "dataset": {
+              "chunks": "decomposition",
+              "decomposition": {
+                "block": [4, 15],
+                "slice_axis": 0
+              }
+            }
+          }
+        })";
+        E_y.resetDataset(ds);
+        for (unsigned row = 0; row < height; row += 4)
+        {
+            E_y.storeChunk(block, {row, 0}, {4, width});
+        }
+
+        // uneven decomposition, aligned chunks would be single rows
+        auto rho = it0.meshes["rho"][RecordComponent::SCALAR];
+        ds = Dataset{Datatype::DOUBLE, {1000, 8}};
+        ds.options = R"(
+        {
+          "hdf5": {
+            "dataset": {
+              "chunks": "decomposition",
+              "decomposition": {
+                "chunk_size_window": [4096, 65536]
+              }
+            }
+          }
+        })";
+        rho.resetDataset(ds);
+        std::vector<double> rows(334 * 8, 1.);
+        rho.storeChunk(rows, {0, 0}, {333, 8});
+        rho.storeChunk(rows, {333, 0}, {333, 8});
+        rho.storeChunk(rows, {666, 0}, {334, 8});
+
+        it0.close();
+    }
+
+    auto chunkDims = [&name](char const *path) {
+        hid_t file = H5Fopen(name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+        hid_t dataset = H5Dopen(file, path, H5P_DEFAULT);
+        hid_t plist = H5Dget_create_plist(dataset);
+        std::vector<hsize_t> res(2);
+        int ndims = H5Pget_chunk(plist, 2, res.data());
+        H5Pclose(plist);
+        H5Dclose(dataset);
+        H5Fclose(file);
+        REQUIRE(ndims == 2);
+        return res;
+    };
+    // [4, 30] shrunk below 512 bytes by divisors of the block extent
+    REQUIRE(chunkDims("/data/0/meshes/E/x") == std::vector<hsize_t>{4, 15});
+    // [1, 15] is below the default window, so whole rows are used
+    REQUIRE(chunkDims("/data/0/meshes/E/y") == std::vector<hsize_t>{1, 30});
+    // alignment dropped along the rows, one chunk within the window
+    REQUIRE(chunkDims("/data/0/meshes/rho") == std::vector<hsize_t>{1000, 8});
+
+    {
+        Series read(name, Access::READ_ONLY);
+        Iteration it0 = read.iterations[0];
+        for (auto component : {"x", "y"})
+        {
+            auto data = it0.meshes["E"][component].loadChunk<double>();
+            read.flush();
+            for (unsigned row = 0; row < height; ++row)
+            {
+                for (unsigned col = 0; col < width; ++col)
+                {
+                    REQUIRE(
+                        data.get()[row * width + col] ==
+                        block[(row % 4) * width + col]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("hdf5_chunk_cache_and_page_buffer", "[serial][hdf5]")
+{
+    std::string name = "../samples/chunk_cache.h5";
+    constexpr unsigned height = 64;
+    constexpr unsigned width = 50;
+
+    std::vector<double> data(height * width);
+    std::iota(data.begin(), data.end(), 0.);
+    {
+        Series write(name, Access::CREATE, R"(
+        {
+          "hdf5": {
+            "page_buffer": {
+              "size": 1048576,
+              "page_size": 65536
+            }
+          }
+        })");
+        Iteration it0 = write.iterations[0];
+        auto E_x = it0.meshes["E"]["x"];
+        Dataset ds{Datatype::DOUBLE, {height, width}};
+        ds.options = R"(
+        {
+          "hdf5": {
+            "dataset": {
+              "chunks": [8, 10],
+              "chunk_cache": {
+                "size": 65536,
+                "slots": "auto",
+                "policy": 1
+              }
+            }
+          }
+        })";
+        E_x.resetDataset(ds);
+        for (unsigned row = 0; row < height; row += 8)
+        {
+            E_x.storeChunk(data, {row, 0}, {8, width});
+        }
+        it0.close();
+    }
+
+    auto checkRows = [&](std::string const &config) {
+        Series read(name, Access::READ_ONLY, config);
+        auto E_x = read.iterations[0].meshes["E"]["x"];
+        // several loads of the same chunks within one flush
+        std::vector<std::shared_ptr<double>> rows;
+        for (unsigned row = 0; row < height; ++row)
+        {
+            rows.push_back(E_x.loadChunk<double>({row, 0}, {1, width}));
+        }
+        read.flush();
+        for (unsigned row = 0; row < height; ++row)
+        {
+            REQUIRE(std::equal(
+                rows[row].get(),
+                rows[row].get() + width,
+                data.begin() + (row % 8) * width));
+        }
+        // the cache outlives the flush
+        for (unsigned row = 0; row < height; ++row)
+        {
+            auto loaded = E_x.loadChunk<double>({row, 0}, {1, width});
+            read.flush();
+            REQUIRE(std::equal(
+                loaded.get(),
+                loaded.get() + width,
+                data.begin() + (row % 8) * width));
+        }
+    };
+    checkRows(R"({"hdf5": {"dataset": {"chunk_cache": "auto"}}})");
+    checkRows(R"({"hdf5": {"dataset": {"chunk_cache": {"max_size": 1}}}})");
+    checkRows(R"({"hdf5": {"page_buffer": {"size": 131072}}})");
+
+    // dataset handles kept open for their cache stay within a total budget
+    {
+        Series write("../samples/chunk_cache_budget.h5", Access::CREATE);
+        auto E = write.iterations[0].meshes["E"];
+        for (auto const &component : {"w", "x", "y", "z"})
+        {
+            E[component].resetDataset({Datatype::DOUBLE, {height, width}});
+            E[component].storeChunk(data, {0, 0}, {height, width});
+        }
+    }
+    auto openDatasetsAfterReading = [&](std::string const &config) {
+        Series read(
+            "../samples/chunk_cache_budget.h5", Access::READ_ONLY, config);
+        auto E = read.iterations[0].meshes["E"];
+        for (auto const &component : {"w", "x", "y", "z"})
+        {
+            auto loaded = E[component].loadChunk<double>({1, 0}, {1, width});
+            read.flush();
+            REQUIRE(std::equal(
+                loaded.get(), loaded.get() + width, data.begin() + width));
+        }
+        return H5Fget_obj_count(H5F_OBJ_ALL, H5F_OBJ_DATASET);
+    };
+    REQUIRE(
+        openDatasetsAfterReading(
+            R"({"hdf5": {"dataset": {"chunk_cache": {"size": 65536}}}})") ==
+        4);
+    REQUIRE(
+        openDatasetsAfterReading(R"(
+        {"hdf5": {"dataset": {"chunk_cache": {
+          "size": 65536,
+          "total_max_size": 131072
+        }}}})") == 2);
+
+    // files written without paged allocation are opened without page buffer
+    {
+        Series write("../samples/no_page_buffer.h5", Access::CREATE);
+        write.iterations[0].setAttribute("some_attribute", 1);
+    }
+    {
+        Series read(
+            "../samples/no_page_buffer.h5",
+            Access::READ_ONLY,
+            R"({"hdf5": {"page_buffer": {"size": 131072}}})");
+        REQUIRE(
+            read.iterations[0].getAttribute("some_attribute").get<int>() == 1);
+    }
+
+    REQUIRE_THROWS_AS(
+        Series(
+            name,
+            Access::READ_ONLY,
+            R"({"hdf5": {"dataset": {"chunk_cache": {"policy": 2}}}})"),
+        error::BackendConfigSchema);
+    REQUIRE_THROWS_AS(
+        Series(
+            name,
+            Access::READ_ONLY,
+            R"({"hdf5": {"page_buffer": {"size": 1024, "page_size": 4096}}})"),
+        error::BackendConfigSchema);
+}
+
+TEST_CASE("hdf5_attribute_batching", "[serial][hdf5]")
+{
+    std::string name = "../samples/attribute_batching.h5";
+    {
+        Series write(name, Access::CREATE);
+        Iteration it0 = write.iterations[0];
+        // overwritten within one flush, the last value wins
+        it0.setAttribute("changing", 1);
+        it0.setAttribute("changing", 2);
+        it0.setAttribute("unchanged", std::string("constant"));
+        it0.setAttribute("removed", 1.5);
+        write.flush();
+
+        // rewriting an identical value is skipped in the backend
+        it0.setAttribute("unchanged", std::string("constant"));
+        it0.setAttribute("changing", 5);
+        it0.deleteAttribute("removed");
+        write.flush();
+    }
+    {
+        Series read(name, Access::READ_WRITE);
+        Iteration it0 = read.iterations[0];
+        REQUIRE(!it0.containsAttribute("removed"));
+        REQUIRE(
+            it0.getAttribute("unchanged").get<std::string>() == "constant");
+        REQUIRE(it0.getAttribute("changing").get<int>() == 5);
+        it0.setAttribute("changing", 3);
+        read.flush();
+    }
+    {
+        Series read(name, Access::READ_ONLY);
+        REQUIRE(
+            read.iterations[0].getAttribute("changing").get<int>() == 3);
+    }
+}
+
+#if openPMD_USE_INVASIVE_TESTS
+TEST_CASE("hdf5_attribute_deduplication", "[serial][hdf5]")
+{
+    std::string name = "../samples/attribute_deduplication.h5";
+    // access the attribute behind the back of the openPMD-api
+    auto rawAttribute = [&name](std::optional<int> overwrite = std::nullopt) {
+        hid_t file = H5Fopen(
+            name.c_str(),
+            overwrite.has_value() ? H5F_ACC_RDWR : H5F_ACC_RDONLY,
+            H5P_DEFAULT);
+        int value = 0;
+        if (overwrite.has_value())
+        {
+            value = *overwrite;
+            REQUIRE(
+                H5Adelete_by_name(file, "/data/0", "value", H5P_DEFAULT) >= 0);
+            hid_t space = H5Screate(H5S_SCALAR);
+            hid_t attr = H5Acreate_by_name(
+                file,
+                "/data/0",
+                "value",
+                H5T_NATIVE_INT,
+                space,
+                H5P_DEFAULT,
+                H5P_DEFAULT,
+                H5P_DEFAULT);
+            REQUIRE(H5Awrite(attr, H5T_NATIVE_INT, &value) >= 0);
+            H5Aclose(attr);
+            H5Sclose(space);
+        }
+        else
+        {
+            hid_t attr = H5Aopen_by_name(
+                file, "/data/0", "value", H5P_DEFAULT, H5P_DEFAULT);
+            REQUIRE(H5Aread(attr, H5T_NATIVE_INT, &value) >= 0);
+            H5Aclose(attr);
+        }
+        H5Fclose(file);
+        return value;
+    };
+
+    Series write(name, Access::CREATE);
+    Iteration it0 = write.iterations[0];
+    it0.setAttribute("value", 1);
+    write.flush();
+    REQUIRE(rawAttribute() == 1);
+
+    // the frontend collapses repeated setAttribute() calls, so issue the
+    // WRITE_ATT tasks directly
+    auto writeValue = [&write, &it0](int value) {
+        Parameter<Operation::WRITE_ATT> writeAttribute;
+        writeAttribute.name = "value";
+        writeAttribute.dtype = Datatype::INT;
+        writeAttribute.resource = value;
+        write.IOHandler()->enqueue(IOTask(&it0, writeAttribute));
+    };
+
+    // the last of both writes is identical to the value written before,
+    // so nothing reaches the file
+    rawAttribute(7);
+    writeValue(2);
+    writeValue(1);
+    write.IOHandler()->flush({FlushLevel::InternalFlush});
+    REQUIRE(rawAttribute() == 7);
+
+    writeValue(2);
+    writeValue(2);
+    write.IOHandler()->flush({FlushLevel::InternalFlush});
+    REQUIRE(rawAttribute() == 2);
+
+    // once the Iteration is closed, the next flush that writes attributes
+    // drops what the backend remembers about it
+    it0.close();
+    write.iterations[1].setAttribute("value", 1);
+    write.flush();
+    rawAttribute(7);
+    writeValue(2);
+    write.IOHandler()->flush({FlushLevel::InternalFlush});
+    REQUIRE(rawAttribute() == 2);
+}
+#endif
+
 TEST_CASE("optional_paths_110_test", "[serial]")
 {
     optional_paths_110_test("h5"); // samples only present for hdf5
@@ -5694,6 +6177,69 @@ TEST_CASE("adios2_group_table", "[serial]")
     adios2_group_table(noGroupTable, useGroupTable, false);
     adios2_group_table(useGroupTable, noGroupTable, false);
     adios2_group_table(noGroupTable, noGroupTable, false);
+    std::string deltaGroupTable = R"(
+adios2.use_group_table = true
+adios2.delta_metadata = true)";
+    adios2_group_table(deltaGroupTable, useGroupTable, true);
+}
+
+TEST_CASE("adios2_delta_metadata", "[serial][adios2]")
+{
+    std::string name = "../samples/delta_metadata.bp";
+    constexpr size_t steps = 6;
+    {
+        Series write(
+            name,
+            Access::CREATE,
+            R"({"iteration_encoding": "variable_based",
+                "adios2": {"delta_metadata": true}})");
+        for (size_t step = 0; step < steps; ++step)
+        {
+            auto iteration = write.writeIterations()[step];
+            // changes every other step, stays the same in between
+            iteration.setAttribute("slow", step / 2);
+            iteration.setAttribute("constant", std::string("unchanged"));
+            iteration.meshes["E"].setAttribute("step", step);
+            auto E_x = iteration.meshes["E"]["x"];
+            E_x.resetDataset({Datatype::INT, {1}});
+            E_x.makeConstant(int(step));
+            // group present only in odd steps
+            if (step % 2 == 1)
+            {
+                auto B_x = iteration.meshes["B"]["x"];
+                B_x.resetDataset({Datatype::INT, {1}});
+                B_x.makeConstant(int(step));
+            }
+            iteration.close();
+        }
+    }
+
+    REQUIRE_THROWS_AS(
+        Series(
+            name, Access::READ_LINEAR, R"({"adios2": {"delta_metadata": 1}})"),
+        error::BackendConfigSchema);
+
+    Series read(
+        name, Access::READ_LINEAR, R"({"adios2": {"use_group_table": true}})");
+    size_t seen = 0;
+    // NOLINTNEXTLINE(performance-for-range-copy)
+    for (auto iteration : read.readIterations())
+    {
+        auto step = iteration.iterationIndex;
+        REQUIRE(step == seen);
+        REQUIRE(iteration.getAttribute("slow").get<size_t>() == step / 2);
+        REQUIRE(
+            iteration.getAttribute("constant").get<std::string>() ==
+            "unchanged");
+        REQUIRE(
+            iteration.meshes["E"].getAttribute("step").get<size_t>() == step);
+        REQUIRE(iteration.meshes.contains("B") == (step % 2 == 1));
+        auto E_x = iteration.meshes["E"]["x"].loadChunk<int>();
+        iteration.seriesFlush();
+        REQUIRE(E_x.get()[0] == int(step));
+        ++seen;
+    }
+    REQUIRE(seen == steps);
 }
 
 void variableBasedSeries(std::string const &file)
@@ -6213,11 +6759,9 @@ void iterate_nonstreaming_series(
                     return std::shared_ptr<int>{
                         new int[size], [](auto *ptr) { delete[] ptr; }};
                 });
-            if (writeSeries.backend() == "ADIOS2")
-            {
-                // that backend must support span creation
-                REQUIRE(taskSupportedByBackend);
-            }
+            // all backends tested here must support span creation,
+            // HDF5 and JSON serve it from a pool of staging buffers
+            REQUIRE(taskSupportedByBackend);
             auto span = memoryView.currentBuffer();
             for (size_t j = 0; j < span.size(); ++j)
             {
@@ -6425,6 +6969,68 @@ TEST_CASE("adios2_bp5_no_steps", "[serial][adios2]")
 }
 #endif
 
+#if openPMD_HAVE_ADIOS2
+void adios2_chunk_statistics(bool withStatistics)
+{
+    std::string name = std::string("../samples/adios2_chunk_statistics_") +
+        (withStatistics ? "on" : "off") + ".bp";
+    std::string config = withStatistics
+        ? R"({"adios2": {"engine": {"parameters": {"StatsLevel": "1"}}}})"
+        : R"({"adios2": {"engine": {"parameters": {"StatsLevel": "0"}}}})";
+    {
+        Series write(name, Access::CREATE, config);
+        auto E_x = write.iterations[0].meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {10}});
+        std::vector<double> low{1., 2., 3., 4., 5.};
+        std::vector<double> high{100., 200., 300., 400., 500.};
+        E_x.storeChunk(low, {0}, {5});
+        E_x.storeChunk(high, {5}, {5});
+        write.close();
+    }
+
+    Series read(name, Access::READ_ONLY);
+    auto E_x = read.iterations[0].meshes["E"]["x"];
+    ChunkTable table = E_x.availableChunks();
+    REQUIRE(table.size() == 2);
+    std::sort(table.begin(), table.end(), [](auto const &l, auto const &r) {
+        return l.offset < r.offset;
+    });
+    if (withStatistics)
+    {
+        REQUIRE(table[0].statistics.has_value());
+        REQUIRE(table[0].statistics->min == 1.);
+        REQUIRE(table[0].statistics->max == 5.);
+        REQUIRE(table[1].statistics->min == 100.);
+        REQUIRE(table[1].statistics->max == 500.);
+    }
+    else
+    {
+        // blocks written without statistics report min == max == 0
+        for (auto const &chunk : table)
+        {
+            REQUIRE(!chunk.statistics.has_value());
+        }
+    }
+
+    auto hot = E_x.loadChunksInRange<double>(150., 1000.);
+    read.flush();
+    // without statistics, no chunk may be skipped
+    REQUIRE(hot.size() == (withStatistics ? 1 : 2));
+    auto highChunk =
+        std::find_if(hot.begin(), hot.end(), [](auto const &selected) {
+            return selected.chunk.offset == Offset{5};
+        });
+    REQUIRE(highChunk != hot.end());
+    REQUIRE(highChunk->data.get()[4] == 500.);
+}
+
+TEST_CASE("adios2_chunk_statistics", "[serial][adios2]")
+{
+    adios2_chunk_statistics(/* withStatistics = */ true);
+    adios2_chunk_statistics(/* withStatistics = */ false);
+}
+#endif
+
 void extendDataset(std::string const &ext, std::string const &jsonConfig)
 {
     std::string filename = "../samples/extendDataset." + ext;
@@ -6705,21 +7311,426 @@ TEST_CASE("deferred_parsing", "[serial]")
     }
 }
 
-#if openPMD_HAS_ADIOS_2_9
-void chaotic_stream(std::string const &filename, bool variableBased)
+void prefetch_iterations(std::string const &extension)
 {
-    /*
-     * We will write iterations in the following order.
-     */
-    std::vector<uint64_t> iterations{5, 9, 1, 3, 4, 6, 7, 8, 2, 0};
-    std::string jsonConfig = R"(
-{
-    "adios2": {
-        "use_group_table": true
+    std::string const basename =
+        "../samples/prefetch_iterations/prefetch_%T." + extension;
+    {
+        Series series(basename, Access::CREATE);
+        std::vector<int> buffer(10);
+        for (unsigned i = 0; i < 5; ++i)
+        {
+            std::iota(buffer.begin(), buffer.end(), int(10 * i));
+            auto dataset = series.iterations[i].meshes["E"]["x"];
+            dataset.resetDataset({Datatype::INT, {10}});
+            dataset.storeChunk(buffer, {0}, {10});
+            series.iterations[i].close();
+        }
     }
-})";
-
-    bool weirdOrderWhenReading{};
+    for (auto access : {Access::READ_ONLY, Access::READ_LINEAR})
+    {
+        Series series(
+            basename,
+            access,
+            R"({"defer_iteration_parsing": true, "prefetch_iterations": 2})");
+        unsigned expectedIndex = 0;
+        for (auto iteration : series.readIterations())
+        {
+            REQUIRE(iteration.iterationIndex == expectedIndex);
+            auto dataset =
+                iteration.meshes["E"]["x"].loadChunk<int>({0}, {10});
+            iteration.close();
+            for (int i = 0; i < 10; ++i)
+            {
+                REQUIRE(dataset.get()[i] == int(10 * expectedIndex) + i);
+            }
+            ++expectedIndex;
+        }
+        REQUIRE(expectedIndex == 5);
+    }
+}
+
+TEST_CASE("prefetch_iterations", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        prefetch_iterations(t);
+    }
+}
+
+void load_chunk_view(std::string const &extension)
+{
+    std::string const filename =
+        "../samples/load_chunk_view/load_chunk_view." + extension;
+    std::vector<int> buffer(6 * 8);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    {
+        Series series(filename, Access::CREATE);
+        auto E_x = series.iterations[0].meshes["E"]["x"];
+        Dataset ds{Datatype::INT, {6, 8}};
+        // contiguous layout, so HDF5 can map the dataset into memory
+        ds.options = R"({"hdf5": {"dataset": {"chunks": "none"}}})";
+        E_x.resetDataset(ds);
+        E_x.storeChunk(buffer, {0, 0}, {6, 8});
+        auto E_y = series.iterations[0].meshes["E"]["y"];
+        E_y.resetDataset(ds);
+        E_y.makeConstant(42);
+        series.close();
+    }
+
+    Series series(filename, Access::READ_ONLY);
+    auto E_x = series.iterations[0].meshes["E"]["x"];
+    bool expectZeroCopy = extension == "h5" || extension == "mem";
+
+    auto full = E_x.loadChunkView<int>();
+    REQUIRE(full.zeroCopy() == expectZeroCopy);
+    auto fullSpan = full.currentBuffer();
+    REQUIRE(fullSpan.size() == 48);
+    REQUIRE(std::equal(fullSpan.begin(), fullSpan.end(), buffer.begin()));
+
+    // rows 2 and 3, contiguous in memory
+    auto rows = E_x.loadChunkView<int>({2, 0}, {2, 8});
+    REQUIRE(rows.zeroCopy() == expectZeroCopy);
+    auto rowsSpan = rows.currentBuffer();
+    REQUIRE(rowsSpan.size() == 16);
+    for (size_t i = 0; i < 16; ++i)
+    {
+        REQUIRE(rowsSpan[i] == int(16 + i));
+    }
+
+    // not contiguous in memory, always served by a copy
+    auto block = E_x.loadChunkView<int>({1, 2}, {2, 3});
+    REQUIRE(!block.zeroCopy());
+    auto blockSpan = block.currentBuffer();
+    REQUIRE(blockSpan.size() == 6);
+    for (size_t row = 0; row < 2; ++row)
+    {
+        for (size_t col = 0; col < 3; ++col)
+        {
+            REQUIRE(blockSpan[3 * row + col] == int(8 * (1 + row) + 2 + col));
+        }
+    }
+
+    auto constant = series.iterations[0].meshes["E"]["y"].loadChunkView<int>(
+        {0, 0}, {1, 8});
+    REQUIRE(!constant.zeroCopy());
+    for (auto value : constant.currentBuffer())
+    {
+        REQUIRE(value == 42);
+    }
+}
+
+TEST_CASE("load_chunk_view", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        load_chunk_view(t);
+    }
+}
+
+void load_time_series(std::string const &filename)
+{
+    constexpr size_t numIterations = 5;
+    auto valueAt = [](size_t iteration, size_t row, size_t col) {
+        return double(100 * iteration + 10 * row + col);
+    };
+    {
+        Series series(filename, Access::CREATE);
+        for (size_t i = 0; i < numIterations; ++i)
+        {
+            auto iteration = series.iterations[i];
+            std::vector<double> data(4 * 5);
+            for (size_t row = 0; row < 4; ++row)
+            {
+                for (size_t col = 0; col < 5; ++col)
+                {
+                    data[5 * row + col] = valueAt(i, row, col);
+                }
+            }
+            auto E_x = iteration.meshes["E"]["x"];
+            E_x.resetDataset({Datatype::DOUBLE, {4, 5}});
+            E_x.storeChunk(data, {0, 0}, {4, 5});
+
+            auto rho = iteration.meshes["rho"];
+            rho.resetDataset({Datatype::INT, {4, 5}});
+            rho.makeConstant(int(i));
+
+            std::vector<float> positions{
+                float(i), float(i) + 0.5f, float(i) + 1.f};
+            auto position_x = iteration.particles["e"]["position"]["x"];
+            position_x.resetDataset({Datatype::FLOAT, {3}});
+            position_x.storeChunk(positions, {0}, {3});
+
+            // '~' is an escape character in JSON pointers
+            auto tilde = iteration.meshes["B~1"]["x"];
+            tilde.resetDataset({Datatype::FLOAT, {3}});
+            tilde.storeChunk(positions, {0}, {3});
+            iteration.close();
+        }
+    }
+
+    for (auto const &config :
+         {R"({"defer_iteration_parsing": true})",
+          R"({"defer_iteration_parsing": false})"})
+    {
+        Series series(filename, Access::READ_RANDOM_ACCESS, config);
+
+        auto box = series.loadTimeSeries<double>("meshes/E/x", {1, 2}, {2, 2});
+        for (size_t i = 0; i < numIterations; ++i)
+        {
+            for (size_t row = 0; row < 2; ++row)
+            {
+                for (size_t col = 0; col < 2; ++col)
+                {
+                    REQUIRE(
+                        box.get()[4 * i + 2 * row + col] ==
+                        valueAt(i, 1 + row, 2 + col));
+                }
+            }
+        }
+
+        auto probe = series.loadTimeSeries<int>(
+            "meshes/rho", {3, 4}, {1, 1}, {4, 0, 2});
+        REQUIRE(probe.get()[0] == 4);
+        REQUIRE(probe.get()[1] == 0);
+        REQUIRE(probe.get()[2] == 2);
+
+        auto positions = series.loadTimeSeries<float>(
+            "particles/e/position/x", {1}, {1}, {1, 3});
+        REQUIRE(positions.get()[0] == 1.5f);
+        REQUIRE(positions.get()[1] == 3.5f);
+
+        auto tilde =
+            series.loadTimeSeries<float>("meshes/B~1/x", {2}, {1}, {0, 4});
+        REQUIRE(tilde.get()[0] == 1.f);
+        REQUIRE(tilde.get()[1] == 5.f);
+
+        REQUIRE_THROWS_AS(
+            series.loadTimeSeries<double>("E/x", {0, 0}, {1, 1}),
+            error::WrongAPIUsage);
+        REQUIRE_THROWS_AS(
+            series.loadTimeSeries<double>("meshes/E/x", {0, 0}, {1, 1}, {7}),
+            error::WrongAPIUsage);
+    }
+}
+
+TEST_CASE("load_time_series", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        load_time_series("../samples/load_time_series/groupbased." + t);
+        load_time_series("../samples/load_time_series/filebased_%T." + t);
+    }
+}
+
+#if openPMD_HAVE_SHM
+TEST_CASE("shm_stream", "[serial][shm]")
+{
+    constexpr size_t numSteps = 5;
+    std::string const filename = "../samples/shm_stream.shm";
+
+    std::thread writer([&filename]() {
+        Series series(
+            filename, Access::CREATE, R"({"shm": {"queue_limit": 1}})");
+        for (size_t step = 0; step < numSteps; ++step)
+        {
+            auto iteration = series.writeIterations()[step];
+            iteration.setAttribute("step", step);
+
+            std::vector<int> data(10);
+            std::iota(data.begin(), data.end(), int(10 * step));
+            auto E_x = iteration.meshes["E"]["x"];
+            E_x.resetDataset({Datatype::INT, {2, 10}});
+            E_x.storeChunk(data, {0, 0}, {1, 10});
+            auto span = E_x.storeChunk<int>({1, 0}, {1, 10}).currentBuffer();
+            std::iota(span.begin(), span.end(), int(10 * step + 100));
+
+            iteration.close();
+        }
+    });
+
+    {
+        Series series(filename, Access::READ_LINEAR);
+        size_t expectedStep = 0;
+        for (auto iteration : series.readIterations())
+        {
+            REQUIRE(iteration.iterationIndex == expectedStep);
+            REQUIRE(
+                iteration.getAttribute("step").get<size_t>() == expectedStep);
+
+            auto E_x = iteration.meshes["E"]["x"];
+            REQUIRE(E_x.getExtent() == Extent{2, 10});
+            REQUIRE(E_x.availableChunks().size() == 2);
+
+            auto loaded = E_x.loadChunk<int>({0, 5}, {2, 2});
+            auto view = E_x.loadChunkView<int>({1, 0}, {1, 10});
+            iteration.seriesFlush();
+            for (size_t row = 0; row < 2; ++row)
+            {
+                for (size_t col = 0; col < 2; ++col)
+                {
+                    REQUIRE(
+                        loaded.get()[2 * row + col] ==
+                        int(10 * expectedStep + 100 * row + 5 + col));
+                }
+            }
+            REQUIRE(view.zeroCopy());
+            auto viewSpan = view.currentBuffer();
+            for (size_t col = 0; col < 10; ++col)
+            {
+                REQUIRE(viewSpan[col] == int(10 * expectedStep + 100 + col));
+            }
+
+            iteration.close();
+            ++expectedStep;
+        }
+        REQUIRE(expectedStep == numSteps);
+    }
+    writer.join();
+
+    // a writer with a full queue does not wait forever for a reader
+    {
+        Series series(
+            "../samples/shm_stream_no_reader.shm",
+            Access::CREATE,
+            R"({"shm": {"queue_limit": 1, "open_timeout": 0.1}})");
+        auto start = std::chrono::steady_clock::now();
+        for (size_t step = 0; step < numSteps; ++step)
+        {
+            auto iteration = series.writeIterations()[step];
+            iteration.setAttribute("step", step);
+            iteration.close();
+        }
+        series.close();
+        // the timeout is waited for only once
+        REQUIRE(
+            std::chrono::steady_clock::now() - start <
+            std::chrono::seconds(5));
+    }
+}
+#endif
+
+TEST_CASE("memory_backend", "[serial][memory]")
+{
+    std::string const filename = "../samples/memory_backend/data.mem";
+    std::vector<double> rows(20);
+    std::iota(rows.begin(), rows.end(), 0.);
+
+    {
+        Series series(filename, Access::CREATE);
+        auto iteration = series.iterations[100];
+        iteration.setAttribute("some_attribute", "some value");
+        auto E_x = iteration.meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {4, 10}});
+        E_x.storeChunk(rows, {0, 0}, {2, 10});
+        std::unique_ptr<double[]> owned{new double[10]};
+        std::fill_n(owned.get(), 10, 42.);
+        E_x.storeChunk(std::move(owned), {2, 0}, {1, 10});
+        auto span = E_x.storeChunk<double>({3, 0}, {1, 10}).currentBuffer();
+        std::fill(span.begin(), span.end(), -1.);
+        auto B = iteration.meshes["B"];
+        B.makeConstant(3.);
+        B.resetDataset({Datatype::DOUBLE, {5}});
+        series.close();
+    }
+    // nothing is written to disk
+    REQUIRE(!auxiliary::directory_exists("../samples/memory_backend"));
+
+    {
+        Series series(filename, Access::READ_ONLY);
+        REQUIRE(series.iterations.size() == 1);
+        auto iteration = series.iterations[100];
+        REQUIRE(
+            iteration.getAttribute("some_attribute").get<std::string>() ==
+            "some value");
+        auto E_x = iteration.meshes["E"]["x"];
+        REQUIRE(E_x.getExtent() == Extent{4, 10});
+        auto chunks = E_x.availableChunks();
+        REQUIRE(chunks.size() == 3);
+        // span-based chunks are allocated before the buffered ones are flushed
+        REQUIRE(std::any_of(
+            chunks.begin(), chunks.end(), [](WrittenChunkInfo const &chunk) {
+                return chunk.offset == Offset{0, 0} &&
+                    chunk.extent == Extent{2, 10};
+            }));
+
+        auto loaded = E_x.loadChunk<double>({1, 5}, {3, 2});
+        auto view = E_x.loadChunkView<double>({0, 0}, {2, 10});
+        series.flush();
+        std::vector<double> expected{15., 16., 42., 42., -1., -1.};
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            REQUIRE(loaded.get()[i] == expected[i]);
+        }
+        REQUIRE(view.zeroCopy());
+        auto viewSpan = view.currentBuffer();
+        REQUIRE(std::equal(viewSpan.begin(), viewSpan.end(), rows.begin()));
+        REQUIRE(
+            iteration.meshes["B"].getAttribute("value").get<double>() == 3.);
+    }
+
+    // overwriting replaces the previous contents
+    {
+        Series series(filename, Access::CREATE);
+        series.iterations[0].setAttribute("new", 1);
+        series.close();
+    }
+    {
+        Series series(
+            "../samples/./memory_backend/../memory_backend/data.mem",
+            Access::READ_ONLY);
+        REQUIRE(series.iterations.size() == 1);
+        REQUIRE(series.iterations.contains(0));
+    }
+
+    // selection via JSON option
+    std::string const viaOption = "../samples/memory_backend/via_option";
+    {
+        Series series(viaOption, Access::CREATE, R"({"backend": "memory"})");
+        series.iterations[0].setAttribute("new", 1);
+    }
+    {
+        Series series(viaOption, Access::READ_ONLY, R"({"backend": "memory"})");
+        REQUIRE(series.backend() == "MEMORY");
+        REQUIRE(series.iterations.contains(0));
+    }
+    REQUIRE_THROWS_AS(
+        Series("../samples/memory_backend/missing.mem", Access::READ_ONLY),
+        error::ReadError);
+
+    // transient files are released along with the last Series using them
+    std::string const transient = "../samples/memory_backend/transient.mem";
+    {
+        Series series(
+            transient, Access::CREATE, R"({"memory": {"persist": false}})");
+        series.iterations[0].setAttribute("new", 1);
+        series.flush();
+        Series reader(transient, Access::READ_ONLY);
+        REQUIRE(reader.iterations.contains(0));
+    }
+    REQUIRE_THROWS_AS(
+        Series(transient, Access::READ_ONLY), error::ReadError);
+    REQUIRE_THROWS_AS(
+        Series(
+            transient, Access::CREATE, R"({"memory": {"persist": "no"}})"),
+        error::BackendConfigSchema);
+}
+
+#if openPMD_HAS_ADIOS_2_9
+void chaotic_stream(std::string const &filename, bool variableBased)
+{
+    /*
+     * We will write iterations in the following order.
+     */
+    std::vector<uint64_t> iterations{5, 9, 1, 3, 4, 6, 7, 8, 2, 0};
+    std::string jsonConfig = R"(
+{
+    "adios2": {
+        "use_group_table": true
+    }
+})";
+
+    bool weirdOrderWhenReading{};
 
     Series series(filename, Access::CREATE, jsonConfig);
     /*
@@ -7689,10 +8700,11 @@ TEST_CASE("joined_dim", "[serial]")
 #if 100000000 * ADIOS2_VERSION_MAJOR + 1000000 * ADIOS2_VERSION_MINOR +        \
         10000 * ADIOS2_VERSION_PATCH + 100 * ADIOS2_VERSION_TWEAK >=           \
     209000000
-    constexpr char const *supportsJoinedDims[] = {"bp", "bp4", "bp5"};
+    constexpr char const *supportsJoinedDims[] = {
+        "bp", "bp4", "bp5", "h5", "json"};
 #else
-    // no zero-size arrays
-    std::vector<char const *> supportsJoinedDims;
+    // ADIOS2 < v2.9: no zero-size arrays
+    constexpr char const *supportsJoinedDims[] = {"h5", "json"};
 #endif
     for (auto const &t : testedFileExtensions())
     {
@@ -7706,3 +8718,486 @@ TEST_CASE("joined_dim", "[serial]")
         }
     }
 }
+
+void joined_dim_append(std::string const &ext)
+{
+    std::string const filename = "../samples/joinedDimAppend." + ext;
+    {
+        Series s(filename, Access::CREATE);
+        auto it = s.iterations[0];
+
+        // joined along the first dimension, appended over several flushes
+        auto rows = it.meshes["rows"][RecordComponent::SCALAR];
+        rows.resetDataset({Datatype::INT, {Dataset::JOINED_DIMENSION, 3}});
+        // joined along the second dimension
+        auto cols = it.meshes["cols"][RecordComponent::SCALAR];
+        cols.resetDataset({Datatype::DOUBLE, {2, Dataset::JOINED_DIMENSION}});
+        // declared, but never written
+        auto empty = it.meshes["empty"][RecordComponent::SCALAR];
+        empty.resetDataset({Datatype::INT, {Dataset::JOINED_DIMENSION}});
+        // raw buffer, reused after each flush
+        auto raw = it.meshes["raw"][RecordComponent::SCALAR];
+        raw.resetDataset({Datatype::INT, {Dataset::JOINED_DIMENSION}});
+        std::vector<int> rawBuffer(2);
+
+        int nextRow = 0;
+        for (size_t flush = 0; flush < 3; ++flush)
+        {
+            // two chunks of different sizes per flush
+            for (size_t numRows : {size_t(2), size_t(1)})
+            {
+                std::shared_ptr<int[]> data(new int[numRows * 3]);
+                std::iota(data.get(), data.get() + numRows * 3, nextRow * 3);
+                nextRow += int(numRows);
+                rows.storeChunk(std::move(data), {}, {numRows, 3});
+            }
+            std::shared_ptr<double[]> column(
+                new double[2]{double(flush), double(flush) + 0.5});
+            cols.storeChunk(std::move(column), {}, {2, 1});
+            std::fill(rawBuffer.begin(), rawBuffer.end(), int(flush));
+            raw.storeChunkRaw(rawBuffer.data(), {}, {2});
+            s.flush();
+        }
+        // the deferred-data contract has ended with the last flush
+        std::fill(rawBuffer.begin(), rawBuffer.end(), -1);
+        s.close();
+    }
+
+    {
+        Series s(filename, Access::READ_ONLY);
+        auto it = s.iterations[0];
+
+        auto rows = it.meshes["rows"][RecordComponent::SCALAR];
+        REQUIRE(rows.getExtent() == Extent{9, 3});
+        auto rowData = rows.loadChunk<int>();
+        auto cols = it.meshes["cols"][RecordComponent::SCALAR];
+        REQUIRE(cols.getExtent() == Extent{2, 3});
+        auto colData = cols.loadChunk<double>();
+        s.flush();
+
+        for (int i = 0; i < 27; ++i)
+        {
+            REQUIRE(rowData.get()[i] == i);
+        }
+        std::vector<double> expectedColumns{0, 1, 2, 0.5, 1.5, 2.5};
+        for (size_t i = 0; i < expectedColumns.size(); ++i)
+        {
+            REQUIRE(colData.get()[i] == expectedColumns[i]);
+        }
+        REQUIRE(
+            it.meshes["empty"][RecordComponent::SCALAR].getExtent() ==
+            Extent{0});
+
+        auto raw = it.meshes["raw"][RecordComponent::SCALAR];
+        REQUIRE(raw.getExtent() == Extent{6});
+        auto rawData = raw.loadChunk<int>();
+        s.flush();
+        for (int i = 0; i < 6; ++i)
+        {
+            REQUIRE(rawData.get()[i] == i / 2);
+        }
+    }
+}
+
+TEST_CASE("joined_dim_append", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        if (t == "h5" || t == "json")
+        {
+            joined_dim_append(t);
+        }
+    }
+}
+
+void write_buffer_budget(
+    std::string const &ext, std::string const &backendConfig = "{}")
+{
+    std::string name = "../samples/write_buffer_budget." + ext;
+    constexpr size_t chunkSize = 10;
+    constexpr size_t numChunks = 20;
+    constexpr size_t chunkBytes = chunkSize * sizeof(double);
+    {
+        Series write(
+            name,
+            Access::CREATE,
+            json::merge(R"({"write_buffer_budget": 1000})", backendConfig));
+        auto E_x = write.iterations[0].meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {chunkSize * numChunks}});
+        REQUIRE(write.pendingWriteBytes() == 0);
+        size_t expected = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            std::unique_ptr<double[]> chunk{new double[chunkSize]};
+            std::fill_n(chunk.get(), chunkSize, double(i));
+            E_x.storeChunk(std::move(chunk), {i * chunkSize}, {chunkSize});
+            expected += chunkBytes;
+            if (expected > 1000)
+            {
+                // flushed automatically
+                expected = 0;
+            }
+            REQUIRE(write.pendingWriteBytes() == expected);
+        }
+        REQUIRE(write.pendingWriteBytes() > 0);
+        write.flush();
+        REQUIRE(write.pendingWriteBytes() == 0);
+
+        // a flush would end the validity of the span, so none happens
+        auto E_y = write.iterations[0].meshes["E"]["y"];
+        E_y.resetDataset({Datatype::DOUBLE, {chunkSize * numChunks}});
+        auto span = E_y.storeChunk<double>({0}, {chunkSize});
+        size_t pending = write.pendingWriteBytes();
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            std::unique_ptr<double[]> chunk{new double[chunkSize]};
+            std::fill_n(chunk.get(), chunkSize, double(i));
+            E_y.storeChunk(std::move(chunk), {i * chunkSize}, {chunkSize});
+            pending += chunkBytes;
+            REQUIRE(write.pendingWriteBytes() == pending);
+        }
+        std::fill_n(span.currentBuffer().data(), chunkSize, -1.);
+        write.flush();
+        REQUIRE(write.pendingWriteBytes() == 0);
+
+        // monitoring works without a budget, too
+        Series unbudgeted(
+            "../samples/write_buffer_unbudgeted." + ext,
+            Access::CREATE,
+            backendConfig);
+        auto B_x = unbudgeted.iterations[0].meshes["B"]["x"];
+        B_x.resetDataset({Datatype::DOUBLE, {chunkSize}});
+        auto shared = std::shared_ptr<double>{
+            new double[chunkSize], [](double *p) { delete[] p; }};
+        std::fill_n(shared.get(), chunkSize, 1.);
+        B_x.storeChunk(shared, {0}, {chunkSize});
+        REQUIRE(unbudgeted.pendingWriteBytes() == chunkBytes);
+        unbudgeted.flush();
+        REQUIRE(unbudgeted.pendingWriteBytes() == 0);
+        REQUIRE(shared.use_count() == 1);
+    }
+    {
+        Series read(name, Access::READ_ONLY);
+        auto E = read.iterations[0].meshes["E"];
+        auto data_x = E["x"].loadChunk<double>();
+        auto data_y = E["y"].loadChunk<double>();
+        read.flush();
+        for (size_t i = 0; i < numChunks * chunkSize; ++i)
+        {
+            REQUIRE(data_x.get()[i] == double(i / chunkSize));
+            REQUIRE(
+                data_y.get()[i] ==
+                (i < chunkSize ? -1. : double(i / chunkSize)));
+        }
+    }
+}
+
+TEST_CASE("write_buffer_budget", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        if (t == "h5" || t == "json")
+        {
+            write_buffer_budget(t);
+        }
+#if openPMD_HAS_ADIOS_2_9
+        else if (t == "bp")
+        {
+            // flushing to the buffer would keep the chunks until the step ends
+            write_buffer_budget(t, R"(
+                {"adios2": {"engine": {"preferred_flush_target": "disk"}}})");
+        }
+#endif
+        // other backends may keep buffers beyond a flush
+    }
+}
+
+void files_in_flight(std::string const &ext)
+{
+    std::string name = "../samples/files_in_flight/data%T." + ext;
+    constexpr size_t numIterations = 6;
+    constexpr size_t extent = 100;
+    {
+        Series write(name, Access::CREATE, R"({"files_in_flight": 2})");
+        for (size_t i = 0; i < numIterations; ++i)
+        {
+            auto iteration = write.writeIterations()[i];
+            auto E_x = iteration.meshes["E"]["x"];
+            E_x.resetDataset({Datatype::DOUBLE, {extent}});
+            std::vector<double> data(extent, double(i));
+            E_x.storeChunk(data, {0}, {extent});
+            iteration.close();
+        }
+    }
+    {
+        Series read(name, Access::READ_ONLY);
+        REQUIRE(read.iterations.size() == numIterations);
+        for (auto &[index, iteration] : read.iterations)
+        {
+            auto data = iteration.meshes["E"]["x"].loadChunk<double>();
+            iteration.close();
+            for (size_t j = 0; j < extent; ++j)
+            {
+                REQUIRE(data.get()[j] == double(index));
+            }
+        }
+    }
+}
+
+TEST_CASE("files_in_flight", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        // other backends close their files synchronously
+        if (t == "h5" || t == "json")
+        {
+            files_in_flight(t);
+        }
+    }
+}
+
+void dataset_codec(std::string const &ext)
+{
+    constexpr size_t extent = 1000;
+    std::vector<double> smooth(extent);
+    std::vector<int32_t> ints(extent);
+    std::vector<std::complex<double>> complexes(extent);
+    for (size_t i = 0; i < extent; ++i)
+    {
+        smooth[i] = std::sin(double(i) / 100.);
+        ints[i] = int32_t(i / 10);
+        complexes[i] = {double(i), -double(i)};
+    }
+    auto fileName = [&ext](std::string const &codec) {
+        return "../samples/dataset_codec/" + codec + "." + ext;
+    };
+    std::vector<std::string> codecs{
+        "none", "lz", "shuffle", "shuffle_lz", "bitshuffle", "bitshuffle_lz"};
+    for (auto const &codec : codecs)
+    {
+        Series write(fileName(codec), Access::CREATE);
+        std::string options = R"({"codec": ")" + codec + R"("})";
+        auto meshes = write.iterations[0].meshes;
+        auto E_x = meshes["E"]["x"];
+        E_x.resetDataset({Datatype::DOUBLE, {10, extent / 10}, options});
+        // the file is written in between, the dataset must stay writable
+        E_x.storeChunkRaw(smooth.data(), {0, 0}, {5, extent / 10});
+        write.flush();
+        E_x.storeChunkRaw(
+            smooth.data() + extent / 2, {5, 0}, {5, extent / 10});
+        auto rho = meshes["rho"][RecordComponent::SCALAR];
+        rho.resetDataset({determineDatatype<int32_t>(), {extent}, options});
+        // only write the second half, the first remains unwritten
+        rho.storeChunkRaw(ints.data() + extent / 2, {extent / 2}, {extent / 2});
+        auto psi = meshes["psi"][RecordComponent::SCALAR];
+        psi.resetDataset({Datatype::CDOUBLE, {extent}, options});
+        psi.storeChunk(complexes, {0}, {extent});
+        write.close();
+    }
+    for (auto const &codec : codecs)
+    {
+        Series read(fileName(codec), Access::READ_ONLY);
+        auto meshes = read.iterations[0].meshes;
+        auto E_x = meshes["E"]["x"].loadChunk<double>();
+        auto rho = meshes["rho"][RecordComponent::SCALAR]
+                       .loadChunk<int32_t>({extent / 2}, {extent / 2});
+        auto psi = meshes["psi"][RecordComponent::SCALAR]
+                       .loadChunk<std::complex<double>>();
+        read.flush();
+        REQUIRE(meshes["E"]["x"].getExtent() == Extent{10, extent / 10});
+        for (size_t i = 0; i < extent; ++i)
+        {
+            REQUIRE(E_x.get()[i] == smooth[i]);
+            REQUIRE(psi.get()[i] == complexes[i]);
+        }
+        for (size_t i = extent / 2; i < extent; ++i)
+        {
+            REQUIRE(rho.get()[i - extent / 2] == ints[i]);
+        }
+        if (ext == "json")
+        {
+            // unwritten elements remain unwritten in encoded datasets
+            auto chunks =
+                meshes["rho"][RecordComponent::SCALAR].availableChunks();
+            REQUIRE(chunks.size() == 1);
+            REQUIRE(bool(
+                chunks[0] == WrittenChunkInfo({extent / 2}, {extent / 2})));
+            chunks = meshes["psi"][RecordComponent::SCALAR].availableChunks();
+            REQUIRE(chunks.size() == 1);
+            REQUIRE(bool(chunks[0] == WrittenChunkInfo({0}, {extent})));
+        }
+    }
+    auto fileSize = [](std::string const &path) {
+        std::ifstream file(path, std::ios_base::binary | std::ios_base::ate);
+        return size_t(file.tellg());
+    };
+    REQUIRE(fileSize(fileName("shuffle_lz")) < fileSize(fileName("none")));
+
+#if openPMD_HAVE_HDF5
+    if (ext == "h5")
+    {
+        // registered filter formats, readable with the plugins
+        auto filters = [&fileName](std::string const &codec) {
+            hid_t file =
+                H5Fopen(fileName(codec).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+            hid_t dataset = H5Dopen(file, "/data/0/meshes/E/x", H5P_DEFAULT);
+            hid_t plist = H5Dget_create_plist(dataset);
+            std::vector<std::pair<H5Z_filter_t, std::vector<unsigned>>> res;
+            for (int i = 0; i < H5Pget_nfilters(plist); ++i)
+            {
+                unsigned flags;
+                size_t numValues = 8;
+                std::vector<unsigned> values(numValues);
+                H5Z_filter_t id = H5Pget_filter2(
+                    plist,
+                    i,
+                    &flags,
+                    &numValues,
+                    values.data(),
+                    0,
+                    nullptr,
+                    nullptr);
+                values.resize(numValues);
+                res.emplace_back(id, values);
+            }
+            H5Pclose(plist);
+            H5Dclose(dataset);
+            H5Fclose(file);
+            return res;
+        };
+        REQUIRE(filters("none").empty());
+        auto shuffle_lz = filters("shuffle_lz");
+        REQUIRE(shuffle_lz.size() == 2);
+        REQUIRE(shuffle_lz[0].first == H5Z_FILTER_SHUFFLE);
+        REQUIRE(shuffle_lz[1].first == 32004);
+        auto bitshuffle_lz = filters("bitshuffle_lz");
+        REQUIRE(bitshuffle_lz.size() == 1);
+        REQUIRE(bitshuffle_lz[0].first == 32008);
+        // type size and LZ4 compression
+        REQUIRE(bitshuffle_lz[0].second.size() == 5);
+        REQUIRE(bitshuffle_lz[0].second[2] == sizeof(double));
+        REQUIRE(bitshuffle_lz[0].second[4] == 2);
+    }
+#endif
+
+    REQUIRE_THROWS_AS(
+        [&]() {
+            Series write(fileName("unknown"), Access::CREATE);
+            write.iterations[0].meshes["rho"][RecordComponent::SCALAR]
+                .resetDataset({Datatype::DOUBLE, {10}, R"({"codec": "zstd"})"});
+            write.flush();
+        }(),
+        error::BackendConfigSchema);
+}
+
+TEST_CASE("dataset_codec", "[serial]")
+{
+    for (auto const &t : testedFileExtensions())
+    {
+        // ADIOS2 uses its own operators
+        if (t == "h5" || t == "json")
+        {
+            dataset_codec(t);
+        }
+    }
+}
+
+TEST_CASE("codec_advisor", "[serial]")
+{
+    constexpr size_t extent = 10000;
+    std::vector<double> smooth(extent);
+    std::vector<uint64_t> noise(extent);
+    uint64_t state = 42;
+    for (size_t i = 0; i < extent; ++i)
+    {
+        // quantized, as e.g. from a detector
+        smooth[i] = std::round(std::sin(double(i) / 1000.) * 1000.) / 8.;
+        // splitmix64
+        uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        noise[i] = z ^ (z >> 31);
+    }
+    auto countOccurrences = [](std::string const &path,
+                               std::string const &pattern) {
+        std::ifstream file(path);
+        std::string contents{
+            std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+        size_t res = 0;
+        for (auto pos = contents.find(pattern); pos != std::string::npos;
+             pos = contents.find(pattern, pos + 1))
+        {
+            ++res;
+        }
+        return res;
+    };
+    auto write = [&](std::string const &path,
+                     std::string const &seriesOptions,
+                     std::string const &datasetOptions) {
+        Series series(path, Access::CREATE, seriesOptions);
+        for (Series::IterationIndex_t i = 0; i < 2; ++i)
+        {
+            auto meshes = series.iterations[i].meshes;
+            auto E_x = meshes["E"]["x"];
+            E_x.resetDataset({Datatype::DOUBLE, {extent}, datasetOptions});
+            E_x.storeChunk(smooth, {0}, {extent});
+            auto rho = meshes["rho"][RecordComponent::SCALAR];
+            rho.resetDataset(
+                {determineDatatype<uint64_t>(), {extent}, datasetOptions});
+            rho.storeChunk(noise, {0}, {extent});
+            series.iterations[i].close();
+        }
+    };
+    auto check = [&](std::string const &path) {
+        Series read(path, Access::READ_ONLY);
+        for (auto &[index, iteration] : read.iterations)
+        {
+            (void)index;
+            auto E_x = iteration.meshes["E"]["x"].loadChunk<double>();
+            auto rho = iteration.meshes["rho"][RecordComponent::SCALAR]
+                           .loadChunk<uint64_t>();
+            iteration.close();
+            REQUIRE(std::equal(smooth.begin(), smooth.end(), E_x.get()));
+            REQUIRE(std::equal(noise.begin(), noise.end(), rho.get()));
+        }
+    };
+
+    // Series-wide, the decisions carry over to the second iteration
+    write(
+        "../samples/codec_advisor/series_%T.json",
+        R"({"codec_advisor": {"objective": "ratio"}})",
+        "{}");
+    check("../samples/codec_advisor/series_%T.json");
+    for (auto const &file :
+         {"../samples/codec_advisor/series_0.json",
+          "../samples/codec_advisor/series_1.json"})
+    {
+        // smooth data is shuffled and compressed, noise stored as is
+        REQUIRE(countOccurrences(file, R"("codec")") == 1);
+        REQUIRE(countOccurrences(file, R"(shuffle_lz")") == 1);
+    }
+
+    // explicit codecs are left alone
+    write(
+        "../samples/codec_advisor/explicit.json",
+        R"({"codec_advisor": true})",
+        R"({"codec": "lz"})");
+    REQUIRE(
+        countOccurrences(
+            "../samples/codec_advisor/explicit.json", R"("lz")") == 4);
+
+    // per dataset
+    write("../samples/codec_advisor/auto.json", "{}", R"({"codec": "auto"})");
+    check("../samples/codec_advisor/auto.json");
+    REQUIRE(
+        countOccurrences("../samples/codec_advisor/auto.json", R"("codec")") ==
+        2);
+
+    REQUIRE_THROWS_AS(
+        Series(
+            "../samples/codec_advisor/invalid.json",
+            Access::CREATE,
+            R"({"codec_advisor": {"candidates": ["zstd"]}})"),
+        error::BackendConfigSchema);
+}
@@ -25,7 +25,8 @@ except ImportError:
 from TestUtilities.TestUtilities import generateTestFilePath
 
 tested_file_extensions = [
-    ext for ext in io.file_extensions if ext != 'sst' and ext != 'ssc'
+    ext for ext in io.file_extensions
+    if ext != 'sst' and ext != 'ssc' and ext != 'shm'
 ]
 
 